@@ -0,0 +1,56 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "C/benchmarks/ReparserBenchmark.h"
+#include "C/benchmarks/SemanticModelBenchmark.h"
+#include "C/benchmarks/SyntaxVisitorBenchmark.h"
+#include "C/benchmarks/TypeCheckerBenchmark.h"
+#include "C/benchmarks/UnparserBenchmark.h"
+
+#include <cstdlib>
+#include <iostream>
+
+using namespace psy;
+
+int main(int argc, char* argv[])
+{
+    std::size_t queryCnt = 5000000;
+    if (argc > 1)
+        queryCnt = std::strtoul(argv[1], nullptr, 10);
+
+    std::cout << "BENCHMARKS..." << std::endl;
+
+    C::SemanticModelBenchmark semaModelBench(1000, queryCnt);
+    semaModelBench.run(std::cout);
+
+    C::TypeCheckerBenchmark tyCheckerBench(1000, queryCnt);
+    tyCheckerBench.run(std::cout);
+
+    C::ReparserBenchmark reparserBench(1000);
+    reparserBench.run(std::cout);
+
+    C::SyntaxVisitorBenchmark visitorBench(1000);
+    visitorBench.run(std::cout);
+
+    C::UnparserBenchmark unparserBench(1000);
+    unparserBench.run(std::cout);
+
+    return 0;
+}
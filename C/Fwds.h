@@ -25,6 +25,7 @@
 namespace psy {
 namespace C {
 
+class Arena;
 class MemoryPool;
 class SyntaxTree;
 class Compilation;
@@ -47,6 +48,8 @@ class StringLiteral;
 class SyntaxNode;
 class SyntaxNodeList;
 class SyntaxVisitor;
+class CompositeSyntaxVisitor;
+class ParallelSyntaxTraversal;
 
 template <class SyntaxNodeT, class DerivedListT> class CoreSyntaxNodeList;
 template <class SyntaxNodeT> class SyntaxNodePlainList;
@@ -236,11 +239,13 @@ class EmptySymbolName;
 
 /* Scopes */
 class Scope;
+class NameSpace;
 
 /* Compilation */
 class Compilation;
 class Assembly;
 class SemanticModel;
+class TypeInterner;
 
 } // C
 } // psy
@@ -28,6 +28,7 @@
 #include "parser/Lexer.h"
 #include "parser/Parser.h"
 #include "reparser/Reparser.h"
+#include "syntax/StaticSyntaxVisitor.h"
 #include "syntax/SyntaxLexeme_ALL.h"
 #include "syntax/SyntaxNodes.h"
 
@@ -49,6 +50,25 @@
 using namespace psy;
 using namespace C;
 
+namespace {
+
+struct NodesCollector : StaticSyntaxVisitor<NodesCollector>
+{
+    NodesCollector(const SyntaxTree* tree)
+        : StaticSyntaxVisitor(tree)
+    {}
+
+    bool preVisit(const SyntaxNode* node)
+    {
+        nodes_.push_back(node);
+        return true;
+    }
+
+    std::vector<const SyntaxNode*> nodes_;
+};
+
+} // anonymous
+
 struct SyntaxTree::SyntaxTreeImpl
 {
     SyntaxTreeImpl(SourceText text,
@@ -57,13 +77,17 @@ struct SyntaxTree::SyntaxTreeImpl
                    ParseOptions parseOptions,
                    const std::string& filePath)
         : pool_(new MemoryPool())
+        , listPool_(new MemoryPool())
         , text_(std::move(text))
         , textCompleteness_(textCompleteness)
         , textPPState_(textPPState)
         , parseOptions_(std::move(parseOptions))
         , filePath_(filePath)
         , rootNode_(nullptr)
+        , nodeCnt_(0)
         , parseExitedEarly_(false)
+        , nodesByKind_(nullptr)
+        , nodesByKindOffsets_(nullptr)
     {
         if (filePath_.empty())
             filePath_ = "<buffer>";
@@ -71,6 +95,13 @@ struct SyntaxTree::SyntaxTreeImpl
 
     std::unique_ptr<MemoryPool> pool_;
 
+    /*
+     * The cells of the syntax lists are allocated apart from the nodes, so
+     * that those of a list are packed together (rather than interleaved
+     * with the nodes of the subtrees of its elements).
+     */
+    std::unique_ptr<MemoryPool> listPool_;
+
     SourceText text_;
     TextCompleteness textCompleteness_;
     TextPreprocessingState textPPState_;
@@ -86,6 +117,7 @@ struct SyntaxTree::SyntaxTreeImpl
     TextElementTable<StringLiteral> strings_;
 
     SyntaxNode* rootNode_;
+    unsigned int nodeCnt_;
 
     LexedTokens tokens_;
     std::vector<LineDirective> lineDirectives_;
@@ -94,6 +126,13 @@ struct SyntaxTree::SyntaxTreeImpl
 
     bool parseExitedEarly_;
 
+    /*
+     * The nodes bucketed by SyntaxKind into a single array (the offset of
+     * each bucket is in a separate array), both allocated in the pool.
+     */
+    const SyntaxNode** nodesByKind_;
+    unsigned int* nodesByKindOffsets_;
+
     std::vector<Diagnostic> diagnostics_;
 
     std::unordered_set<const Compilation*> attachedCompilations_;
@@ -120,6 +159,21 @@ MemoryPool* SyntaxTree::unitPool() const
     return P->pool_.get();
 }
 
+MemoryPool* SyntaxTree::listPool() const
+{
+    return P->listPool_.get();
+}
+
+unsigned int SyntaxTree::freshNodeOrdinal()
+{
+    return P->nodeCnt_++;
+}
+
+unsigned int SyntaxTree::nodeCount() const
+{
+    return P->nodeCnt_;
+}
+
 std::unique_ptr<SyntaxTree> SyntaxTree::parseText(SourceText text,
                                                   TextPreprocessingState textPPState,
                                                   TextCompleteness textCompleteness,
@@ -134,6 +188,8 @@ std::unique_ptr<SyntaxTree> SyntaxTree::parseText(SourceText text,
                                parseOptions,
                                filePath));
     tree->buildFor(syntaxCategory);
+    if (tree->P->parseOptions_.indexingOfNodesByKind())
+        tree->indexNodesByKind();
     return tree;
 }
 
@@ -169,6 +225,16 @@ std::vector<Diagnostic> SyntaxTree::diagnostics() const
     return P->diagnostics_;
 }
 
+SyntaxTree::NodeRange SyntaxTree::nodesOfKind(SyntaxKind kind) const
+{
+    if (!P->nodesByKind_ || kind < STARTof_Node || kind > ENDof_Node)
+        return NodeRange(nullptr, nullptr);
+
+    auto idx = kind - STARTof_Node;
+    return NodeRange(P->nodesByKind_ + P->nodesByKindOffsets_[idx],
+                     P->nodesByKind_ + P->nodesByKindOffsets_[idx + 1]);
+}
+
 /* Forward calls to the lexed-tokens container */
 void SyntaxTree::addToken(SyntaxToken tk) { P->tokens_.add(tk); }
 SyntaxToken& SyntaxTree::tokenAt(LexedTokens::IndexType tkIdx) { return P->tokens_.tokenAt(tkIdx); }
@@ -219,6 +285,19 @@ void SyntaxTree::buildFor(SyntaxCategory syntaxCategory)
 #endif
 
     Parser parser(this);
+    if (P->textCompleteness_ == TextCompleteness::Full
+            && P->parseOptions_.trackingOfTypedefNames()) {
+        switch (P->parseOptions_.treatmentOfAmbiguities()) {
+            case ParseOptions::TreatmentOfAmbiguities::DisambiguateAlgorithmically:
+            case ParseOptions::TreatmentOfAmbiguities::DisambiguateAlgorithmicallyOrHeuristically:
+                parser.trackTypedefNames();
+                break;
+
+            default:
+                break;
+        }
+    }
+
     switch (syntaxCategory) {
         case SyntaxCategory::Declarations: {
             DeclarationSyntax* decl = nullptr;
@@ -287,7 +366,53 @@ void SyntaxTree::buildFor(SyntaxCategory syntaxCategory)
     Reparser reparser;
     reparser.setDisambiguationStrategy(disambiguationStrategy);
     reparser.setPermitHeuristic(permitHeuristic);
-    reparser.reparse(this);
+    reparser.reparse(this, parser.releaseDeclarationsWithAmbiguities());
+}
+
+/**
+ * Bucket, by SyntaxKind, the nodes of \c this SyntaxTree. This is done once
+ * parse (and disambiguation) is finished, given that the parser may create
+ * nodes that don't end up in the tree: those of an alternative that is
+ * abandoned or of an ambiguity that is resolved.
+ */
+void SyntaxTree::indexNodesByKind()
+{
+    NodesCollector collector(this);
+    collector.visit(P->rootNode_);
+
+    const auto kindCnt = ENDof_Node - STARTof_Node + 1;
+    auto offsets = static_cast<unsigned int*>(
+                P->pool_->allocate(sizeof(unsigned int) * (kindCnt + 1)));
+    std::fill(offsets, offsets + kindCnt + 1, 0);
+
+    std::vector<bool> seen(nodeCount(), false);
+    auto& nodes = collector.nodes_;
+    nodes.erase(std::remove_if(nodes.begin(),
+                               nodes.end(),
+                               [&seen] (const SyntaxNode* node) {
+                                   if (node->kind() < STARTof_Node
+                                           || node->kind() > ENDof_Node
+                                           || seen[node->ordinal()]) {
+                                       return true;
+                                   }
+                                   seen[node->ordinal()] = true;
+                                   return false;
+                               }),
+                nodes.end());
+
+    for (auto node : nodes)
+        ++offsets[node->kind() - STARTof_Node + 1];
+    for (auto i = 0; i < kindCnt; ++i)
+        offsets[i + 1] += offsets[i];
+
+    auto nodesByKind = static_cast<const SyntaxNode**>(
+                P->pool_->allocate(sizeof(const SyntaxNode*) * (nodes.size() + 1)));
+    std::vector<unsigned int> next(offsets, offsets + kindCnt);
+    for (auto node : nodes)
+        nodesByKind[next[node->kind() - STARTof_Node]++] = node;
+
+    P->nodesByKind_ = nodesByKind;
+    P->nodesByKindOffsets_ = offsets;
 }
 
 const ParseOptions& SyntaxTree::parseOptions() const
@@ -300,6 +425,11 @@ const Identifier* SyntaxTree::identifier(const char* s, unsigned size)
     return P->identifiers_.findOrInsert(s, size);
 }
 
+const Identifier* SyntaxTree::findIdentifier(const char* s, unsigned size) const
+{
+    return P->identifiers_.find(s, size);
+}
+
 const StringLiteral* SyntaxTree::stringLiteral(const char* s, unsigned size)
 {
     return P->strings_.findOrInsert(s, size);
@@ -30,6 +30,7 @@
 #include "parser/ParseOptions.h"
 #include "parser/TextCompleteness.h"
 #include "parser/TextPreprocessingState.h"
+#include "syntax/SyntaxKind.h"
 #include "syntax/SyntaxToken.h"
 
 #include "../common/diagnostics/Diagnostic.h"
@@ -37,6 +38,7 @@
 #include "../common/infra/Pimpl.h"
 #include "../common/text/SourceText.h"
 
+#include <cstddef>
 #include <cstdio>
 #include <iostream>
 #include <memory>
@@ -119,6 +121,37 @@ public:
      */
     std::vector<Diagnostic> diagnostics() const;
 
+    /**
+     * \brief The SyntaxTree::NodeRange class.
+     *
+     * A (contiguous) range of the nodes of \c this SyntaxTree.
+     */
+    class PSY_C_API NodeRange
+    {
+    public:
+        NodeRange(const SyntaxNode* const* begin, const SyntaxNode* const* end)
+            : begin_(begin), end_(end)
+        {}
+
+        const SyntaxNode* const* begin() const { return begin_; }
+        const SyntaxNode* const* end() const { return end_; }
+        std::size_t size() const { return end_ - begin_; }
+        bool empty() const { return begin_ == end_; }
+
+    private:
+        const SyntaxNode* const* begin_;
+        const SyntaxNode* const* end_;
+    };
+
+    /**
+     * The nodes of \c this SyntaxTree whose SyntaxKind is \p kind, in the
+     * order in which they appear in the tree (pre-order).
+     *
+     * \remark The range is empty unless \c this SyntaxTree was parsed with
+     * ParseOptions::setIndexingOfNodesByKind.
+     */
+    NodeRange nodesOfKind(SyntaxKind kind) const;
+
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(SyntaxNode);
     PSY_GRANT_ACCESS(SyntaxNodeList);
@@ -127,10 +160,17 @@ PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(Binder);
     PSY_GRANT_ACCESS(Symbol);
     PSY_GRANT_ACCESS(Compilation);
+    PSY_GRANT_ACCESS(SemanticModel);
+    PSY_GRANT_ACCESS(TypeChecker);
     PSY_GRANT_ACCESS(InternalsTestSuite);
     PSY_GRANT_ACCESS(SyntaxWriterDOTFormat); // TODO: Remove this grant.
 
     MemoryPool* unitPool() const;
+    MemoryPool* listPool() const;
+
+    /* Node ordinals */
+    unsigned int freshNodeOrdinal();
+    unsigned int nodeCount() const;
 
     using TokenSequenceType = std::vector<SyntaxToken>;
     using LineColum = std::pair<unsigned int, unsigned int>;
@@ -146,6 +186,7 @@ PSY_INTERNAL_AND_RESTRICTED:
     bool parseExitedEarly() const;
 
     const Identifier* identifier(const char* s, unsigned int size);
+    const Identifier* findIdentifier(const char* s, unsigned int size) const;
     const IntegerConstant* integerConstant(const char* s, unsigned int size);
     const FloatingConstant* floatingConstant(const char* s, unsigned int size);
     const ImaginaryIntegerConstant* imaginaryIntegerConstant(const char* s, unsigned int size);
@@ -183,6 +224,7 @@ private:
     DECL_PIMPL(SyntaxTree)
 
     void buildFor(SyntaxCategory syntaxCategory);
+    void indexNodesByKind();
 
     LinePosition computePosition(unsigned int offset) const;
     unsigned int searchForLineno(unsigned int offset) const;
@@ -0,0 +1,151 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "ReparserBenchmark.h"
+
+#include "SyntaxTree.h"
+#include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxVisitor.h"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+
+using namespace psy;
+using namespace C;
+
+namespace {
+
+class AmbiguityCounter : public SyntaxVisitor
+{
+public:
+    AmbiguityCounter(const SyntaxTree* tree)
+        : SyntaxVisitor(tree)
+    {}
+
+    std::size_t cnt_ = 0;
+
+    virtual bool preVisit(const SyntaxNode* node) override
+    {
+        switch (node->kind()) {
+            case AmbiguousTypeNameOrExpressionAsTypeReference:
+            case AmbiguousCastOrBinaryExpression:
+            case AmbiguousMultiplicationOrPointerDeclaration:
+            case AmbiguousCallOrVariableDeclaration:
+                ++cnt_;
+                break;
+
+            default:
+                break;
+        }
+        return true;
+    }
+};
+
+} // anonymous
+
+ReparserBenchmark::ReparserBenchmark(std::size_t funcCnt)
+    : funcCnt_(funcCnt ? funcCnt : 1)
+{}
+
+void ReparserBenchmark::run(std::ostream& os) const
+{
+    std::ostringstream oss;
+    oss << "typedef int T ;\n"
+        << "typedef double U ;\n";
+    for (std::size_t i = 0; i < funcCnt_; ++i) {
+        oss << "int f" << i << " ( int a , int b , T * p ) {\n"
+            << "    T * x ;\n"
+            << "    U * y ;\n"
+            << "    T ( z ) ;\n"
+            << "    a * b ;\n"
+            << "    b ( a ) ;\n"
+            << "    return ( T ) * p + ( a ) * b + sizeof ( T ) ;\n"
+            << "}\n";
+    }
+    auto text = oss.str();
+
+    auto parse = [&text] (TextCompleteness completeness,
+                          ParseOptions::TreatmentOfAmbiguities treatment,
+                          bool trackTydefNames,
+                          std::size_t* ambigCnt) {
+        ParseOptions parseOpts;
+        parseOpts.setTreatmentOfAmbiguities(treatment);
+        parseOpts.setTrackingOfTypedefNames(trackTydefNames);
+
+        const int passCnt = 5;
+        double ms = 0;
+        for (int i = 0; i < passCnt; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            auto tree = SyntaxTree::parseText(SourceText(text),
+                                              TextPreprocessingState::Preprocessed,
+                                              completeness,
+                                              parseOpts,
+                                              "<benchmark>");
+            auto end = std::chrono::steady_clock::now();
+            ms += std::chrono::duration<double, std::milli>(end - start).count();
+
+            if (i == 0) {
+                AmbiguityCounter counter(tree.get());
+                counter.visit(tree->root());
+                *ambigCnt = counter.cnt_;
+            }
+        }
+        return ms / passCnt;
+    };
+
+    std::size_t ambigCnt = 0;
+    auto noneMs = parse(TextCompleteness::Full,
+                        ParseOptions::TreatmentOfAmbiguities::None,
+                        false,
+                        &ambigCnt);
+
+    std::size_t tySynVerifPendingCnt = 0;
+    auto tySynVerifMs = parse(TextCompleteness::Full,
+                              ParseOptions::TreatmentOfAmbiguities::DisambiguateAlgorithmically,
+                              false,
+                              &tySynVerifPendingCnt);
+
+    std::size_t tydefTrackPendingCnt = 0;
+    auto tydefTrackMs = parse(TextCompleteness::Full,
+                              ParseOptions::TreatmentOfAmbiguities::DisambiguateAlgorithmically,
+                              true,
+                              &tydefTrackPendingCnt);
+
+    std::size_t syntaxCorrelPendingCnt = 0;
+    auto syntaxCorrelMs = parse(TextCompleteness::Fragment,
+                                ParseOptions::TreatmentOfAmbiguities::DisambiguateAlgorithmically,
+                                false,
+                                &syntaxCorrelPendingCnt);
+
+    os << "Reparser" << std::endl
+       << "    ambiguities:       " << ambigCnt << std::endl
+       << "    ms (parse only, as reference): " << noneMs << std::endl
+       << "    TypeSynonymsVerification" << std::endl
+       << "        ms (reparse):  " << tySynVerifMs - noneMs << std::endl
+       << "        pending:       " << tySynVerifPendingCnt << std::endl
+       << "    TypeSynonymsVerification (typedef names tracked while parsing)" << std::endl
+       << "        ms (overhead): " << tydefTrackMs - noneMs << std::endl
+       << "        pending:       " << tydefTrackPendingCnt << std::endl
+       << "    SyntaxCorrelation" << std::endl
+       << "        ms (reparse):  " << syntaxCorrelMs - noneMs << std::endl
+       << "        pending:       " << syntaxCorrelPendingCnt << std::endl;
+}
@@ -0,0 +1,163 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "SemanticModelBenchmark.h"
+
+#include "SyntaxTree.h"
+#include "compilation/Compilation.h"
+#include "compilation/SemanticModel.h"
+#include "symbols/Symbol.h"
+#include "syntax/SyntaxNodes.h"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace psy;
+using namespace C;
+
+namespace {
+
+template <class QueryT>
+double nanosecsPerQuery(std::size_t queryCnt,
+                        const std::vector<const DeclaratorSyntax*>& decltors,
+                        std::size_t& hits,
+                        QueryT query)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < queryCnt; ++i) {
+        if (query(decltors[i % decltors.size()]))
+            ++hits;
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+    return elapsed / queryCnt;
+}
+
+} // anonymous
+
+SemanticModelBenchmark::SemanticModelBenchmark(std::size_t declCnt, std::size_t queryCnt)
+    : declCnt_(declCnt ? declCnt : 1)
+    , queryCnt_(queryCnt)
+{}
+
+void SemanticModelBenchmark::run(std::ostream& os) const
+{
+    std::ostringstream oss;
+    for (std::size_t i = 0; i < declCnt_; ++i) {
+        oss << "int v" << i << " , * p" << i << " ;\n"
+            << "struct s" << i << " { int f" << i << " ; } ;\n"
+            << "int f" << i << " ( int a" << i << " ) { int l , m ; double n ; return a" << i << " ; }\n";
+    }
+
+    auto tree = SyntaxTree::parseText(SourceText(oss.str()),
+                                      TextPreprocessingState::Preprocessed,
+                                      TextCompleteness::Fragment,
+                                      ParseOptions(),
+                                      "<benchmark>");
+
+    // An edit to a single function (in the middle of the text).
+    auto text = oss.str();
+    auto editPos = text.find("return a" + std::to_string(declCnt_ / 2) + " ;");
+    text.insert(editPos, "l = 1 ; ");
+    auto editedTree = SyntaxTree::parseText(SourceText(text),
+                                            TextPreprocessingState::Preprocessed,
+                                            TextCompleteness::Fragment,
+                                            ParseOptions(),
+                                            "<benchmark>");
+
+    auto compilation = Compilation::create(tree->filePath());
+    compilation->addSyntaxTrees({ tree.get() });
+    auto semaModel = compilation->semanticModel(tree.get());
+
+    std::vector<const DeclaratorSyntax*> decltors;
+    for (auto declIt = tree->translationUnitRoot()->declarations(); declIt; declIt = declIt->next) {
+        auto varAndOrFunDecl = declIt->value->asVariableAndOrFunctionDeclaration();
+        if (varAndOrFunDecl) {
+            for (auto decltorIt = varAndOrFunDecl->declarators(); decltorIt; decltorIt = decltorIt->next)
+                decltors.push_back(decltorIt->value);
+            continue;
+        }
+        auto funcDef = declIt->value->asFunctionDefinition();
+        if (funcDef)
+            decltors.push_back(funcDef->declarator());
+    }
+
+    // A pointer-keyed hash table, as reference.
+    std::unordered_map<const SyntaxNode*, const Symbol*> hashed;
+    for (auto decltor : decltors)
+        hashed[decltor] = semaModel->declaredSymbol(decltor);
+
+    std::size_t hits = 0;
+    auto flatNs = nanosecsPerQuery(queryCnt_, decltors, hits,
+            [semaModel] (const DeclaratorSyntax* decltor) {
+                return semaModel->declaredSymbol(decltor);
+            });
+    auto hashedNs = nanosecsPerQuery(queryCnt_, decltors, hits,
+            [&hashed] (const DeclaratorSyntax* decltor) {
+                auto it = hashed.find(decltor);
+                return it == hashed.end() ? nullptr : it->second;
+            });
+
+    os << "SemanticModel::declaredSymbol" << std::endl
+       << "    declarators: " << decltors.size() << std::endl
+       << "    queries:     " << queryCnt_ << std::endl
+       << "    ns/query:    " << flatNs << std::endl
+       << "    ns/query (pointer-keyed hash table, as reference): " << hashedNs << std::endl
+       << "    hits:        " << hits << std::endl;
+
+    using TreatmentOfFunctionBodies = Compilation::TreatmentOfFunctionBodies;
+    for (auto treatOfFuncBodies : { TreatmentOfFunctionBodies::BindEagerly,
+                                    TreatmentOfFunctionBodies::BindOnDemand }) {
+        auto start = std::chrono::steady_clock::now();
+        auto otherCompilation = Compilation::create(tree->filePath());
+        otherCompilation->setTreatmentOfFunctionBodies(treatOfFuncBodies);
+        otherCompilation->addSyntaxTrees({ tree.get() });
+        otherCompilation->semanticModel(tree.get())->declaredSymbol(decltors.back());
+        auto end = std::chrono::steady_clock::now();
+
+        os << "Time to first query ("
+           << (treatOfFuncBodies == TreatmentOfFunctionBodies::BindEagerly
+                   ? "function bodies bound eagerly"
+                   : "function bodies bound on demand")
+           << "): "
+           << std::chrono::duration<double, std::milli>(end - start).count() << " ms"
+           << std::endl;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto otherCompilation = Compilation::create(editedTree->filePath());
+    otherCompilation->addSyntaxTrees({ editedTree.get() });
+    otherCompilation->semanticModel(editedTree.get());
+    auto end = std::chrono::steady_clock::now();
+    os << "Time to recompute the SemanticModel of an edited tree (from scratch): "
+       << std::chrono::duration<double, std::milli>(end - start).count() << " ms"
+       << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    compilation->replaceSyntaxTree(tree.get(), editedTree.get());
+    compilation->semanticModel(editedTree.get());
+    end = std::chrono::steady_clock::now();
+    os << "Time to recompute the SemanticModel of an edited tree (incrementally): "
+       << std::chrono::duration<double, std::milli>(end - start).count() << " ms"
+       << std::endl;
+}
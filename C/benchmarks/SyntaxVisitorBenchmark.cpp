@@ -0,0 +1,253 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "SyntaxVisitorBenchmark.h"
+
+#include "SyntaxTree.h"
+#include "binder/TypeChecker.h"
+#include "compilation/Compilation.h"
+#include "compilation/SemanticModel.h"
+#include "reparser/NameCataloger.h"
+#include "symbols/Symbol_ALL.h"
+#include "syntax/CompositeSyntaxVisitor.h"
+#include "syntax/ParallelSyntaxTraversal.h"
+#include "syntax/StaticSyntaxVisitor.h"
+#include "syntax/SyntaxNamePrinter.h"
+#include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxVisitor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace psy;
+using namespace C;
+
+namespace {
+
+class NodeCounter : public SyntaxVisitor
+{
+public:
+    NodeCounter(const SyntaxTree* tree)
+        : SyntaxVisitor(tree)
+    {}
+
+    std::size_t cnt_ = 0;
+
+    virtual bool preVisit(const SyntaxNode*) override
+    {
+        ++cnt_;
+        return true;
+    }
+};
+
+class StaticNodeCounter : public StaticSyntaxVisitor<StaticNodeCounter>
+{
+public:
+    StaticNodeCounter(const SyntaxTree* tree)
+        : StaticSyntaxVisitor(tree)
+    {}
+
+    std::size_t cnt_ = 0;
+
+    bool preVisit(const SyntaxNode*)
+    {
+        ++cnt_;
+        return true;
+    }
+};
+
+class CallExpressionCollector : public SyntaxVisitor
+{
+public:
+    CallExpressionCollector(const SyntaxTree* tree)
+        : SyntaxVisitor(tree)
+    {}
+
+    std::vector<const SyntaxNode*> calls_;
+
+    virtual Action visitCallExpression(const CallExpressionSyntax* node) override
+    {
+        calls_.push_back(node);
+        return Action::Visit;
+    }
+};
+
+template <class PassT>
+double millisecsPerPass(PassT pass)
+{
+    const int passCnt = 10;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < passCnt; ++i)
+        pass();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / passCnt;
+}
+
+} // anonymous
+
+SyntaxVisitorBenchmark::SyntaxVisitorBenchmark(std::size_t funcCnt)
+    : funcCnt_(funcCnt ? funcCnt : 1)
+{}
+
+void SyntaxVisitorBenchmark::run(std::ostream& os) const
+{
+    std::ostringstream oss;
+    oss << "struct s { int i ; double d ; struct s * n ; } ;\n"
+        << "double g ( int , double ) ;\n";
+    for (std::size_t i = 0; i < funcCnt_; ++i) {
+        oss << "long f" << i << " ( struct s * p , int a [ ] , unsigned u ) {\n"
+            << "    char c = 'c' ; short h = 2 ; long l = u + c * h ;\n"
+            << "    double x = g ( a [ 1 ] , p -> d ) / ( l - 1.5f ) ;\n"
+            << "    p -> n -> i += ( int ) x << 2 ;\n"
+            << "    for ( int k = 0 ; k < u ; ++ k ) l = l + a [ k ] * ( h | c ) ;\n"
+            << "    if ( l > 0 ) { struct s t ; t . i = l ; l = t . i ; }\n"
+            << "    return p == 0 ? l : & a [ 2 ] - a + ( * p ) . i ;\n"
+            << "}\n";
+    }
+
+    auto text = oss.str();
+    auto parse = [&text] (bool indexNodes) {
+        ParseOptions parseOpts;
+        parseOpts.setIndexingOfNodesByKind(indexNodes);
+        return SyntaxTree::parseText(SourceText(text),
+                                     TextPreprocessingState::Preprocessed,
+                                     TextCompleteness::Fragment,
+                                     parseOpts,
+                                     "<benchmark>");
+    };
+
+    std::unique_ptr<SyntaxTree> tree;
+    auto parseMs = millisecsPerPass([&] () { tree = parse(false); });
+    auto parseIndexingMs = millisecsPerPass([&] () { tree = parse(true); });
+
+    std::size_t nodeCnt = 0;
+    auto virtualMs = millisecsPerPass([&] () {
+        NodeCounter counter(tree.get());
+        counter.visit(tree->root());
+        nodeCnt = counter.cnt_;
+    });
+
+    std::size_t staticNodeCnt = 0;
+    auto staticMs = millisecsPerPass([&] () {
+        StaticNodeCounter counter(tree.get());
+        counter.visit(tree->root());
+        staticNodeCnt = counter.cnt_;
+    });
+
+    auto catalogMs = millisecsPerPass([&] () {
+        NameCataloger cataloger(tree.get());
+        cataloger.catalogFor(tree->root());
+    });
+
+    const SemanticModel* semaModel = nullptr;
+    std::unique_ptr<Compilation> compilation;
+    auto semaModelMs = millisecsPerPass([&] () {
+        compilation = Compilation::create(tree->filePath());
+        compilation->addSyntaxTrees({ tree.get() });
+        semaModel = compilation->semanticModel(tree.get());
+    });
+
+    auto funcDef = tree->translationUnitRoot()->declarations()->next->next->value->asFunctionDefinition();
+    auto fileScope = semaModel->declaredSymbol(funcDef)->scope();
+    auto tyCheckMs = millisecsPerPass([&] () {
+        TypeChecker tyChecker(const_cast<SemanticModel*>(semaModel), tree.get());
+        tyChecker.typeCheck(fileScope);
+    });
+
+    auto printMs = millisecsPerPass([&] () {
+        std::ostringstream out;
+        SyntaxNamePrinter printer(tree.get());
+        printer.print(tree->root(), SyntaxNamePrinter::Style::Decorated, out);
+    });
+
+    std::size_t callCnt = 0;
+    auto callsByTraversalMs = millisecsPerPass([&] () {
+        CallExpressionCollector collector(tree.get());
+        collector.visit(tree->root());
+        callCnt = collector.calls_.size();
+    });
+
+    std::size_t indexedCallCnt = 0;
+    auto callsByKindMs = millisecsPerPass([&] () {
+        auto calls = tree->nodesOfKind(CallExpression);
+        std::vector<const SyntaxNode*> v(calls.begin(), calls.end());
+        indexedCallCnt = v.size();
+    });
+
+    const int analysisCnt = 3;
+    auto separateMs = millisecsPerPass([&] () {
+        NodeCounter counter(tree.get());
+        counter.visit(tree->root());
+        CallExpressionCollector collector(tree.get());
+        collector.visit(tree->root());
+        NodeCounter otherCounter(tree.get());
+        otherCounter.visit(tree->root());
+    });
+
+    auto fusedMs = millisecsPerPass([&] () {
+        NodeCounter counter(tree.get());
+        CallExpressionCollector collector(tree.get());
+        NodeCounter otherCounter(tree.get());
+        CompositeSyntaxVisitor composite;
+        composite.add(&counter);
+        composite.add(&collector);
+        composite.add(&otherCounter);
+        composite.visit(tree->root());
+    });
+
+    const auto threadCnt = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t parallelNodeCnt = 0;
+    ParallelSyntaxTraversal traversal(
+        [&tree] () {
+            return std::unique_ptr<SyntaxVisitor>(new NodeCounter(tree.get()));
+        },
+        [&parallelNodeCnt] (const DeclarationSyntax*, SyntaxVisitor* visitor) {
+            parallelNodeCnt += static_cast<NodeCounter*>(visitor)->cnt_;
+        });
+    auto parallelMs = millisecsPerPass([&] () {
+        parallelNodeCnt = 1;
+        traversal.traverse(tree->translationUnitRoot(), threadCnt);
+    });
+
+    os << "SyntaxVisitor" << std::endl
+       << "    nodes:             " << nodeCnt << std::endl
+       << "    nodes (static):    " << staticNodeCnt << std::endl
+       << "    ms/pass (traversal, SyntaxVisitor):       " << virtualMs << std::endl
+       << "    ms/pass (traversal, StaticSyntaxVisitor): " << staticMs << std::endl
+       << "    ms/pass (traversal, ParallelSyntaxTraversal, " << threadCnt << " threads): " << parallelMs
+       << " (nodes: " << parallelNodeCnt << ")" << std::endl
+       << "    ms/pass (NameCataloger):                  " << catalogMs << std::endl
+       << "    ms/pass (TypeChecker):                    " << tyCheckMs << std::endl
+       << "    ms/pass (SemanticModel, Binder and TypeChecker): " << semaModelMs << std::endl
+       << "    ms/pass (SyntaxNamePrinter, decorated):   " << printMs << std::endl
+       << "    ms/pass (" << analysisCnt << " visitors, separately):           " << separateMs << std::endl
+       << "    ms/pass (" << analysisCnt << " visitors, CompositeSyntaxVisitor): " << fusedMs << std::endl
+       << "SyntaxTree::nodesOfKind" << std::endl
+       << "    calls:             " << callCnt << std::endl
+       << "    calls (indexed):   " << indexedCallCnt << std::endl
+       << "    ms/pass (parse):                          " << parseMs << std::endl
+       << "    ms/pass (parse, indexing nodes by kind):  " << parseIndexingMs << std::endl
+       << "    ms/pass (CallExpression, traversal):      " << callsByTraversalMs << std::endl
+       << "    ms/pass (CallExpression, nodesOfKind):    " << callsByKindMs << std::endl;
+}
@@ -0,0 +1,128 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "TypeCheckerBenchmark.h"
+
+#include "SyntaxTree.h"
+#include "binder/TypeChecker.h"
+#include "compilation/Compilation.h"
+#include "compilation/SemanticModel.h"
+#include "symbols/Symbol_ALL.h"
+#include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxVisitor.h"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace psy;
+using namespace C;
+
+namespace {
+
+class ExpressionCollector : public SyntaxVisitor
+{
+public:
+    ExpressionCollector(const SyntaxTree* tree)
+        : SyntaxVisitor(tree)
+    {}
+
+    std::vector<const ExpressionSyntax*> exprs_;
+
+    virtual bool preVisit(const SyntaxNode* node) override
+    {
+        if (auto expr = dynamic_cast<const ExpressionSyntax*>(node))
+            exprs_.push_back(expr);
+        return true;
+    }
+};
+
+} // anonymous
+
+TypeCheckerBenchmark::TypeCheckerBenchmark(std::size_t funcCnt, std::size_t queryCnt)
+    : funcCnt_(funcCnt ? funcCnt : 1)
+    , queryCnt_(queryCnt)
+{}
+
+void TypeCheckerBenchmark::run(std::ostream& os) const
+{
+    std::ostringstream oss;
+    oss << "struct s { int i ; double d ; struct s * n ; } ;\n"
+        << "double g ( int , double ) ;\n";
+    for (std::size_t i = 0; i < funcCnt_; ++i) {
+        oss << "long f" << i << " ( struct s * p , int a [ ] , unsigned u ) {\n"
+            << "    char c = 'c' ; short h = 2 ; long l = u + c * h ;\n"
+            << "    double x = g ( a [ 1 ] , p -> d ) / ( l - 1.5f ) ;\n"
+            << "    p -> n -> i += ( int ) x << 2 ;\n"
+            << "    for ( int k = 0 ; k < u ; ++ k ) l = l + a [ k ] * ( h | c ) ;\n"
+            << "    return p == 0 ? l : & a [ 2 ] - a + ( * p ) . i ;\n"
+            << "}\n";
+    }
+
+    auto tree = SyntaxTree::parseText(SourceText(oss.str()),
+                                      TextPreprocessingState::Preprocessed,
+                                      TextCompleteness::Fragment,
+                                      ParseOptions(),
+                                      "<benchmark>");
+
+    auto start = std::chrono::steady_clock::now();
+    auto compilation = Compilation::create(tree->filePath());
+    compilation->addSyntaxTrees({ tree.get() });
+    auto semaModel = compilation->semanticModel(tree.get());
+    auto end = std::chrono::steady_clock::now();
+    auto semaModelMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    ExpressionCollector collector(tree.get());
+    collector.visit(tree->root());
+    const auto& exprs = collector.exprs_;
+
+    auto funcDef = tree->translationUnitRoot()->declarations()->next->next->value->asFunctionDefinition();
+    auto fileScope = semaModel->declaredSymbol(funcDef)->scope();
+
+    // The TypeChecker alone (its results overwrite the memoized ones).
+    const int passCnt = 10;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < passCnt; ++i) {
+        TypeChecker tyChecker(const_cast<SemanticModel*>(semaModel), tree.get());
+        tyChecker.typeCheck(fileScope);
+    }
+    end = std::chrono::steady_clock::now();
+    auto checkMs = std::chrono::duration<double, std::milli>(end - start).count() / passCnt;
+
+    std::size_t typed = 0;
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < queryCnt_; ++i) {
+        if (semaModel->typeOf(exprs[i % exprs.size()]))
+            ++typed;
+    }
+    end = std::chrono::steady_clock::now();
+    auto queryNs = std::chrono::duration<double, std::nano>(end - start).count() / queryCnt_;
+
+    os << "TypeChecker" << std::endl
+       << "    expressions:       " << exprs.size() << std::endl
+       << "    ms/pass:           " << checkMs << std::endl
+       << "    expressions/ms:    " << exprs.size() / checkMs << std::endl
+       << "    ms (SemanticModel, binding included, as reference): " << semaModelMs << std::endl
+       << "SemanticModel::typeOf" << std::endl
+       << "    queries:           " << queryCnt_ << std::endl
+       << "    ns/query:          " << queryNs << std::endl
+       << "    typed:             " << typed << std::endl;
+}
@@ -0,0 +1,181 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "UnparserBenchmark.h"
+
+#include "SyntaxTree.h"
+#include "parser/Unparser.h"
+#include "syntax/SyntaxDumper.h"
+
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+using namespace psy;
+using namespace C;
+
+namespace {
+
+class TokenCounter : public SyntaxDumper
+{
+public:
+    using SyntaxDumper::SyntaxDumper;
+
+    std::size_t count(const SyntaxNode* node)
+    {
+        cnt_ = 0;
+        visit(node);
+        return cnt_;
+    }
+
+private:
+    std::size_t cnt_;
+
+    void terminal(const SyntaxToken& tk, const SyntaxNode*) override
+    {
+        if (tk.kind() != EndOfFile)
+            ++cnt_;
+    }
+};
+
+/*
+ * The reference: tokens streamed one at a time into the std::ostream.
+ */
+class StreamingUnparser : public SyntaxDumper
+{
+public:
+    using SyntaxDumper::SyntaxDumper;
+
+    void unparse(const SyntaxNode* node, std::ostream& os)
+    {
+        os_ = &os;
+        visit(node);
+    }
+
+private:
+    std::ostream* os_;
+
+    void terminal(const SyntaxToken& tk, const SyntaxNode*) override
+    {
+        if (tk.kind() == EndOfFile)
+            return;
+
+        *os_ << tk.valueText_c_str();
+
+        if (tk.kind() == CloseBraceToken
+                || tk.kind() == OpenBraceToken
+                || tk.kind() == SemicolonToken)
+            *os_ << "\n";
+        else
+            *os_ << " ";
+    }
+};
+
+template <class PassT>
+double millisecsPerPass(PassT pass)
+{
+    const int passCnt = 10;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < passCnt; ++i)
+        pass();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / passCnt;
+}
+
+} // anonymous
+
+UnparserBenchmark::UnparserBenchmark(std::size_t funcCnt)
+    : funcCnt_(funcCnt ? funcCnt : 1)
+{}
+
+void UnparserBenchmark::run(std::ostream& os) const
+{
+    std::ostringstream oss;
+    oss << "struct s { int i ; double d ; struct s * n ; } ;\n"
+        << "double g ( int , double ) ;\n";
+    for (std::size_t i = 0; i < funcCnt_; ++i) {
+        oss << "long f" << i << " (struct s *p, int a[], unsigned u)\n"
+            << "{\n"
+            << "    /* locals */\n"
+            << "    char c = 'c'; short h = 2; long l = u + c * h;\n"
+            << "    double x = g(a[1], p->d) / (l - 1.5f);\n"
+            << "    for (int k = 0; k < u; ++k)\n"
+            << "        l = l + a[k] * (h | c);\n"
+            << "    return p == 0 ? l : &a[2] - a + (*p).i;\n"
+            << "}\n\n";
+    }
+
+    auto tree = SyntaxTree::parseText(SourceText(oss.str()),
+                                      TextPreprocessingState::Preprocessed,
+                                      TextCompleteness::Fragment,
+                                      ParseOptions(),
+                                      "<benchmark>");
+    auto root = tree->root();
+
+    TokenCounter counter(tree.get());
+    auto tkCnt = counter.count(root);
+
+    auto streamMs = millisecsPerPass([&] () {
+        std::ostringstream out;
+        StreamingUnparser unparser(tree.get());
+        unparser.unparse(root, out);
+    });
+
+    Unparser unparser(tree.get());
+
+    auto ostreamMs = millisecsPerPass([&] () {
+        std::ostringstream out;
+        unparser.unparse(root, out);
+    });
+
+    std::string buffer;
+    auto bufferMs = millisecsPerPass([&] () {
+        buffer.clear();
+        unparser.unparse(root, buffer);
+    });
+
+    auto bufferOrigMs = millisecsPerPass([&] () {
+        buffer.clear();
+        unparser.unparse(root, buffer, Unparser::Spacing::Original);
+    });
+
+    auto file = std::tmpfile();
+    auto fileMs = 0.0;
+    if (file) {
+        fileMs = millisecsPerPass([&] () {
+            std::rewind(file);
+            unparser.unparse(root, file);
+        });
+        std::fclose(file);
+    }
+
+    auto tkPerSec = [tkCnt] (double ms) {
+        return ms > 0 ? static_cast<std::size_t>(tkCnt / (ms / 1000)) : 0;
+    };
+
+    os << "Unparser" << std::endl
+       << "    tokens:            " << tkCnt << std::endl
+       << "    tokens/s (std::ostream, token by token):  " << tkPerSec(streamMs) << std::endl
+       << "    tokens/s (std::ostream):                  " << tkPerSec(ostreamMs) << std::endl
+       << "    tokens/s (std::string, reused):           " << tkPerSec(bufferMs) << std::endl
+       << "    tokens/s (std::string, reused, original): " << tkPerSec(bufferOrigMs) << std::endl
+       << "    tokens/s (FILE*):                         " << tkPerSec(fileMs) << std::endl;
+}
@@ -24,10 +24,13 @@
 
 #include "binder/Scope.h"
 #include "binder/ConstraintsInDeclarations.h"
+#include "compilation/Compilation.h"
 #include "compilation/SemanticModel.h"
+#include "infra/Arena.h"
 #include "symbols/Symbol_ALL.h"
 #include "symbols/SymbolName_ALL.h"
 #include "syntax/SyntaxFacts.h"
+#include "syntax/SyntaxLexeme_ALL.h"
 #include "syntax/SyntaxNodes.h"
 #include "syntax/SyntaxUtilities.h"
 
@@ -39,8 +42,11 @@ using namespace psy;
 using namespace C;
 
 Binder::Binder(SemanticModel* semaModel, const SyntaxTree* tree)
-    : SyntaxVisitor(tree)
+    : StaticSyntaxVisitor(tree)
     , semaModel_(semaModel)
+    , symArena_(semaModel->symbolArena())
+    , deferFuncBodies_(semaModel->compilation()->treatmentOfFunctionBodies()
+                            == Compilation::TreatmentOfFunctionBodies::BindOnDemand)
     , stashedScope_(nullptr)
     , diagReporter_(this)
 {}
@@ -66,13 +72,47 @@ void Binder::bind()
 //    PSY_ASSERT_W_MSG(symDEFs_.empty(), return, "unexpected remaining symbol");
 }
 
+/*
+ * Bind the (deferred) body of a function, within the function's block scope.
+ */
+void Binder::bindFunctionBody(const CompoundStatementSyntax* body, Scope* scope, Symbol* containingSym)
+{
+    scopes_.push(scope);
+    syms_.push(containingSym);
+
+    for (auto stmtIt = body->statements(); stmtIt; stmtIt = stmtIt->next)
+        visit(stmtIt->value);
+
+    syms_.pop();
+    scopes_.pop();
+}
+
+/*
+ * Bind an external declaration (alone), within the file scope.
+ */
+void Binder::bindExternalDeclaration(const DeclarationSyntax* decl, Scope* fileScope, Symbol* libSym)
+{
+    scopes_.push(fileScope);
+    syms_.push(libSym);
+
+    visit(decl);
+
+    syms_.pop();
+    scopes_.pop();
+}
+
 void Binder::openScope(ScopeKind scopeK)
 {
-    std::unique_ptr<Scope> scope(new Scope(scopeK));
-    scopes_.push(scope.get());
+    // Scopes may outlive the tree (see Compilation::replaceSyntaxTree).
+    auto pool = semaModel_->symbolArena()->pool();
+    auto scope = new (pool) Scope(scopeK, pool);
 
     auto enclosingScope = scopes_.top();
-    enclosingScope->enclose(std::move(scope));
+    if (enclosingScope)
+        enclosingScope->enclose(scope);
+
+    scopes_.push(scope);
+    semaModel_->storeScope(scope);
 }
 
 void Binder::reopenStashedScope()
@@ -94,20 +134,20 @@ void Binder::closeScopeAndStashIt()
 }
 
 template <class SymT>
-SymT* Binder::pushSym(const SyntaxNode* node, std::unique_ptr<SymT> sym)
+SymT* Binder::pushSym(const SyntaxNode* node, SymT* sym)
 {
-    syms_.push(sym.get());
-    return static_cast<SymT*>(semaModel_->storeDeclaredSym(node, std::move(sym)));
+    syms_.push(sym);
+    return static_cast<SymT*>(semaModel_->storeDeclaredSym(node, sym));
 }
 
-template FunctionSymbol* Binder::pushSym<FunctionSymbol>(const SyntaxNode*, std::unique_ptr<FunctionSymbol>);
-template FieldSymbol* Binder::pushSym<FieldSymbol>(const SyntaxNode*, std::unique_ptr<FieldSymbol>);
-template EnumeratorSymbol* Binder::pushSym<EnumeratorSymbol>(const SyntaxNode*, std::unique_ptr<EnumeratorSymbol>);
-template ParameterSymbol* Binder::pushSym<ParameterSymbol>(const SyntaxNode*, std::unique_ptr<ParameterSymbol>);
-template VariableSymbol* Binder::pushSym<VariableSymbol>(const SyntaxNode*, std::unique_ptr<VariableSymbol>);
-template ArrayTypeSymbol* Binder::pushSym<ArrayTypeSymbol>(const SyntaxNode*, std::unique_ptr<ArrayTypeSymbol>);
-template NamedTypeSymbol* Binder::pushSym<NamedTypeSymbol>(const SyntaxNode*, std::unique_ptr<NamedTypeSymbol>);
-template PointerTypeSymbol* Binder::pushSym<PointerTypeSymbol>(const SyntaxNode*, std::unique_ptr<PointerTypeSymbol>);
+template FunctionSymbol* Binder::pushSym<FunctionSymbol>(const SyntaxNode*, FunctionSymbol*);
+template FieldSymbol* Binder::pushSym<FieldSymbol>(const SyntaxNode*, FieldSymbol*);
+template EnumeratorSymbol* Binder::pushSym<EnumeratorSymbol>(const SyntaxNode*, EnumeratorSymbol*);
+template ParameterSymbol* Binder::pushSym<ParameterSymbol>(const SyntaxNode*, ParameterSymbol*);
+template VariableSymbol* Binder::pushSym<VariableSymbol>(const SyntaxNode*, VariableSymbol*);
+template ArrayTypeSymbol* Binder::pushSym<ArrayTypeSymbol>(const SyntaxNode*, ArrayTypeSymbol*);
+template NamedTypeSymbol* Binder::pushSym<NamedTypeSymbol>(const SyntaxNode*, NamedTypeSymbol*);
+template PointerTypeSymbol* Binder::pushSym<PointerTypeSymbol>(const SyntaxNode*, PointerTypeSymbol*);
 
 void Binder::popSym()
 {
@@ -115,22 +155,44 @@ void Binder::popSym()
 }
 
 template <class TySymT>
-TySymT* Binder::pushTySym(std::unique_ptr<TySymT> tySym)
+TySymT* Binder::pushTySym(TySymT* tySym)
 {
-    tySyms_.push(tySym.get());
-    return static_cast<TySymT*>(semaModel_->storeUsedSym(std::move(tySym)));
+    tySyms_.push(tySym);
+    return tySym;
 }
 
-template ArrayTypeSymbol* Binder::pushTySym<ArrayTypeSymbol>(std::unique_ptr<ArrayTypeSymbol>);
-template FunctionTypeSymbol* Binder::pushTySym<FunctionTypeSymbol>(std::unique_ptr<FunctionTypeSymbol>);
-template NamedTypeSymbol* Binder::pushTySym<NamedTypeSymbol>(std::unique_ptr<NamedTypeSymbol>);
-template PointerTypeSymbol* Binder::pushTySym<PointerTypeSymbol>(std::unique_ptr<PointerTypeSymbol>);
+template ArrayTypeSymbol* Binder::pushTySym<ArrayTypeSymbol>(ArrayTypeSymbol*);
+template FunctionTypeSymbol* Binder::pushTySym<FunctionTypeSymbol>(FunctionTypeSymbol*);
+template NamedTypeSymbol* Binder::pushTySym<NamedTypeSymbol>(NamedTypeSymbol*);
+template PointerTypeSymbol* Binder::pushTySym<PointerTypeSymbol>(PointerTypeSymbol*);
 
 void Binder::popTySym()
 {
     tySyms_.pop();
 }
 
+/*
+ * The type of a tag is identified by the Scope in which the tag is declared
+ * (6.2.1-4); that of a tag not (yet) declared, by the current Scope (6.7.2.3-8).
+ */
+void Binder::makeTagTySymAndPushIt(TagSymbolName::TagChoice tagChoice, SyntaxToken tagTk)
+{
+    const Scope* scope = scopes_.top();
+    auto lexeme = tagTk.valueLexeme();
+    if (scope && lexeme && lexeme->asIdentifier()) {
+        auto tagSym = scope->searchForSymbol(lexeme->asIdentifier(), NameSpaceKind::Tags);
+        if (tagSym)
+            scope = tagSym->scope();
+    }
+
+    pushTySym(new (&tySymArena_) NamedTypeSymbol(&tySymArena_,
+                                                 tree_,
+                                                 scope,
+                                                 syms_.top(),
+                                                 tagChoice,
+                                                 tagTk.valueText_c_str()));
+}
+
     //--------------//
     // Declarations //
     //--------------//
@@ -141,8 +203,12 @@ SyntaxVisitor::Action Binder::visitTranslationUnit(const TranslationUnitSyntax*
 
     openScope(ScopeKind::File);
 
-    for (auto declIt = node->declarations(); declIt; declIt = declIt->next)
+    std::size_t declIdx = 0;
+    for (auto declIt = node->declarations(); declIt; declIt = declIt->next) {
+        semaModel_->enterExternalDeclaration(declIdx++);
         visit(declIt->value);
+    }
+    semaModel_->exitExternalDeclarations();
 
     closeScope();
 
@@ -25,11 +25,12 @@
 #include "Fwds.h"
 
 #include "binder/Scope.h"
+#include "infra/Arena.h"
 #include "parser/LexedTokens.h"
 #include "symbols/SymbolName.h"
 #include "symbols/Symbol_ALL.h"
 #include "symbols/TypeKind.h"
-#include "syntax/SyntaxVisitor.h"
+#include "syntax/StaticSyntaxVisitor.h"
 
 #include "../common/diagnostics/DiagnosticDescriptor.h"
 #include "../common/infra/InternalAccess.h"
@@ -47,7 +48,7 @@ class SemanticModel;
 /**
  * \brief The Binder class.
  */
-class PSY_C_NON_API Binder final : protected SyntaxVisitor
+class PSY_C_NON_API Binder final : protected StaticSyntaxVisitor<Binder>
 {
     friend class BinderTester;
 
@@ -57,11 +58,14 @@ PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(ConstraintsInTypeSpecifiers);
     PSY_GRANT_ACCESS(ConstraintsInDeclarators);
     PSY_GRANT_ACCESS(SemanticsOfTypeQualifiers);
+    PSY_GRANT_ACCESS(StaticSyntaxVisitor<Binder>);
 
     Binder(SemanticModel* semaModel, const SyntaxTree* tree);
     ~Binder();
 
     void bind();
+    void bindFunctionBody(const CompoundStatementSyntax* body, Scope* scope, Symbol* containingSym);
+    void bindExternalDeclaration(const DeclarationSyntax* decl, Scope* fileScope, Symbol* libSym);
 
 private:
     // Unavailable
@@ -69,6 +73,8 @@ private:
     void operator=(const Binder&) = delete;
 
     SemanticModel* semaModel_;
+    Arena* symArena_;
+    bool deferFuncBodies_;
 
     void openScope(ScopeKind scopeK);
     void closeScope();
@@ -77,21 +83,28 @@ private:
     std::stack<Scope*> scopes_;
     Scope* stashedScope_;
 
-    template <class SymT> SymT* pushSym(const SyntaxNode* node, std::unique_ptr<SymT>);
+    template <class SymT> SymT* pushSym(const SyntaxNode* node, SymT* sym);
     void popSym();
     using SymContT = std::stack<Symbol*>;
     SymContT syms_;
 
-    template <class TySymT> TySymT* pushTySym(std::unique_ptr<TySymT>);
+    template <class TySymT> TySymT* pushTySym(TySymT* tySym);
     void popTySym();
     using TySymContT = std::stack<TypeSymbol*>;
     TySymContT tySyms_;
 
     std::stack<FunctionTypeSymbol*> pendingFunTySyms_;
 
-    template <class SymT, class... SymTArgs> std::unique_ptr<SymT> makeSymOrTySym(SymTArgs... args);
+    /*
+     * The TypeSymbols under construction, which are discarded (along
+     * with the Binder) once canonicalized.
+     */
+    Arena tySymArena_;
+
+    template <class SymT, class... SymTArgs> SymT* makeSymOrTySym(Arena* arena, SymTArgs... args);
     template <class SymT, class... SymTArgs> void makeSymAndPushIt(const SyntaxNode* node, SymTArgs... arg);
     template <class SymT, class... SymTArgs> void makeTySymAndPushIt(SymTArgs... arg);
+    void makeTagTySymAndPushIt(TagSymbolName::TagChoice tagChoice, SyntaxToken tagTk);
 
     struct DiagnosticsReporter
     {
@@ -107,18 +120,18 @@ private:
     //--------------//
     // Declarations //
     //--------------//
-    virtual Action visitTranslationUnit(const TranslationUnitSyntax*) override;
-    virtual Action visitIncompleteDeclaration(const IncompleteDeclarationSyntax*) override;
-    virtual Action visitStaticAssertDeclaration(const StaticAssertDeclarationSyntax*) override;
+    Action visitTranslationUnit(const TranslationUnitSyntax*);
+    Action visitIncompleteDeclaration(const IncompleteDeclarationSyntax*);
+    Action visitStaticAssertDeclaration(const StaticAssertDeclarationSyntax*);
 
     template <class TyDeclT> Action visitTypeDeclaration_AtInternalDeclarations_COMMON(
             const TyDeclT* node,
             Action (Binder::*visit_DONE)(const TyDeclT*));
 
-    virtual Action visitStructOrUnionDeclaration(const StructOrUnionDeclarationSyntax*) override;
+    Action visitStructOrUnionDeclaration(const StructOrUnionDeclarationSyntax*);
     Action visitStructOrUnionDeclaration_AtSpecifier(const StructOrUnionDeclarationSyntax*);
     Action visitStructOrUnionDeclaration_DONE(const StructOrUnionDeclarationSyntax*);
-    virtual Action visitEnumDeclaration(const EnumDeclarationSyntax*) override;
+    Action visitEnumDeclaration(const EnumDeclarationSyntax*);
     Action visitEnumDeclaration_AtSpecifier(const EnumDeclarationSyntax*);
     Action visitEnumDeclaration_DONE(const EnumDeclarationSyntax*);
 
@@ -129,82 +142,85 @@ private:
             const DeclT* node,
             Action (Binder::*visit_DONE)(const DeclT*));
 
-    virtual Action visitVariableAndOrFunctionDeclaration(const VariableAndOrFunctionDeclarationSyntax*) override;
+    Action visitVariableAndOrFunctionDeclaration(const VariableAndOrFunctionDeclarationSyntax*);
     Action visitVariableAndOrFunctionDeclaration_AtSpecifiers(const VariableAndOrFunctionDeclarationSyntax*);
     Action visitVariableAndOrFunctionDeclaration_AtDeclarators(const VariableAndOrFunctionDeclarationSyntax*);
     Action visitVariableAndOrFunctionDeclaration_DONE(const VariableAndOrFunctionDeclarationSyntax*);
 
-    virtual Action visitFieldDeclaration(const FieldDeclarationSyntax*) override;
+    Action visitFieldDeclaration(const FieldDeclarationSyntax*);
     Action visitFieldDeclaration_AtSpecifiers(const FieldDeclarationSyntax*);
     Action visitFieldDeclaration_AtDeclarators(const FieldDeclarationSyntax*);
     Action visitFieldDeclaration_DONE(const FieldDeclarationSyntax*);
 
-    virtual Action visitEnumeratorDeclaration(const EnumeratorDeclarationSyntax*) override;
+    Action visitEnumeratorDeclaration(const EnumeratorDeclarationSyntax*);
     Action visitEnumeratorDeclaration_AtImplicitSpecifier(const EnumeratorDeclarationSyntax*);
     Action visitEnumeratorDeclaration_AtDeclarator(const EnumeratorDeclarationSyntax*);
     Action visitEnumeratorDeclaration_DONE(const EnumeratorDeclarationSyntax*);
 
-    virtual Action visitParameterDeclaration(const ParameterDeclarationSyntax*) override;
+    Action visitParameterDeclaration(const ParameterDeclarationSyntax*);
     Action visitParameterDeclaration_AtSpecifiers(const ParameterDeclarationSyntax*);
     Action visitParameterDeclaration_AtDeclarator(const ParameterDeclarationSyntax*);
     Action visitParameterDeclaration_DONE(const ParameterDeclarationSyntax*);
 
-    virtual Action visitFunctionDefinition(const FunctionDefinitionSyntax*) override;
+    Action visitFunctionDefinition(const FunctionDefinitionSyntax*);
     Action visitFunctionDefinition_AtSpecifiers(const FunctionDefinitionSyntax*);
     Action visitFunctionDefinition_AtDeclarator(const FunctionDefinitionSyntax*);
     Action visitFunctionDefinition_DONE(const FunctionDefinitionSyntax*);
 
     /* Specifiers */
-    virtual Action visitBuiltinTypeSpecifier(const BuiltinTypeSpecifierSyntax*) override;
-    virtual Action visitTagTypeSpecifier(const TagTypeSpecifierSyntax*) override;
-    virtual Action visitTypeDeclarationAsSpecifier(const TypeDeclarationAsSpecifierSyntax*) override;
-    virtual Action visitTypedefName(const TypedefNameSyntax*) override;
-    virtual Action visitTypeQualifier(const TypeQualifierSyntax*) override;
+    Action visitBuiltinTypeSpecifier(const BuiltinTypeSpecifierSyntax*);
+    Action visitTagTypeSpecifier(const TagTypeSpecifierSyntax*);
+    Action visitTypeDeclarationAsSpecifier(const TypeDeclarationAsSpecifierSyntax*);
+    Action visitTypedefName(const TypedefNameSyntax*);
+    Action visitTypeQualifier(const TypeQualifierSyntax*);
     Action visitIfNotTypeQualifier(const SpecifierSyntax*);
     Action visitIfTypeQualifier(const SpecifierSyntax*);
 
     /* Declarators */
-    virtual Action visitArrayOrFunctionDeclarator(const ArrayOrFunctionDeclaratorSyntax*) override;
-    virtual Action visitPointerDeclarator(const PointerDeclaratorSyntax*) override;
-    virtual Action visitParenthesizedDeclarator(const ParenthesizedDeclaratorSyntax*) override;
-    virtual Action visitSubscriptSuffix(const SubscriptSuffixSyntax*) override;
-    virtual Action visitParameterSuffix(const ParameterSuffixSyntax*) override;
-    virtual Action visitIdentifierDeclarator(const IdentifierDeclaratorSyntax*) override;
-    virtual Action visitAbstractDeclarator(const AbstractDeclaratorSyntax*) override;
+    Action visitArrayOrFunctionDeclarator(const ArrayOrFunctionDeclaratorSyntax*);
+    Action visitPointerDeclarator(const PointerDeclaratorSyntax*);
+    Action visitParenthesizedDeclarator(const ParenthesizedDeclaratorSyntax*);
+    Action visitSubscriptSuffix(const SubscriptSuffixSyntax*);
+    Action visitParameterSuffix(const ParameterSuffixSyntax*);
+    Action visitIdentifierDeclarator(const IdentifierDeclaratorSyntax*);
+    Action visitAbstractDeclarator(const AbstractDeclaratorSyntax*);
     Action nameSymAtTop(const char* s);
     Action typeSymAtTopAndPopIt();
+    void declareSymAtTopInScope(SyntaxToken identTk, NameSpaceKind nsK);
 
     template <class DecltrT> Action determineContextAndMakeSym(const DecltrT* node);
 
     //------------//
     // Statements //
     //------------//
-    virtual Action visitCompoundStatement(const CompoundStatementSyntax*) override;
-    virtual Action visitDeclarationStatement(const DeclarationStatementSyntax*) override;
+    Action visitCompoundStatement(const CompoundStatementSyntax*);
+    Action visitDeclarationStatement(const DeclarationStatementSyntax*);
 };
 
 template <class SymT, class... SymTArgs>
-std::unique_ptr<SymT> Binder::makeSymOrTySym(SymTArgs... args)
+SymT* Binder::makeSymOrTySym(Arena* arena, SymTArgs... args)
 {
-    std::unique_ptr<SymT> sym(new SymT(tree_,
-                                       scopes_.top(),
-                                       syms_.top(),
-                                       std::forward<SymTArgs>(args)...));
-    return sym;
+    return new (arena) SymT(arena,
+                            tree_,
+                            scopes_.top(),
+                            syms_.top(),
+                            std::forward<SymTArgs>(args)...);
 }
 
 template <class SymT, class... SymTArgs>
 void Binder::makeSymAndPushIt(const SyntaxNode* node, SymTArgs... args)
 {
-    std::unique_ptr<SymT> sym = makeSymOrTySym<SymT>(std::forward<SymTArgs>(args)...);
-    pushSym(node, std::move(sym));
+    SymT* sym = makeSymOrTySym<SymT>(symArena_,
+                                     std::forward<SymTArgs>(args)...);
+    pushSym(node, sym);
 }
 
 template <class SymT, class... SymTArgs>
 void Binder::makeTySymAndPushIt(SymTArgs... args)
 {
-    std::unique_ptr<SymT> sym = makeSymOrTySym<SymT>(std::forward<SymTArgs>(args)...);
-    pushTySym(std::move(sym));
+    SymT* sym = makeSymOrTySym<SymT>(&tySymArena_,
+                                     std::forward<SymTArgs>(args)...);
+    pushTySym(sym);
 }
 
 } // C
@@ -28,6 +28,7 @@
 #include "symbols/Symbol_ALL.h"
 #include "symbols/SymbolName_ALL.h"
 #include "syntax/SyntaxFacts.h"
+#include "syntax/SyntaxLexeme_ALL.h"
 #include "syntax/SyntaxNodes.h"
 #include "syntax/SyntaxUtilities.h"
 
@@ -57,6 +58,21 @@ SyntaxVisitor::Action Binder::nameSymAtTop(const char* s)
     return Action::Skip;
 }
 
+void Binder::declareSymAtTopInScope(SyntaxToken identTk, NameSpaceKind nsK)
+{
+    PSY_ASSERT(!syms_.empty(), return);
+    PSY_ASSERT(!scopes_.empty(), return);
+
+    auto lexeme = identTk.valueLexeme();
+    if (!lexeme || !lexeme->asIdentifier())
+        return;
+
+    auto ident = lexeme->asIdentifier();
+    if (scopes_.top() && nsK != NameSpaceKind::Members)
+        scopes_.top()->addSymbol(ident, nsK, syms_.top());
+    semaModel_->indexDeclaredSym(ident, nsK, syms_.top());
+}
+
 SyntaxVisitor::Action Binder::typeSymAtTopAndPopIt()
 {
     PSY_ASSERT(!syms_.empty(), return Action::Quit);
@@ -66,7 +82,7 @@ SyntaxVisitor::Action Binder::typeSymAtTopAndPopIt()
     PSY_ASSERT(typeableSym, return Action::Quit);
 
     PSY_ASSERT(!tySyms_.empty(), return Action::Quit);
-    auto tySym = tySyms_.top();
+    auto tySym = semaModel_->canonicalizeType(tySyms_.top());
 
     if (!pendingFunTySyms_.empty())
         pendingFunTySyms_.top()->addParameter(tySym);
@@ -124,6 +140,7 @@ SyntaxVisitor::Action Binder::visitEnumeratorDeclaration_AtDeclarator(const Enum
 {
     determineContextAndMakeSym(node);
     nameSymAtTop(node->identifierToken().valueText_c_str());
+    declareSymAtTopInScope(node->identifierToken(), NameSpaceKind::Ordinary);
     typeSymAtTopAndPopIt();
 
     return visitEnumeratorDeclaration_DONE(node);
@@ -148,8 +165,15 @@ SyntaxVisitor::Action Binder::visitFunctionDefinition_AtDeclarator(const Functio
     scopes_.top()->morphFrom_FunctionPrototype_to_Block();
 
     auto body = node->body()->asCompoundStatement();
-    for (auto stmtIt = body->statements(); stmtIt; stmtIt = stmtIt->next)
-        visit(stmtIt->value);
+    if (deferFuncBodies_) {
+        semaModel_->deferFunctionBody(body, scopes_.top(), syms_.top());
+    } else {
+        TySymContT tySyms;
+        std::swap(tySyms_, tySyms);
+        for (auto stmtIt = body->statements(); stmtIt; stmtIt = stmtIt->next)
+            visit(stmtIt->value);
+        std::swap(tySyms_, tySyms);
+    }
 
     closeScope();
 
@@ -355,6 +379,18 @@ SyntaxVisitor::Action Binder::visitIdentifierDeclarator(const IdentifierDeclarat
     determineContextAndMakeSym(node);
     nameSymAtTop(node->identifierToken().valueText_c_str());
 
+    /*
+     * 6.2.3-1
+     * The members of a structure or union have a name space of their
+     * own, for each structure or union (and not for each scope).
+     */
+    auto sym = syms_.top();
+    declareSymAtTopInScope(node->identifierToken(),
+                           sym->kind() == SymbolKind::Value
+                                   && sym->asValue()->valueKind() == ValueKind::Field
+                               ? NameSpaceKind::Members
+                               : NameSpaceKind::Ordinary);
+
     return Action::Skip;
 }
 
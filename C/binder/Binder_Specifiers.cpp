@@ -29,6 +29,7 @@
 #include "symbols/Symbol_ALL.h"
 #include "symbols/SymbolName_ALL.h"
 #include "syntax/SyntaxFacts.h"
+#include "syntax/SyntaxLexeme_ALL.h"
 #include "syntax/SyntaxNodes.h"
 #include "syntax/SyntaxUtilities.h"
 
@@ -73,6 +74,7 @@ SyntaxVisitor::Action Binder::visitStructOrUnionDeclaration_AtSpecifier(
     makeSymAndPushIt<NamedTypeSymbol>(node,
                                       tagChoice,
                                       tySpec->tagToken().valueText_c_str());
+    declareSymAtTopInScope(tySpec->tagToken(), NameSpaceKind::Tags);
 
     return visitTypeDeclaration_AtInternalDeclarations_COMMON(
                 node,
@@ -84,6 +86,7 @@ SyntaxVisitor::Action Binder::visitEnumDeclaration_AtSpecifier(const EnumDeclara
     makeSymAndPushIt<NamedTypeSymbol>(node,
                                       TagSymbolName::TagChoice::Enum,
                                       node->typeSpecifier()->tagToken().valueText_c_str());
+    declareSymAtTopInScope(node->typeSpecifier()->tagToken(), NameSpaceKind::Tags);
 
     return visitTypeDeclaration_AtInternalDeclarations_COMMON(
                 node,
@@ -241,7 +244,7 @@ SyntaxVisitor::Action Binder::visitTagTypeSpecifier(const TagTypeSpecifierSyntax
                 return Action::Quit;
         }
 
-        makeTySymAndPushIt<NamedTypeSymbol>(tagChoice, node->tagToken().valueText_c_str());
+        makeTagTySymAndPushIt(tagChoice, node->tagToken());
     }
 
     for (auto attrIt = node->attributes(); attrIt; attrIt = attrIt->next)
@@ -285,15 +288,26 @@ SyntaxVisitor::Action Binder::visitTypeDeclarationAsSpecifier(const TypeDeclarat
             PSY_ESCAPE_VIA_RETURN(Action::Quit);
     }
 
-    makeTySymAndPushIt<NamedTypeSymbol>(tagChoice, tySpec->tagToken().valueText_c_str());
+    makeTagTySymAndPushIt(tagChoice, tySpec->tagToken());
 
     return Action::Skip;
 }
 
 SyntaxVisitor::Action Binder::visitTypedefName(const TypedefNameSyntax* node)
 {
-    if (tySyms_.empty())
-        makeTySymAndPushIt<NamedTypeSymbol>(node->identifierToken().valueText_c_str());
+    if (!tySyms_.empty())
+        return Action::Skip;
+
+    makeTySymAndPushIt<NamedTypeSymbol>(node->identifierToken().valueText_c_str());
+
+    auto lexeme = node->identifierToken().valueLexeme();
+    if (!scopes_.top() || !lexeme || !lexeme->asIdentifier())
+        return Action::Skip;
+
+    // The synonym designates the type of the declarator of its typedef.
+    auto sym = scopes_.top()->searchForSymbol(lexeme->asIdentifier(), NameSpaceKind::Ordinary);
+    if (sym && sym->asValue() && sym->asValue()->type())
+        tySyms_.top()->asNamedType()->resolveSynonymTo(sym->asValue()->type());
 
     return Action::Skip;
 }
@@ -0,0 +1,80 @@
+
+
+#include "TypeChecker.h"
+
+#include "SyntaxTree.h"
+
+using namespace psy;
+using namespace C;
+
+void TypeChecker::DiagnosticsReporter::diagnose(DiagnosticDescriptor&& desc, SyntaxToken tk)
+{
+    tyChecker_->tree_->newDiagnostic(desc, tk);
+}
+
+const std::string TypeChecker::DiagnosticsReporter::ID_of_InvalidOperandsToBinaryOperator = "TypeChecker-001";
+const std::string TypeChecker::DiagnosticsReporter::ID_of_InvalidOperandToUnaryOperator = "TypeChecker-002";
+const std::string TypeChecker::DiagnosticsReporter::ID_of_ExpectedStructOrUnionOnMemberAccess = "TypeChecker-003";
+const std::string TypeChecker::DiagnosticsReporter::ID_of_CalledObjectIsNotFunction = "TypeChecker-004";
+const std::string TypeChecker::DiagnosticsReporter::ID_of_TooFewArgumentsToFunctionCall = "TypeChecker-005";
+const std::string TypeChecker::DiagnosticsReporter::ID_of_SubscriptedValueIsNotArrayOrPointer = "TypeChecker-006";
+
+void TypeChecker::DiagnosticsReporter::InvalidOperandsToBinaryOperator(SyntaxToken tk)
+{
+    diagnose(DiagnosticDescriptor(ID_of_InvalidOperandsToBinaryOperator,
+                                  "[[invalid operands to binary operator]]",
+                                  "invalid operands to binary `" + tk.valueText() + "'",
+                                  DiagnosticSeverity::Error,
+                                  DiagnosticCategory::Typing),
+             tk);
+}
+
+void TypeChecker::DiagnosticsReporter::InvalidOperandToUnaryOperator(SyntaxToken tk)
+{
+    diagnose(DiagnosticDescriptor(ID_of_InvalidOperandToUnaryOperator,
+                                  "[[invalid operand to unary operator]]",
+                                  "invalid argument type to unary `" + tk.valueText() + "'",
+                                  DiagnosticSeverity::Error,
+                                  DiagnosticCategory::Typing),
+             tk);
+}
+
+void TypeChecker::DiagnosticsReporter::ExpectedStructOrUnionOnMemberAccess(SyntaxToken tk)
+{
+    diagnose(DiagnosticDescriptor(ID_of_ExpectedStructOrUnionOnMemberAccess,
+                                  "[[member access into non-struct/union]]",
+                                  "member reference base type is not a structure or union",
+                                  DiagnosticSeverity::Error,
+                                  DiagnosticCategory::Typing),
+             tk);
+}
+
+void TypeChecker::DiagnosticsReporter::CalledObjectIsNotFunction(SyntaxToken tk)
+{
+    diagnose(DiagnosticDescriptor(ID_of_CalledObjectIsNotFunction,
+                                  "[[called object is not a function]]",
+                                  "called object is not a function or function pointer",
+                                  DiagnosticSeverity::Error,
+                                  DiagnosticCategory::Typing),
+             tk);
+}
+
+void TypeChecker::DiagnosticsReporter::TooFewArgumentsToFunctionCall(SyntaxToken tk)
+{
+    diagnose(DiagnosticDescriptor(ID_of_TooFewArgumentsToFunctionCall,
+                                  "[[too few arguments to function call]]",
+                                  "too few arguments to function call",
+                                  DiagnosticSeverity::Error,
+                                  DiagnosticCategory::Typing),
+             tk);
+}
+
+void TypeChecker::DiagnosticsReporter::SubscriptedValueIsNotArrayOrPointer(SyntaxToken tk)
+{
+    diagnose(DiagnosticDescriptor(ID_of_SubscriptedValueIsNotArrayOrPointer,
+                                  "[[subscripted value is not array or pointer]]",
+                                  "subscripted value is not an array or pointer",
+                                  DiagnosticSeverity::Error,
+                                  DiagnosticCategory::Typing),
+             tk);
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2021/22 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "NameSpace.h"
+
+#include "infra/MemoryPool.h"
+
+#include <cstdint>
+#include <cstring>
+
+using namespace psy;
+using namespace C;
+
+namespace {
+
+const std::size_t kInitialCapacity = 8;
+
+} // anonymous
+
+NameSpace::NameSpace(NameSpaceKind nsK, MemoryPool* pool)
+    : nsK_(nsK)
+    , pool_(pool)
+    , slots_(nullptr)
+    , capacity_(0)
+    , size_(0)
+{}
+
+NameSpace::Slot* NameSpace::allocateSlots(std::size_t capacity)
+{
+    auto slots = static_cast<Slot*>(pool_->allocate(sizeof(Slot) * capacity));
+    std::memset(slots, 0, sizeof(Slot) * capacity);
+    return slots;
+}
+
+/*
+ * Open addressing with linear probing: the slot of the identifier,
+ * or else the empty slot where it would be placed.
+ */
+NameSpace::Slot* NameSpace::probe(const Identifier* ident) const
+{
+    auto h = reinterpret_cast<std::uintptr_t>(ident);
+    h = (h >> 3) * 0x9E3779B97F4A7C15ull;
+    auto mask = capacity_ - 1;
+    for (auto idx = (h >> 16) & mask; ; idx = (idx + 1) & mask) {
+        Slot* slot = &slots_[idx];
+        if (!slot->ident_ || slot->ident_ == ident)
+            return slot;
+    }
+}
+
+const Symbol* NameSpace::searchForSymbol(const Identifier* ident) const
+{
+    if (!size_ || !ident)
+        return nullptr;
+
+    return probe(ident)->sym_;
+}
+
+void NameSpace::insert(const Identifier* ident, Symbol* sym)
+{
+    if (!ident)
+        return;
+
+    if ((size_ + 1) * 4 > capacity_ * 3) {
+        auto oldSlots = slots_;
+        auto oldCapacity = capacity_;
+        capacity_ = capacity_ ? capacity_ * 2 : kInitialCapacity;
+        slots_ = allocateSlots(capacity_);
+        for (std::size_t i = 0; i < oldCapacity; ++i) {
+            if (oldSlots[i].ident_)
+                *probe(oldSlots[i].ident_) = oldSlots[i];
+        }
+    }
+
+    Slot* slot = probe(ident);
+    if (!slot->ident_) {
+        slot->ident_ = ident;
+        ++size_;
+    }
+    slot->sym_ = sym;
+}
+
+/*
+ * Replace every identifier by the one it's remapped to (e.g., the
+ * identifier with the same spelling in another SyntaxTree); an entry
+ * whose identifier is remapped to null is removed.
+ */
+void NameSpace::rekey(const IdentifierRemap& remap)
+{
+    if (!size_)
+        return;
+
+    auto oldSlots = slots_;
+    slots_ = allocateSlots(capacity_);
+    size_ = 0;
+    for (std::size_t i = 0; i < capacity_; ++i) {
+        if (!oldSlots[i].ident_)
+            continue;
+        auto ident = remap(oldSlots[i].ident_, oldSlots[i].sym_);
+        if (!ident)
+            continue;
+        Slot* slot = probe(ident);
+        if (!slot->ident_)
+            ++size_;
+        slot->ident_ = ident;
+        slot->sym_ = oldSlots[i].sym_;
+    }
+}
@@ -25,18 +25,25 @@
 #include "Fwds.h"
 
 #include "binder/NameSpaceKind.h"
+#include "infra/Managed.h"
 
 #include "../common/infra/InternalAccess.h"
 
+#include <cstddef>
+#include <functional>
+
 namespace psy {
 namespace C {
 
 /**
  * \brief The NameSpace class.
  *
+ * The identifiers of a NameSpace, within a Scope, and the Symbols they
+ * designate.
+ *
  * \remark 6.2.3
  */
-class PSY_C_API NameSpace
+class PSY_C_API NameSpace final : public Managed
 {
 public:
     /**
@@ -44,13 +51,44 @@ public:
      */
     NameSpaceKind kind() const { return  nsK_; }
 
+    /**
+     * The Symbol designated by Identifier \p ident in \c this NameSpace,
+     * if one exists (an enclosing Scope is not searched).
+     *
+     * \see Scope::searchForSymbol
+     */
+    const Symbol* searchForSymbol(const Identifier* ident) const;
+
+    /**
+     * The number of identifiers in \c this NameSpace.
+     */
+    std::size_t size() const { return size_; }
+
 PSY_INTERNAL_AND_RESTRICTED:
-    NameSpace(NameSpaceKind nsK)
-        : nsK_(nsK)
-    {}
+    PSY_GRANT_ACCESS(Scope);
+
+    NameSpace(NameSpaceKind nsK, MemoryPool* pool);
+
+    void insert(const Identifier* ident, Symbol* sym);
+
+    using IdentifierRemap = std::function<const Identifier* (const Identifier*, const Symbol*)>;
+    void rekey(const IdentifierRemap& remap);
 
 private:
+    struct Slot
+    {
+        const Identifier* ident_;
+        Symbol* sym_;
+    };
+
     NameSpaceKind nsK_;
+    MemoryPool* pool_;
+    Slot* slots_;
+    std::size_t capacity_;
+    std::size_t size_;
+
+    Slot* allocateSlots(std::size_t capacity);
+    Slot* probe(const Identifier* ident) const;
 };
 
 } // C
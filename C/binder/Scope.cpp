@@ -20,13 +20,31 @@
 
 #include "Scope.h"
 
+#include "binder/NameSpace.h"
+#include "symbols/Symbol.h"
+
 #include "../common/infra/Assertions.h"
 
 using namespace psy;
 using namespace C;
 
-Scope::Scope(ScopeKind kind)
+namespace {
+
+std::uint8_t indexOf(NameSpaceKind nsK)
+{
+    return static_cast<std::uint8_t>(nsK) - static_cast<std::uint8_t>(NameSpaceKind::Labels);
+}
+
+} // anonymous
+
+Scope::Scope(ScopeKind kind, MemoryPool* pool)
     : kind_(kind)
+    , pool_(pool)
+    , outerScope_(nullptr)
+    , firstEnclosedScope_(nullptr)
+    , lastEnclosedScope_(nullptr)
+    , nextSiblingScope_(nullptr)
+    , nameSpaces_{ nullptr, nullptr, nullptr, nullptr }
 {}
 
 ScopeKind Scope::kind() const
@@ -34,9 +52,41 @@ ScopeKind Scope::kind() const
     return kind_;
 }
 
-void Scope::enclose(std::unique_ptr<Scope> scope)
+const Scope* Scope::outerScope() const
 {
-    enclosedScopes_.push_back(std::move(scope));
+    return outerScope_;
+}
+
+const NameSpace* Scope::nameSpace(NameSpaceKind nsK) const
+{
+    PSY_ASSERT(nsK != NameSpaceKind::UNSPECIFIED, return nullptr);
+
+    return nameSpaces_[indexOf(nsK)];
+}
+
+const Symbol* Scope::searchForSymbol(const Identifier* ident, NameSpaceKind nsK) const
+{
+    PSY_ASSERT(nsK != NameSpaceKind::UNSPECIFIED, return nullptr);
+
+    auto idx = indexOf(nsK);
+    for (auto scope = this; scope; scope = scope->outerScope_) {
+        auto ns = scope->nameSpaces_[idx];
+        if (!ns)
+            continue;
+        if (auto sym = ns->searchForSymbol(ident))
+            return sym;
+    }
+    return nullptr;
+}
+
+void Scope::enclose(Scope* scope)
+{
+    scope->outerScope_ = this;
+    if (lastEnclosedScope_)
+        lastEnclosedScope_->nextSiblingScope_ = scope;
+    else
+        firstEnclosedScope_ = scope;
+    lastEnclosedScope_ = scope;
 }
 
 void Scope::morphFrom_FunctionPrototype_to_Block()
@@ -46,5 +96,50 @@ void Scope::morphFrom_FunctionPrototype_to_Block()
     kind_ = ScopeKind::Block;
 }
 
-Scope::~Scope()
-{}
+void Scope::addSymbol(const Identifier* ident, NameSpaceKind nsK, Symbol* sym)
+{
+    PSY_ASSERT(nsK != NameSpaceKind::UNSPECIFIED, return);
+
+    auto& ns = nameSpaces_[indexOf(nsK)];
+    if (!ns)
+        ns = new (pool_) NameSpace(nsK, pool_);
+    ns->insert(ident, sym);
+    sym->setNameSpace(ns);
+}
+
+/*
+ * Rekey the identifiers of this scope and, recursively, of its enclosed
+ * scopes.
+ */
+void Scope::rekeyIdentifiers(const NameSpace::IdentifierRemap& remap)
+{
+    for (auto ns : nameSpaces_) {
+        if (ns)
+            ns->rekey(remap);
+    }
+
+    for (auto scope = firstEnclosedScope_; scope; scope = scope->nextSiblingScope_)
+        scope->rekeyIdentifiers(remap);
+}
+
+void Scope::detachEnclosedScopes(const std::function<bool (const Scope*)>& pred)
+{
+    Scope* lastKept = nullptr;
+    for (auto scope = firstEnclosedScope_; scope; scope = scope->nextSiblingScope_) {
+        if (pred(scope)) {
+            scope->outerScope_ = nullptr;
+            continue;
+        }
+        if (lastKept)
+            lastKept->nextSiblingScope_ = scope;
+        else
+            firstEnclosedScope_ = scope;
+        lastKept = scope;
+    }
+
+    if (lastKept)
+        lastKept->nextSiblingScope_ = nullptr;
+    else
+        firstEnclosedScope_ = nullptr;
+    lastEnclosedScope_ = lastKept;
+}
@@ -24,14 +24,16 @@
 #include "API.h"
 #include "Fwds.h"
 
+#include "NameSpace.h"
+#include "NameSpaceKind.h"
 #include "ScopeKind.h"
 
+#include "infra/Managed.h"
+
 #include "../common/infra/InternalAccess.h"
 
-#include <memory>
 #include <cstdint>
-#include <unordered_map>
-#include <vector>
+#include <functional>
 
 namespace psy {
 namespace C {
@@ -41,27 +43,57 @@ namespace C {
  *
  * \remark 6.2.1
  */
-class PSY_C_API Scope
+class PSY_C_API Scope final : public Managed
 {
 public:
-    virtual ~Scope();
-
     /**
      * The Kind of \c this Scope.
      */
     ScopeKind kind() const;
 
+    /**
+     * The Scope that encloses \c this Scope (if one exists).
+     */
+    const Scope* outerScope() const;
+
+    /**
+     * The NameSpace of NameSpaceKind \p nsK in \c this Scope (if any
+     * identifier was declared in it).
+     */
+    const NameSpace* nameSpace(NameSpaceKind nsK) const;
+
+    /**
+     * The Symbol designated by Identifier \p ident in NameSpaceKind
+     * \p nsK, searched from \c this Scope outward.
+     *
+     * \remark 6.2.1-4
+     */
+    const Symbol* searchForSymbol(const Identifier* ident, NameSpaceKind nsK) const;
+
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(Binder);
+    PSY_GRANT_ACCESS(SemanticModel);
 
-    Scope(ScopeKind kind);
+    Scope(ScopeKind kind, MemoryPool* pool);
 
-    void enclose(std::unique_ptr<Scope> scope);
+    void enclose(Scope* scope);
     void morphFrom_FunctionPrototype_to_Block();
 
+    void addSymbol(const Identifier* ident, NameSpaceKind nsK, Symbol* sym);
+
+    void rekeyIdentifiers(const NameSpace::IdentifierRemap& remap);
+    void detachEnclosedScopes(const std::function<bool (const Scope*)>& pred);
+
 private:
     ScopeKind kind_;
-    std::vector<std::unique_ptr<Scope>> enclosedScopes_;
+    MemoryPool* pool_;
+    Scope* outerScope_;
+    Scope* firstEnclosedScope_;
+    Scope* lastEnclosedScope_;
+    Scope* nextSiblingScope_;
+
+    static constexpr std::uint8_t kNameSpaceCount = 4;
+    NameSpace* nameSpaces_[kNameSpaceCount];
 };
 
 } // C
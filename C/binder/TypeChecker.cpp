@@ -19,3 +19,799 @@
 // THE SOFTWARE.
 
 #include "TypeChecker.h"
+
+#include "SyntaxTree.h"
+
+#include "binder/Scope.h"
+#include "compilation/SemanticModel.h"
+#include "compilation/TypeInterner.h"
+#include "symbols/Symbol_ALL.h"
+#include "symbols/SymbolName_ALL.h"
+#include "syntax/SyntaxLexeme_ALL.h"
+#include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxUtilities.h"
+
+#include "../common/infra/Assertions.h"
+
+#include <algorithm>
+
+using namespace psy;
+using namespace C;
+
+TypeChecker::TypeChecker(SemanticModel* semaModel, const SyntaxTree* tree)
+    : StaticSyntaxVisitor(tree)
+    , semaModel_(semaModel)
+    , tyInterner_(semaModel->typeInterner())
+    , tyUses_(semaModel->typeUses())
+    , outerScope_(nullptr)
+    , collectParms_(false)
+    , tySym_(nullptr)
+    , builtinTySyms_{}
+    , diagReporter_(this)
+{}
+
+void TypeChecker::typeCheck(const Scope* fileScope)
+{
+    auto TU = tree_->translationUnitRoot();
+    if (!TU)
+        return;
+
+    outerScope_ = fileScope;
+    for (auto declIt = TU->declarations(); declIt; declIt = declIt->next)
+        visit(declIt->value);
+}
+
+/*
+ * Type check the (deferred) body of a function, within the function's block scope.
+ */
+void TypeChecker::typeCheckFunctionBody(const CompoundStatementSyntax* body, const Scope* scope)
+{
+    outerScope_ = scope;
+
+    openBlock();
+    for (auto stmtIt = body->statements(); stmtIt; stmtIt = stmtIt->next)
+        visit(stmtIt->value);
+    closeBlock();
+}
+
+void TypeChecker::openBlock()
+{
+    blocks_.push_back(declaredNames_.size());
+}
+
+void TypeChecker::closeBlock()
+{
+    PSY_ASSERT(!blocks_.empty(), return);
+
+    auto mark = blocks_.back();
+    blocks_.pop_back();
+    while (declaredNames_.size() > mark) {
+        const auto& [ident, nsK] = declaredNames_.back();
+        auto& names = nsK == NameSpaceKind::Tags ? tags_ : names_;
+        names[ident].pop_back();
+        declaredNames_.pop_back();
+    }
+}
+
+void TypeChecker::declare(SyntaxToken identTk, const Symbol* sym)
+{
+    declare_(identTk, NameSpaceKind::Ordinary, sym);
+}
+
+void TypeChecker::declareTag(SyntaxToken tagTk, const Symbol* sym)
+{
+    declare_(tagTk, NameSpaceKind::Tags, sym);
+}
+
+/*
+ * Names declared outside any block are those of the file scope, which
+ * the lookup falls back to.
+ */
+void TypeChecker::declare_(SyntaxToken identTk, NameSpaceKind nsK, const Symbol* sym)
+{
+    if (blocks_.empty() || !sym || !identTk.valueLexeme())
+        return;
+
+    auto ident = identTk.valueLexeme()->asIdentifier();
+    if (!ident)
+        return;
+
+    auto& names = nsK == NameSpaceKind::Tags ? tags_ : names_;
+    names[ident].push_back(sym);
+    declaredNames_.emplace_back(ident, nsK);
+}
+
+const Symbol* TypeChecker::lookup(SyntaxToken identTk) const
+{
+    if (!identTk.valueLexeme())
+        return nullptr;
+
+    auto ident = identTk.valueLexeme()->asIdentifier();
+    if (!ident)
+        return nullptr;
+
+    auto it = names_.find(ident);
+    if (it != names_.end() && !it->second.empty())
+        return it->second.back();
+
+    return outerScope_ ? outerScope_->searchForSymbol(ident, NameSpaceKind::Ordinary)
+                       : nullptr;
+}
+
+const Symbol* TypeChecker::lookupTag(SyntaxToken tagTk) const
+{
+    if (!tagTk.valueLexeme())
+        return nullptr;
+
+    auto ident = tagTk.valueLexeme()->asIdentifier();
+    if (!ident)
+        return nullptr;
+
+    auto it = tags_.find(ident);
+    if (it != tags_.end() && !it->second.empty())
+        return it->second.back();
+
+    return outerScope_ ? outerScope_->searchForSymbol(ident, NameSpaceKind::Tags)
+                       : nullptr;
+}
+
+namespace {
+
+const IdentifierDeclaratorSyntax* identifierDeclaratorOf(const DeclaratorSyntax* decltor)
+{
+    while (decltor) {
+        decltor = SyntaxUtilities::strippedDeclaratorOrSelf(decltor);
+        if (!decltor)
+            break;
+        if (auto identDecltor = decltor->asIdentifierDeclarator())
+            return identDecltor;
+
+        auto innerDecltor = SyntaxUtilities::innerDeclaratorOrSelf(decltor);
+        if (innerDecltor == decltor)
+            break;
+        decltor = innerDecltor;
+    }
+    return nullptr;
+}
+
+} // anonymous
+
+//--------------//
+// Declarations //
+//--------------//
+
+SyntaxVisitor::Action TypeChecker::visitStructOrUnionDeclaration(const StructOrUnionDeclarationSyntax* node)
+{
+    declareTag(node->typeSpecifier()->tagToken(), semaModel_->storedDeclaredSym(node));
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeChecker::visitEnumDeclaration(const EnumDeclarationSyntax* node)
+{
+    declareTag(node->typeSpecifier()->tagToken(), semaModel_->storedDeclaredSym(node));
+
+    for (auto declIt = node->typeSpecifier()->declarations(); declIt; declIt = declIt->next)
+        visit(declIt->value);
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeChecker::visitEnumeratorDeclaration(const EnumeratorDeclarationSyntax* node)
+{
+    check(node->expression());
+    declare(node->identifierToken(), semaModel_->storedDeclaredSym(node));
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeChecker::visitVariableAndOrFunctionDeclaration(
+        const VariableAndOrFunctionDeclarationSyntax* node)
+{
+    for (auto specIt = node->specifiers(); specIt; specIt = specIt->next)
+        visit(specIt->value);
+
+    for (auto decltorIt = node->declarators(); decltorIt; decltorIt = decltorIt->next) {
+        auto identDecltor = identifierDeclaratorOf(decltorIt->value);
+        if (identDecltor) {
+            declare(identDecltor->identifierToken(),
+                    semaModel_->storedDeclaredSym(identDecltor));
+        }
+        visit(decltorIt->value);
+    }
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeChecker::visitFieldDeclaration(const FieldDeclarationSyntax*)
+{
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeChecker::visitFunctionDefinition(const FunctionDefinitionSyntax* node)
+{
+    for (auto specIt = node->specifiers(); specIt; specIt = specIt->next)
+        visit(specIt->value);
+
+    auto identDecltor = identifierDeclaratorOf(node->declarator());
+    if (identDecltor) {
+        declare(identDecltor->identifierToken(),
+                semaModel_->storedDeclaredSym(identDecltor));
+    }
+
+    openBlock();
+
+    collectParms_ = true;
+    visit(node->declarator());
+    collectParms_ = false;
+
+    auto body = node->body() ? node->body()->asCompoundStatement() : nullptr;
+    // A deferred function body is type checked once bound.
+    if (body && !semaModel_->isFunctionBodyDeferred(body)) {
+        for (auto stmtIt = body->statements(); stmtIt; stmtIt = stmtIt->next)
+            visit(stmtIt->value);
+    }
+
+    closeBlock();
+
+    return Action::Skip;
+}
+
+/* Declarators */
+
+SyntaxVisitor::Action TypeChecker::visitParameterSuffix(const ParameterSuffixSyntax* node)
+{
+    if (!collectParms_)
+        return Action::Skip;
+    collectParms_ = false;
+
+    for (auto parmIt = node->parameters(); parmIt; parmIt = parmIt->next) {
+        auto identDecltor = identifierDeclaratorOf(parmIt->value->declarator());
+        if (identDecltor) {
+            declare(identDecltor->identifierToken(),
+                    semaModel_->storedDeclaredSym(identDecltor));
+        }
+    }
+
+    return Action::Skip;
+}
+
+//------------//
+// Statements //
+//------------//
+
+SyntaxVisitor::Action TypeChecker::visitCompoundStatement(const CompoundStatementSyntax* node)
+{
+    openBlock();
+    for (auto stmtIt = node->statements(); stmtIt; stmtIt = stmtIt->next)
+        visit(stmtIt->value);
+    closeBlock();
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeChecker::visitForStatement(const ForStatementSyntax* node)
+{
+    openBlock();
+    visit(node->initializer());
+    check(node->condition());
+    check(node->expression());
+    visit(node->statement());
+    closeBlock();
+
+    return Action::Skip;
+}
+
+//--------//
+// Common //
+//--------//
+
+SyntaxVisitor::Action TypeChecker::visitTypeName(const TypeNameSyntax*)
+{
+    return Action::Skip;
+}
+
+//-------//
+// Types //
+//-------//
+
+const TypeSymbol* TypeChecker::builtinType(BuiltinTypeKind builtTyK)
+{
+    auto& tySym = builtinTySyms_[static_cast<std::size_t>(builtTyK)];
+    if (!tySym)
+        tySym = tyInterner_->builtinType(builtTyK, tyUses_);
+    return tySym;
+}
+
+const TypeSymbol* TypeChecker::pointerType(const TypeSymbol* tySym)
+{
+    auto& ptrTySym = ptrTySyms_[tySym];
+    if (!ptrTySym)
+        ptrTySym = tyInterner_->pointerType(tySym, tyUses_);
+    return ptrTySym;
+}
+
+const TypeSymbol* TypeChecker::arrayType(const TypeSymbol* tySym)
+{
+    auto& arrTySym = arrTySyms_[tySym];
+    if (!arrTySym)
+        arrTySym = tyInterner_->arrayType(tySym, tyUses_);
+    return arrTySym;
+}
+
+/*
+ * The types of symbols (and those derived from them) are canonical: only
+ * a qualified one must be looked up.
+ */
+const TypeSymbol* TypeChecker::unqualifiedType(const TypeSymbol* tySym)
+{
+    if (!(tySym->isConstQualified()
+            || tySym->isVolatileQualified()
+            || tySym->isRestrictQualified())) {
+        return tySym;
+    }
+    return tyInterner_->unqualifiedType(tySym, tyUses_);
+}
+
+/*
+ * The type of a synonym is that of the declaration of its typedef, as
+ * resolved (by the Binder) where the synonym is used in a declaration; a
+ * lookup of its name here could find a declaration that shadows it.
+ */
+const TypeSymbol* TypeChecker::resolved(const TypeSymbol* tySym) const
+{
+    for (auto cnt = 0; tySym && cnt < 16; ++cnt) {
+        auto namedTySym = tySym->asNamedType();
+        if (!namedTySym || namedTySym->namedTypeKind() != NamedTypeKind::Synonym)
+            return tySym;
+
+        tySym = namedTySym->resolvedSynonym();
+    }
+    return nullptr;
+}
+
+TypeChecker::Category TypeChecker::categoryOf(const TypeSymbol* tySym) const
+{
+    tySym = resolved(tySym);
+    if (!tySym)
+        return Category::Unknown;
+
+    switch (tySym->typeKind()) {
+        case TypeKind::Array:
+            return Category::Array;
+
+        case TypeKind::Function:
+            return Category::Function;
+
+        case TypeKind::Pointer:
+            return Category::Pointer;
+
+        case TypeKind::Named: {
+            auto namedTySym = tySym->asNamedType();
+            switch (namedTySym->namedTypeKind()) {
+                case NamedTypeKind::Builtin:
+                    switch (namedTySym->builtinTypeKind()) {
+                        case BuiltinTypeKind::UNSPECIFIED:
+                            return Category::Unknown;
+
+                        case BuiltinTypeKind::Void:
+                            return Category::Void;
+
+                        case BuiltinTypeKind::Float:
+                        case BuiltinTypeKind::Double:
+                        case BuiltinTypeKind::LongDouble:
+                        case BuiltinTypeKind::FloatComplex:
+                        case BuiltinTypeKind::DoubleComplex:
+                        case BuiltinTypeKind::LongDoubleComplex:
+                            return Category::Floating;
+
+                        default:
+                            return Category::Integer;
+                    }
+
+                case NamedTypeKind::Structure:
+                case NamedTypeKind::Union:
+                    return Category::StructOrUnion;
+
+                case NamedTypeKind::Enumeration:
+                    return Category::Integer;
+
+                default:
+                    return Category::Unknown;
+            }
+        }
+
+        default:
+            return Category::Unknown;
+    }
+}
+
+/*
+ * The BuiltinTypeKind of an arithmetic type; that of an enumeration
+ * is \c int (6.7.2.2-4, implementation-defined).
+ */
+BuiltinTypeKind TypeChecker::builtinTypeKindOf(const TypeSymbol* tySym) const
+{
+    tySym = resolved(tySym);
+    if (!tySym || !tySym->asNamedType())
+        return BuiltinTypeKind::UNSPECIFIED;
+
+    auto namedTySym = tySym->asNamedType();
+    switch (namedTySym->namedTypeKind()) {
+        case NamedTypeKind::Builtin:
+            return namedTySym->builtinTypeKind();
+
+        case NamedTypeKind::Enumeration:
+            return BuiltinTypeKind::Int;
+
+        default:
+            return BuiltinTypeKind::UNSPECIFIED;
+    }
+}
+
+/*
+ * The type of the value of an lvalue of the given type.
+ *
+ * \remark 6.3.2.1-2, 6.3.2.1-3, and 6.3.2.1-4
+ */
+const TypeSymbol* TypeChecker::valueOf(const TypeSymbol* tySym)
+{
+    if (!tySym)
+        return nullptr;
+
+    switch (categoryOf(tySym)) {
+        case Category::Array:
+            return pointerType(resolved(tySym)->asArrayType()->elementType());
+
+        case Category::Function:
+            return pointerType(resolved(tySym));
+
+        default:
+            return unqualifiedType(tySym);
+    }
+}
+
+namespace {
+
+/*
+ * The integer conversion rank (6.3.1.1-1) and the size, per LP64.
+ */
+int rankOf(BuiltinTypeKind builtTyK)
+{
+    switch (builtTyK) {
+        case BuiltinTypeKind::Bool:
+            return 1;
+        case BuiltinTypeKind::Char:
+        case BuiltinTypeKind::Char_S:
+        case BuiltinTypeKind::Char_U:
+            return 2;
+        case BuiltinTypeKind::Short:
+        case BuiltinTypeKind::Short_S:
+        case BuiltinTypeKind::Short_U:
+            return 3;
+        case BuiltinTypeKind::Int:
+        case BuiltinTypeKind::Int_S:
+        case BuiltinTypeKind::Int_U:
+            return 4;
+        case BuiltinTypeKind::Long:
+        case BuiltinTypeKind::Long_S:
+        case BuiltinTypeKind::Long_U:
+            return 5;
+        case BuiltinTypeKind::LongLong:
+        case BuiltinTypeKind::LongLong_S:
+        case BuiltinTypeKind::LongLong_U:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+int sizeOf(BuiltinTypeKind builtTyK)
+{
+    switch (rankOf(builtTyK)) {
+        case 1:
+        case 2:
+            return 1;
+        case 3:
+            return 2;
+        case 4:
+            return 4;
+        default:
+            return 8;
+    }
+}
+
+bool isUnsigned(BuiltinTypeKind builtTyK)
+{
+    switch (builtTyK) {
+        case BuiltinTypeKind::Char_U:
+        case BuiltinTypeKind::Short_U:
+        case BuiltinTypeKind::Int_U:
+        case BuiltinTypeKind::Long_U:
+        case BuiltinTypeKind::LongLong_U:
+            return true;
+        default:
+            return false;
+    }
+}
+
+BuiltinTypeKind unsignedOf(BuiltinTypeKind builtTyK)
+{
+    switch (rankOf(builtTyK)) {
+        case 5:
+            return BuiltinTypeKind::Long_U;
+        case 6:
+            return BuiltinTypeKind::LongLong_U;
+        default:
+            return BuiltinTypeKind::Int_U;
+    }
+}
+
+/*
+ * The spelling-independent BuiltinTypeKind (e.g., \c signed \c int is \c int).
+ */
+BuiltinTypeKind normalized(BuiltinTypeKind builtTyK)
+{
+    switch (builtTyK) {
+        case BuiltinTypeKind::Short_S:
+            return BuiltinTypeKind::Short;
+        case BuiltinTypeKind::Int_S:
+            return BuiltinTypeKind::Int;
+        case BuiltinTypeKind::Long_S:
+            return BuiltinTypeKind::Long;
+        case BuiltinTypeKind::LongLong_S:
+            return BuiltinTypeKind::LongLong;
+        default:
+            return builtTyK;
+    }
+}
+
+/*
+ * The rank of a real floating type, or of the real type corresponding
+ * to a complex type (6.3.1.8-1).
+ */
+int floatingRankOf(BuiltinTypeKind builtTyK)
+{
+    switch (builtTyK) {
+        case BuiltinTypeKind::Float:
+        case BuiltinTypeKind::FloatComplex:
+            return 1;
+        case BuiltinTypeKind::Double:
+        case BuiltinTypeKind::DoubleComplex:
+            return 2;
+        case BuiltinTypeKind::LongDouble:
+        case BuiltinTypeKind::LongDoubleComplex:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+bool isComplex(BuiltinTypeKind builtTyK)
+{
+    return builtTyK == BuiltinTypeKind::FloatComplex
+            || builtTyK == BuiltinTypeKind::DoubleComplex
+            || builtTyK == BuiltinTypeKind::LongDoubleComplex;
+}
+
+} // anonymous
+
+/*
+ * \remark 6.3.1.1-2
+ */
+const TypeSymbol* TypeChecker::promoted(const TypeSymbol* tySym)
+{
+    auto builtTyK = builtinTypeKindOf(tySym);
+    if (builtTyK == BuiltinTypeKind::UNSPECIFIED || floatingRankOf(builtTyK))
+        return tySym ? valueOf(tySym) : nullptr;
+
+    if (rankOf(builtTyK) < rankOf(BuiltinTypeKind::Int))
+        return builtinType(BuiltinTypeKind::Int);
+    return builtinType(normalized(builtTyK));
+}
+
+/*
+ * \remark 6.3.1.8
+ */
+const TypeSymbol* TypeChecker::usualArithmeticConversions(const TypeSymbol* tySym1,
+                                                          const TypeSymbol* tySym2)
+{
+    auto builtTyK1 = builtinTypeKindOf(tySym1);
+    auto builtTyK2 = builtinTypeKindOf(tySym2);
+    if (builtTyK1 == BuiltinTypeKind::UNSPECIFIED || builtTyK2 == BuiltinTypeKind::UNSPECIFIED)
+        return nullptr;
+
+    auto floatRank = std::max(floatingRankOf(builtTyK1), floatingRankOf(builtTyK2));
+    if (floatRank) {
+        static const BuiltinTypeKind reals[] = { BuiltinTypeKind::Float,
+                                                 BuiltinTypeKind::Double,
+                                                 BuiltinTypeKind::LongDouble };
+        static const BuiltinTypeKind complexes[] = { BuiltinTypeKind::FloatComplex,
+                                                     BuiltinTypeKind::DoubleComplex,
+                                                     BuiltinTypeKind::LongDoubleComplex };
+        return builtinType(isComplex(builtTyK1) || isComplex(builtTyK2)
+                                            ? complexes[floatRank - 1]
+                                            : reals[floatRank - 1]);
+    }
+
+    builtTyK1 = rankOf(builtTyK1) < rankOf(BuiltinTypeKind::Int)
+            ? BuiltinTypeKind::Int
+            : normalized(builtTyK1);
+    builtTyK2 = rankOf(builtTyK2) < rankOf(BuiltinTypeKind::Int)
+            ? BuiltinTypeKind::Int
+            : normalized(builtTyK2);
+
+    if (builtTyK1 == builtTyK2)
+        return builtinType(builtTyK1);
+
+    if (isUnsigned(builtTyK1) == isUnsigned(builtTyK2)) {
+        return builtinType(rankOf(builtTyK1) > rankOf(builtTyK2)
+                                            ? builtTyK1
+                                            : builtTyK2);
+    }
+
+    auto unsignedTyK = isUnsigned(builtTyK1) ? builtTyK1 : builtTyK2;
+    auto signedTyK = isUnsigned(builtTyK1) ? builtTyK2 : builtTyK1;
+    if (rankOf(unsignedTyK) >= rankOf(signedTyK))
+        return builtinType(unsignedTyK);
+    if (sizeOf(signedTyK) > sizeOf(unsignedTyK))
+        return builtinType(signedTyK);
+    return builtinType(unsignedOf(signedTyK));
+}
+
+const TypeSymbol* TypeChecker::referencedTypeOf(const TypeSymbol* tySym) const
+{
+    tySym = resolved(tySym);
+    if (!tySym || !tySym->asPointerType())
+        return nullptr;
+
+    return tySym->asPointerType()->referencedType();
+}
+
+/*
+ * The type of a type name made up of type specifiers, \c const, and
+ * pointer declarators; others are not evaluated.
+ */
+const TypeSymbol* TypeChecker::typeOfTypeName(const TypeNameSyntax* node)
+{
+    if (!node)
+        return nullptr;
+
+    const TypeSymbol* tySym = nullptr;
+    int voidCnt = 0, charCnt = 0, shortCnt = 0, intCnt = 0, longCnt = 0;
+    int floatCnt = 0, doubleCnt = 0, boolCnt = 0, complexCnt = 0, signedCnt = 0, unsignedCnt = 0;
+    bool isConst = false;
+    for (auto specIt = node->specifiers(); specIt; specIt = specIt->next) {
+        auto spec = specIt->value;
+        switch (spec->kind()) {
+            case BuiltinTypeSpecifier:
+                switch (spec->asBuiltinTypeSpecifier()->specifierToken().kind()) {
+                    case Keyword_void: ++voidCnt; break;
+                    case Keyword_char: ++charCnt; break;
+                    case Keyword_short: ++shortCnt; break;
+                    case Keyword_int: ++intCnt; break;
+                    case Keyword_long: ++longCnt; break;
+                    case Keyword_float: ++floatCnt; break;
+                    case Keyword_double: ++doubleCnt; break;
+                    case Keyword__Bool: ++boolCnt; break;
+                    case Keyword__Complex: ++complexCnt; break;
+                    case Keyword_signed: ++signedCnt; break;
+                    case Keyword_unsigned: ++unsignedCnt; break;
+                    default:
+                        return nullptr;
+                }
+                break;
+
+            case StructTypeSpecifier:
+            case UnionTypeSpecifier:
+            case EnumTypeSpecifier: {
+                auto tySpec = spec->asTagTypeSpecifier();
+                auto tagSym = lookupTag(tySpec->tagToken());
+                tySym = tyInterner_->tagType(spec->kind() == StructTypeSpecifier
+                                                 ? TagSymbolName::TagChoice::Struct
+                                                 : spec->kind() == UnionTypeSpecifier
+                                                       ? TagSymbolName::TagChoice::Union
+                                                       : TagSymbolName::TagChoice::Enum,
+                                             tySpec->tagToken().valueText(),
+                                             tagSym ? tagSym->scope() : nullptr,
+                                             tyUses_);
+                break;
+            }
+
+            case TypedefName: {
+                auto identTk = spec->asTypedefName()->identifierToken();
+                auto sym = lookup(identTk);
+                tySym = sym && sym->asValue() && sym->asValue()->type()
+                        ? sym->asValue()->type()
+                        : tyInterner_->synonymType(identTk.valueText(), tyUses_);
+                break;
+            }
+
+            case ConstQualifier:
+                isConst = true;
+                break;
+
+            case VolatileQualifier:
+            case RestrictQualifier:
+                break;
+
+            default:
+                return nullptr;
+        }
+    }
+
+    if (!tySym) {
+        BuiltinTypeKind builtTyK;
+        if (voidCnt)
+            builtTyK = BuiltinTypeKind::Void;
+        else if (boolCnt)
+            builtTyK = BuiltinTypeKind::Bool;
+        else if (charCnt)
+            builtTyK = signedCnt ? BuiltinTypeKind::Char_S
+                                 : unsignedCnt ? BuiltinTypeKind::Char_U
+                                               : BuiltinTypeKind::Char;
+        else if (shortCnt)
+            builtTyK = unsignedCnt ? BuiltinTypeKind::Short_U : BuiltinTypeKind::Short;
+        else if (floatCnt)
+            builtTyK = complexCnt ? BuiltinTypeKind::FloatComplex : BuiltinTypeKind::Float;
+        else if (doubleCnt && longCnt)
+            builtTyK = complexCnt ? BuiltinTypeKind::LongDoubleComplex : BuiltinTypeKind::LongDouble;
+        else if (doubleCnt || complexCnt)
+            builtTyK = complexCnt ? BuiltinTypeKind::DoubleComplex : BuiltinTypeKind::Double;
+        else if (longCnt > 1)
+            builtTyK = unsignedCnt ? BuiltinTypeKind::LongLong_U : BuiltinTypeKind::LongLong;
+        else if (longCnt)
+            builtTyK = unsignedCnt ? BuiltinTypeKind::Long_U : BuiltinTypeKind::Long;
+        else if (intCnt || signedCnt || unsignedCnt)
+            builtTyK = unsignedCnt ? BuiltinTypeKind::Int_U : BuiltinTypeKind::Int;
+        else
+            return nullptr;
+        tySym = builtinType(builtTyK);
+    }
+    if (isConst)
+        tySym = tyInterner_->constQualifiedType(tySym, tyUses_);
+
+    for (auto decltor = node->declarator(); decltor; ) {
+        switch (decltor->kind()) {
+            case AbstractDeclarator:
+                return tySym;
+
+            case PointerDeclarator: {
+                auto ptrDecltor = decltor->asPointerDeclarator();
+                tySym = pointerType(tySym);
+                for (auto specIt = ptrDecltor->qualifiersAndAttributes(); specIt; specIt = specIt->next) {
+                    if (specIt->value->kind() == ConstQualifier)
+                        tySym = tyInterner_->constQualifiedType(tySym, tyUses_);
+                }
+                decltor = ptrDecltor->innerDeclarator();
+                break;
+            }
+
+            case ParenthesizedDeclarator:
+                decltor = decltor->asParenthesizedDeclarator()->innerDeclarator();
+                break;
+
+            default:
+                return nullptr;
+        }
+    }
+    return tySym;
+}
+
+/*
+ * The type of a member of a structure or union; its fields are those
+ * declared by the (last) definition of its tag.
+ */
+const TypeSymbol* TypeChecker::typeOfMember(const TypeSymbol* tySym, SyntaxToken identTk)
+{
+    tySym = resolved(tySym);
+    if (!tySym)
+        return nullptr;
+
+    if (!identTk.valueLexeme() || !identTk.valueLexeme()->asIdentifier())
+        return nullptr;
+
+    auto fldSym = semaModel_->memberOf(unqualifiedType(tySym),
+                                       identTk.valueLexeme()->asIdentifier());
+    return fldSym ? fldSym->type() : nullptr;
+}
@@ -22,14 +22,197 @@
 #define PSYCHE_C_TYPE_CHECKER_H__
 
 #include "API.h"
+#include "Fwds.h"
 
-#include "syntax/SyntaxVisitor.h"
+#include "binder/NameSpaceKind.h"
+#include "parser/LexedTokens.h"
+#include "symbols/TypeKind_Builtin.h"
+#include "syntax/StaticSyntaxVisitor.h"
+
+#include "../common/diagnostics/DiagnosticDescriptor.h"
+#include "../common/infra/InternalAccess.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace psy {
 namespace C {
 
-class TypeChecker final : protected SyntaxVisitor
+class SemanticModel;
+class TypeInterner;
+struct TypeUses;
+
+/**
+ * \brief The TypeChecker class.
+ *
+ * Computes, in a single walk over the syntax, the type of every expression
+ * and stores it in the SemanticModel.
+ *
+ * \remark 6.3 and 6.5
+ */
+class PSY_C_NON_API TypeChecker final : protected StaticSyntaxVisitor<TypeChecker>
 {
+    friend class TypeCheckerBenchmark;
+    friend class SyntaxVisitorBenchmark;
+
+PSY_INTERNAL_AND_RESTRICTED:
+    PSY_GRANT_ACCESS(SemanticModel);
+    PSY_GRANT_ACCESS(StaticSyntaxVisitor<TypeChecker>);
+
+    TypeChecker(SemanticModel* semaModel, const SyntaxTree* tree);
+
+    void typeCheck(const Scope* fileScope);
+    void typeCheckFunctionBody(const CompoundStatementSyntax* body, const Scope* scope);
+
+private:
+    // Unavailable
+    TypeChecker(const TypeChecker&) = delete;
+    void operator=(const TypeChecker&) = delete;
+
+    SemanticModel* semaModel_;
+    TypeInterner* tyInterner_;
+    TypeUses* tyUses_;
+
+    /*
+     * The ordinary names (and the tags) declared in the blocks being checked,
+     * shadowing those of the Scope (of the Binder) in which the check takes place.
+     */
+    const Scope* outerScope_;
+    std::unordered_map<const Identifier*, std::vector<const Symbol*>> names_;
+    std::unordered_map<const Identifier*, std::vector<const Symbol*>> tags_;
+    std::vector<std::pair<const Identifier*, NameSpaceKind>> declaredNames_;
+    std::vector<std::size_t> blocks_;
+    bool collectParms_;
+
+    void openBlock();
+    void closeBlock();
+    void declare(SyntaxToken identTk, const Symbol* sym);
+    void declareTag(SyntaxToken tagTk, const Symbol* sym);
+    void declare_(SyntaxToken identTk, NameSpaceKind nsK, const Symbol* sym);
+    const Symbol* lookup(SyntaxToken identTk) const;
+    const Symbol* lookupTag(SyntaxToken tagTk) const;
+
+    /* The type of the expression just checked. */
+    const TypeSymbol* tySym_;
+
+    /*
+     * The canonical types most often derived, which are cached so as not
+     * to contend for the TypeInterner.
+     */
+    std::array<const TypeSymbol*,
+               static_cast<std::size_t>(BuiltinTypeKind::LongDoubleComplex) + 1> builtinTySyms_;
+    std::unordered_map<const TypeSymbol*, const TypeSymbol*> ptrTySyms_;
+    std::unordered_map<const TypeSymbol*, const TypeSymbol*> arrTySyms_;
+
+    const TypeSymbol* check(const ExpressionSyntax* expr);
+    Action typed(const ExpressionSyntax* node, const TypeSymbol* tySym);
+
+    /* Types */
+    enum class Category : std::uint8_t
+    {
+        Unknown,
+        Void,
+        Integer,
+        Floating,
+        Pointer,
+        Array,
+        Function,
+        StructOrUnion
+    };
+    const TypeSymbol* builtinType(BuiltinTypeKind builtTyK);
+    const TypeSymbol* pointerType(const TypeSymbol* tySym);
+    const TypeSymbol* arrayType(const TypeSymbol* tySym);
+    const TypeSymbol* unqualifiedType(const TypeSymbol* tySym);
+    const TypeSymbol* resolved(const TypeSymbol* tySym) const;
+    Category categoryOf(const TypeSymbol* tySym) const;
+    BuiltinTypeKind builtinTypeKindOf(const TypeSymbol* tySym) const;
+    const TypeSymbol* valueOf(const TypeSymbol* tySym);
+    const TypeSymbol* promoted(const TypeSymbol* tySym);
+    const TypeSymbol* usualArithmeticConversions(const TypeSymbol* tySym1, const TypeSymbol* tySym2);
+    const TypeSymbol* referencedTypeOf(const TypeSymbol* tySym) const;
+    const TypeSymbol* typeOfTypeName(const TypeNameSyntax* node);
+    const TypeSymbol* typeOfMember(const TypeSymbol* tySym, SyntaxToken identTk);
+
+    struct DiagnosticsReporter
+    {
+        DiagnosticsReporter(TypeChecker* tyChecker)
+            : tyChecker_(tyChecker)
+        {}
+        TypeChecker* tyChecker_;
+        void diagnose(DiagnosticDescriptor&& desc, SyntaxToken tk);
+
+        static const std::string ID_of_InvalidOperandsToBinaryOperator;
+        static const std::string ID_of_InvalidOperandToUnaryOperator;
+        static const std::string ID_of_ExpectedStructOrUnionOnMemberAccess;
+        static const std::string ID_of_CalledObjectIsNotFunction;
+        static const std::string ID_of_TooFewArgumentsToFunctionCall;
+        static const std::string ID_of_SubscriptedValueIsNotArrayOrPointer;
+
+        void InvalidOperandsToBinaryOperator(SyntaxToken tk);
+        void InvalidOperandToUnaryOperator(SyntaxToken tk);
+        void ExpectedStructOrUnionOnMemberAccess(SyntaxToken tk);
+        void CalledObjectIsNotFunction(SyntaxToken tk);
+        void TooFewArgumentsToFunctionCall(SyntaxToken tk);
+        void SubscriptedValueIsNotArrayOrPointer(SyntaxToken tk);
+    };
+
+    DiagnosticsReporter diagReporter_;
+
+    //--------------//
+    // Declarations //
+    //--------------//
+    Action visitStructOrUnionDeclaration(const StructOrUnionDeclarationSyntax*);
+    Action visitEnumDeclaration(const EnumDeclarationSyntax*);
+    Action visitEnumeratorDeclaration(const EnumeratorDeclarationSyntax*);
+    Action visitVariableAndOrFunctionDeclaration(const VariableAndOrFunctionDeclarationSyntax*);
+    Action visitFieldDeclaration(const FieldDeclarationSyntax*);
+    Action visitFunctionDefinition(const FunctionDefinitionSyntax*);
+
+    /* Declarators */
+    Action visitParameterSuffix(const ParameterSuffixSyntax*);
+
+    //-------------//
+    // Expressions //
+    //-------------//
+    Action visitIdentifierName(const IdentifierNameSyntax*);
+    Action visitPredefinedName(const PredefinedNameSyntax*);
+    Action visitConstantExpression(const ConstantExpressionSyntax*);
+    Action visitStringLiteralExpression(const StringLiteralExpressionSyntax*);
+    Action visitParenthesizedExpression(const ParenthesizedExpressionSyntax*);
+    Action visitGenericSelectionExpression(const GenericSelectionExpressionSyntax*);
+    Action visitExtGNU_EnclosedCompoundStatementExpression(const ExtGNU_EnclosedCompoundStatementExpressionSyntax*);
+    Action visitExtGNU_ComplexValuedExpression(const ExtGNU_ComplexValuedExpressionSyntax*);
+    Action visitPrefixUnaryExpression(const PrefixUnaryExpressionSyntax*);
+    Action visitPostfixUnaryExpression(const PostfixUnaryExpressionSyntax*);
+    Action visitMemberAccessExpression(const MemberAccessExpressionSyntax*);
+    Action visitArraySubscriptExpression(const ArraySubscriptExpressionSyntax*);
+    Action visitTypeTraitExpression(const TypeTraitExpressionSyntax*);
+    Action visitCastExpression(const CastExpressionSyntax*);
+    Action visitCallExpression(const CallExpressionSyntax*);
+    Action visitVAArgumentExpression(const VAArgumentExpressionSyntax*);
+    Action visitOffsetOfExpression(const OffsetOfExpressionSyntax*);
+    Action visitCompoundLiteralExpression(const CompoundLiteralExpressionSyntax*);
+    Action visitBinaryExpression(const BinaryExpressionSyntax*);
+    Action visitConditionalExpression(const ConditionalExpressionSyntax*);
+    Action visitAssignmentExpression(const AssignmentExpressionSyntax*);
+    Action visitSequencingExpression(const SequencingExpressionSyntax*);
+    Action visitExtGNU_ChooseExpression(const ExtGNU_ChooseExpressionSyntax*);
+    Action visitAmbiguousCastOrBinaryExpression(const AmbiguousCastOrBinaryExpressionSyntax*);
+
+    //------------//
+    // Statements //
+    //------------//
+    Action visitCompoundStatement(const CompoundStatementSyntax*);
+    Action visitForStatement(const ForStatementSyntax*);
+
+    //--------//
+    // Common //
+    //--------//
+    Action visitTypeName(const TypeNameSyntax*);
 };
 
 } // C
@@ -0,0 +1,517 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "TypeChecker.h"
+
+#include "SyntaxTree.h"
+
+#include "compilation/SemanticModel.h"
+#include "compilation/TypeInterner.h"
+#include "symbols/Symbol_ALL.h"
+#include "syntax/SyntaxNodes.h"
+
+#include "../common/infra/Assertions.h"
+
+using namespace psy;
+using namespace C;
+
+const TypeSymbol* TypeChecker::check(const ExpressionSyntax* expr)
+{
+    tySym_ = nullptr;
+    visit(expr);
+    return tySym_;
+}
+
+SyntaxVisitor::Action TypeChecker::typed(const ExpressionSyntax* node, const TypeSymbol* tySym)
+{
+    semaModel_->storeExprType(node, tySym);
+    tySym_ = tySym;
+    return Action::Skip;
+}
+
+//-------------//
+// Expressions //
+//-------------//
+
+SyntaxVisitor::Action TypeChecker::visitIdentifierName(const IdentifierNameSyntax* node)
+{
+    auto sym = lookup(node->identifierToken());
+    if (!sym)
+        return typed(node, nullptr);
+
+    switch (sym->kind()) {
+        case SymbolKind::Function:
+            return typed(node, sym->asFunction()->type());
+
+        case SymbolKind::Value:
+            if (sym->asValue()->valueKind() == ValueKind::Enumerator)
+                return typed(node, builtinType(BuiltinTypeKind::Int));
+            return typed(node, sym->asValue()->type());
+
+        default:
+            return typed(node, nullptr);
+    }
+}
+
+SyntaxVisitor::Action TypeChecker::visitPredefinedName(const PredefinedNameSyntax* node)
+{
+    auto charTySym = builtinType(BuiltinTypeKind::Char);
+    return typed(node, arrayType(tyInterner_->constQualifiedType(charTySym, tyUses_)));
+}
+
+/*
+ * \remark 6.4.4.1-5, 6.4.4.2-4, and 6.4.4.4-10
+ */
+SyntaxVisitor::Action TypeChecker::visitConstantExpression(const ConstantExpressionSyntax* node)
+{
+    switch (node->kind()) {
+        case IntegerConstantExpression: {
+            auto text = node->constantToken().valueText();
+            int longCnt = 0;
+            bool isUnsigned = false;
+            for (auto i = text.size(); i-- > 0; ) {
+                auto c = text[i];
+                if (c == 'u' || c == 'U')
+                    isUnsigned = true;
+                else if (c == 'l' || c == 'L')
+                    ++longCnt;
+                else
+                    break;
+            }
+            BuiltinTypeKind builtTyK;
+            if (longCnt > 1)
+                builtTyK = isUnsigned ? BuiltinTypeKind::LongLong_U : BuiltinTypeKind::LongLong;
+            else if (longCnt)
+                builtTyK = isUnsigned ? BuiltinTypeKind::Long_U : BuiltinTypeKind::Long;
+            else
+                builtTyK = isUnsigned ? BuiltinTypeKind::Int_U : BuiltinTypeKind::Int;
+            return typed(node, builtinType(builtTyK));
+        }
+
+        case FloatingConstantExpression: {
+            auto text = node->constantToken().valueText();
+            auto c = text.empty() ? '\0' : text.back();
+            BuiltinTypeKind builtTyK = BuiltinTypeKind::Double;
+            if (c == 'f' || c == 'F')
+                builtTyK = BuiltinTypeKind::Float;
+            else if (c == 'l' || c == 'L')
+                builtTyK = BuiltinTypeKind::LongDouble;
+            return typed(node, builtinType(builtTyK));
+        }
+
+        case ImaginaryIntegerConstantExpression:
+        case ImaginaryFloatingConstantExpression:
+            return typed(node, builtinType(BuiltinTypeKind::DoubleComplex));
+
+        case CharacterConstantExpression:
+        case BooleanConstantExpression:
+            return typed(node, builtinType(BuiltinTypeKind::Int));
+
+        case NULL_ConstantExpression:
+            return typed(node, pointerType(
+                                   builtinType(BuiltinTypeKind::Void)));
+
+        default:
+            return typed(node, nullptr);
+    }
+}
+
+/*
+ * \remark 6.4.5-6
+ */
+SyntaxVisitor::Action TypeChecker::visitStringLiteralExpression(const StringLiteralExpressionSyntax* node)
+{
+    return typed(node, arrayType(builtinType(BuiltinTypeKind::Char)));
+}
+
+SyntaxVisitor::Action TypeChecker::visitParenthesizedExpression(const ParenthesizedExpressionSyntax* node)
+{
+    return typed(node, check(node->expression()));
+}
+
+SyntaxVisitor::Action TypeChecker::visitGenericSelectionExpression(const GenericSelectionExpressionSyntax* node)
+{
+    check(node->expression());
+    for (auto assocIt = node->associations(); assocIt; assocIt = assocIt->next)
+        check(assocIt->value->expression());
+
+    return typed(node, nullptr);
+}
+
+SyntaxVisitor::Action TypeChecker::visitExtGNU_EnclosedCompoundStatementExpression(
+        const ExtGNU_EnclosedCompoundStatementExpressionSyntax* node)
+{
+    visit(node->statement());
+
+    return typed(node, nullptr);
+}
+
+SyntaxVisitor::Action TypeChecker::visitExtGNU_ComplexValuedExpression(
+        const ExtGNU_ComplexValuedExpressionSyntax* node)
+{
+    check(node->expression());
+
+    return typed(node, nullptr);
+}
+
+/*
+ * \remark 6.5.3
+ */
+SyntaxVisitor::Action TypeChecker::visitPrefixUnaryExpression(const PrefixUnaryExpressionSyntax* node)
+{
+    auto tySym = check(node->expression());
+    auto cat = categoryOf(tySym);
+
+    switch (node->kind()) {
+        case PreIncrementExpression:
+        case PreDecrementExpression:
+            if (cat == Category::Integer || cat == Category::Floating || cat == Category::Pointer)
+                return typed(node, valueOf(tySym));
+            break;
+
+        case UnaryPlusExpression:
+        case UnaryMinusExpression:
+            if (cat == Category::Integer || cat == Category::Floating)
+                return typed(node, promoted(tySym));
+            break;
+
+        case BitwiseNotExpression:
+            if (cat == Category::Integer)
+                return typed(node, promoted(tySym));
+            break;
+
+        case LogicalNotExpression:
+            if (cat != Category::Void && cat != Category::StructOrUnion)
+                return typed(node, builtinType(BuiltinTypeKind::Int));
+            break;
+
+        case AddressOfExpression:
+            return typed(node, tySym ? pointerType(tySym) : nullptr);
+
+        case PointerIndirectionExpression:
+            if (cat == Category::Unknown)
+                return typed(node, nullptr);
+            if (cat == Category::Function)
+                return typed(node, tySym);
+            if (cat == Category::Pointer || cat == Category::Array)
+                return typed(node, referencedTypeOf(valueOf(tySym)));
+            break;
+
+        default:
+            return typed(node, nullptr);
+    }
+
+    if (cat != Category::Unknown)
+        diagReporter_.InvalidOperandToUnaryOperator(node->operatorToken());
+    return typed(node, nullptr);
+}
+
+/*
+ * \remark 6.5.2.4
+ */
+SyntaxVisitor::Action TypeChecker::visitPostfixUnaryExpression(const PostfixUnaryExpressionSyntax* node)
+{
+    auto tySym = check(node->expression());
+    auto cat = categoryOf(tySym);
+    if (cat == Category::Integer || cat == Category::Floating || cat == Category::Pointer)
+        return typed(node, valueOf(tySym));
+
+    if (cat != Category::Unknown)
+        diagReporter_.InvalidOperandToUnaryOperator(node->operatorToken());
+    return typed(node, nullptr);
+}
+
+/*
+ * \remark 6.5.2.3
+ */
+SyntaxVisitor::Action TypeChecker::visitMemberAccessExpression(const MemberAccessExpressionSyntax* node)
+{
+    auto tySym = check(node->expression());
+    if (node->kind() == IndirectMemberAccessExpression) {
+        auto cat = categoryOf(tySym);
+        if (cat == Category::Unknown)
+            return typed(node, nullptr);
+        tySym = (cat == Category::Pointer || cat == Category::Array)
+                ? referencedTypeOf(valueOf(tySym))
+                : nullptr;
+        if (!tySym) {
+            diagReporter_.ExpectedStructOrUnionOnMemberAccess(node->operatorToken());
+            return typed(node, nullptr);
+        }
+    }
+
+    switch (categoryOf(tySym)) {
+        case Category::Unknown:
+            return typed(node, nullptr);
+
+        case Category::StructOrUnion: {
+            auto fldTySym = typeOfMember(tySym, node->identifier()->identifierToken());
+            semaModel_->storeExprType(node->identifier(), fldTySym);
+            return typed(node, fldTySym);
+        }
+
+        default:
+            diagReporter_.ExpectedStructOrUnionOnMemberAccess(node->operatorToken());
+            return typed(node, nullptr);
+    }
+}
+
+/*
+ * \remark 6.5.2.1
+ */
+SyntaxVisitor::Action TypeChecker::visitArraySubscriptExpression(const ArraySubscriptExpressionSyntax* node)
+{
+    auto tySym1 = valueOf(check(node->expression()));
+    auto tySym2 = valueOf(check(node->argument()));
+    auto cat1 = categoryOf(tySym1);
+    auto cat2 = categoryOf(tySym2);
+    if (cat1 == Category::Pointer && cat2 != Category::Pointer)
+        return typed(node, referencedTypeOf(tySym1));
+    if (cat2 == Category::Pointer && cat1 == Category::Integer)
+        return typed(node, referencedTypeOf(tySym2));
+
+    if (cat1 != Category::Unknown && cat2 != Category::Unknown)
+        diagReporter_.SubscriptedValueIsNotArrayOrPointer(node->openBracketToken());
+    return typed(node, nullptr);
+}
+
+/*
+ * The type \c size_t is \c unsigned \c long (LP64).
+ *
+ * \remark 6.5.3.4-5
+ */
+SyntaxVisitor::Action TypeChecker::visitTypeTraitExpression(const TypeTraitExpressionSyntax* node)
+{
+    visit(node->tyReference());
+
+    return typed(node, builtinType(BuiltinTypeKind::Long_U));
+}
+
+/*
+ * \remark 6.5.4
+ */
+SyntaxVisitor::Action TypeChecker::visitCastExpression(const CastExpressionSyntax* node)
+{
+    check(node->expression());
+    auto tySym = typeOfTypeName(node->typeName());
+
+    return typed(node, tySym ? unqualifiedType(tySym) : nullptr);
+}
+
+/*
+ * \remark 6.5.2.2
+ */
+SyntaxVisitor::Action TypeChecker::visitCallExpression(const CallExpressionSyntax* node)
+{
+    auto tySym = valueOf(check(node->expression()));
+    std::size_t argCnt = 0;
+    for (auto argIt = node->arguments(); argIt; argIt = argIt->next) {
+        check(argIt->value);
+        ++argCnt;
+    }
+
+    auto cat = categoryOf(tySym);
+    if (cat == Category::Unknown)
+        return typed(node, nullptr);
+
+    const FunctionTypeSymbol* funcTySym = nullptr;
+    if (cat == Category::Pointer) {
+        auto refedTySym = referencedTypeOf(tySym);
+        switch (categoryOf(refedTySym)) {
+            case Category::Unknown:
+                return typed(node, nullptr);
+
+            case Category::Function:
+                funcTySym = resolved(refedTySym)->asFunctionType();
+                break;
+
+            default:
+                break;
+        }
+    }
+    if (!funcTySym) {
+        diagReporter_.CalledObjectIsNotFunction(node->openParenthesisToken());
+        return typed(node, nullptr);
+    }
+
+    // A function may be variadic, so only a shortage of arguments is diagnosed.
+    auto parmTySyms = funcTySym->parameterTypes();
+    if (!(parmTySyms.size() == 1 && categoryOf(parmTySyms[0]) == Category::Void)
+            && argCnt < parmTySyms.size()) {
+        diagReporter_.TooFewArgumentsToFunctionCall(node->closeParenthesisToken());
+    }
+
+    auto retTySym = funcTySym->returnType();
+    return typed(node, retTySym ? unqualifiedType(retTySym) : nullptr);
+}
+
+SyntaxVisitor::Action TypeChecker::visitVAArgumentExpression(const VAArgumentExpressionSyntax* node)
+{
+    check(node->expression());
+
+    return typed(node, typeOfTypeName(node->typeName()));
+}
+
+SyntaxVisitor::Action TypeChecker::visitOffsetOfExpression(const OffsetOfExpressionSyntax* node)
+{
+    return typed(node, builtinType(BuiltinTypeKind::Long_U));
+}
+
+/*
+ * \remark 6.5.2.5
+ */
+SyntaxVisitor::Action TypeChecker::visitCompoundLiteralExpression(const CompoundLiteralExpressionSyntax* node)
+{
+    visit(node->initializer());
+
+    return typed(node, typeOfTypeName(node->typeName()));
+}
+
+/*
+ * \remark 6.5.5 through 6.5.14
+ */
+SyntaxVisitor::Action TypeChecker::visitBinaryExpression(const BinaryExpressionSyntax* node)
+{
+    auto tySym1 = valueOf(check(node->left()));
+    auto tySym2 = valueOf(check(node->right()));
+    auto cat1 = categoryOf(tySym1);
+    auto cat2 = categoryOf(tySym2);
+    auto isArith1 = cat1 == Category::Integer || cat1 == Category::Floating;
+    auto isArith2 = cat2 == Category::Integer || cat2 == Category::Floating;
+
+    switch (node->kind()) {
+        case MultiplyExpression:
+        case DivideExpression:
+            if (isArith1 && isArith2)
+                return typed(node, usualArithmeticConversions(tySym1, tySym2));
+            break;
+
+        case ModuleExpression:
+        case BitwiseANDExpression:
+        case BitwiseXORExpression:
+        case BitwiseORExpression:
+            if (cat1 == Category::Integer && cat2 == Category::Integer)
+                return typed(node, usualArithmeticConversions(tySym1, tySym2));
+            break;
+
+        case AddExpression:
+            if (isArith1 && isArith2)
+                return typed(node, usualArithmeticConversions(tySym1, tySym2));
+            if (cat1 == Category::Pointer && cat2 == Category::Integer)
+                return typed(node, tySym1);
+            if (cat1 == Category::Integer && cat2 == Category::Pointer)
+                return typed(node, tySym2);
+            break;
+
+        case SubstractExpression:
+            if (isArith1 && isArith2)
+                return typed(node, usualArithmeticConversions(tySym1, tySym2));
+            if (cat1 == Category::Pointer && cat2 == Category::Integer)
+                return typed(node, tySym1);
+            // The type ptrdiff_t is long (LP64).
+            if (cat1 == Category::Pointer && cat2 == Category::Pointer)
+                return typed(node, builtinType(BuiltinTypeKind::Long));
+            break;
+
+        case LeftShiftExpression:
+        case RightShiftExpression:
+            if (cat1 == Category::Integer && cat2 == Category::Integer)
+                return typed(node, promoted(tySym1));
+            break;
+
+        case LessThanExpression:
+        case LessThanOrEqualExpression:
+        case GreaterThanExpression:
+        case GreaterThanOrEqualExpression:
+        case EqualsExpression:
+        case NotEqualsExpression:
+        case LogicalANDExpression:
+        case LogicalORExpression:
+            if ((isArith1 || cat1 == Category::Pointer) && (isArith2 || cat2 == Category::Pointer))
+                return typed(node, builtinType(BuiltinTypeKind::Int));
+            break;
+
+        default:
+            return typed(node, nullptr);
+    }
+
+    if (cat1 != Category::Unknown && cat2 != Category::Unknown)
+        diagReporter_.InvalidOperandsToBinaryOperator(node->operatorToken());
+    return typed(node, nullptr);
+}
+
+/*
+ * \remark 6.5.15
+ */
+SyntaxVisitor::Action TypeChecker::visitConditionalExpression(const ConditionalExpressionSyntax* node)
+{
+    auto condTySym = check(node->condition());
+    auto tySym1 = valueOf(node->whenTrue() ? check(node->whenTrue()) : condTySym);
+    auto tySym2 = valueOf(check(node->whenFalse()));
+    auto cat1 = categoryOf(tySym1);
+    auto cat2 = categoryOf(tySym2);
+
+    if ((cat1 == Category::Integer || cat1 == Category::Floating)
+            && (cat2 == Category::Integer || cat2 == Category::Floating)) {
+        return typed(node, usualArithmeticConversions(tySym1, tySym2));
+    }
+    if (tySym1 == tySym2)
+        return typed(node, tySym1);
+    if (cat1 == Category::Pointer && cat2 == Category::Integer)
+        return typed(node, tySym1);
+    if (cat1 == Category::Integer && cat2 == Category::Pointer)
+        return typed(node, tySym2);
+    if (cat1 == Category::Pointer && cat2 == Category::Pointer)
+        return typed(node, categoryOf(referencedTypeOf(tySym2)) == Category::Void ? tySym2 : tySym1);
+    return typed(node, nullptr);
+}
+
+/*
+ * \remark 6.5.16-3
+ */
+SyntaxVisitor::Action TypeChecker::visitAssignmentExpression(const AssignmentExpressionSyntax* node)
+{
+    auto tySym = check(node->left());
+    check(node->right());
+
+    return typed(node, tySym ? unqualifiedType(tySym) : nullptr);
+}
+
+SyntaxVisitor::Action TypeChecker::visitSequencingExpression(const SequencingExpressionSyntax* node)
+{
+    check(node->left());
+
+    return typed(node, valueOf(check(node->right())));
+}
+
+SyntaxVisitor::Action TypeChecker::visitExtGNU_ChooseExpression(const ExtGNU_ChooseExpressionSyntax* node)
+{
+    check(node->constantExpression());
+    check(node->expression1());
+    check(node->expression2());
+
+    return typed(node, nullptr);
+}
+
+SyntaxVisitor::Action TypeChecker::visitAmbiguousCastOrBinaryExpression(
+        const AmbiguousCastOrBinaryExpressionSyntax* node)
+{
+    return typed(node, nullptr);
+}
@@ -27,17 +27,84 @@ using namespace C;
 
 std::vector<const Symbol*> Assembly::symbols() const
 {
-    std::vector<const Symbol*> syms;
-    std::transform(symDEFs_.begin(),
-                   symDEFs_.end(),
-                   std::back_inserter(syms),
-                   [] (auto& sym) { return sym.get();});
-    return syms;
+    return std::vector<const Symbol*>(symDEFs_.begin(), symDEFs_.end());
 }
 
-Symbol* Assembly::findSymDEF(std::function<bool (const std::unique_ptr<Symbol>&)> pred) const
+std::size_t Assembly::symbolCount() const
 {
-    auto it = std::find_if(symDEFs_.begin(), symDEFs_.end(), pred);
-    return it == symDEFs_.end() ? nullptr
-                                : it->get();
+    return symDEFs_.size();
+}
+
+const Symbol* Assembly::symbolAt(std::size_t idx) const
+{
+    return idx < symDEFs_.size() ? symDEFs_[idx] : nullptr;
+}
+
+const std::vector<const Symbol*>& Assembly::searchForSymbols(const std::string& name,
+                                                             NameSpaceKind nsK,
+                                                             SymbolKind symK) const
+{
+    static const std::vector<const Symbol*> none;
+
+    auto nameIt = names_.find(name);
+    if (nameIt == names_.end())
+        return none;
+
+    auto it = nameIdx_.find(NameKey{ &*nameIt, nsK, symK });
+    return it == nameIdx_.end() ? none
+                                : it->second;
+}
+
+void Assembly::addSymDEF(Symbol* sym)
+{
+    symDEFs_.push_back(sym);
+    sym->setOwningAssembly(this);
+}
+
+void Assembly::addSymUSE(Symbol* sym)
+{
+    symUSEs_.push_back(sym);
+    sym->setOwningAssembly(this);
+}
+
+void Assembly::indexSymDEF(const std::string& name, NameSpaceKind nsK, const Symbol* sym)
+{
+    auto [nameIt, _] = names_.insert(name);
+    nameIdx_[NameKey{ &*nameIt, nsK, sym->kind() }].push_back(sym);
+}
+
+/*
+ * Remove the given symbols (which remain alive, in the Arena that owns
+ * them, until the SemanticModel that owns that Arena is destroyed).
+ */
+void Assembly::evictSyms(const std::unordered_set<const Symbol*>& syms)
+{
+    if (syms.empty())
+        return;
+
+    auto evict = [&syms] (std::vector<Symbol*>& v) {
+        v.erase(std::remove_if(v.begin(),
+                               v.end(),
+                               [&syms] (Symbol* sym) {
+                                   if (!syms.count(sym))
+                                       return false;
+                                   sym->setOwningAssembly(nullptr);
+                                   return true;
+                               }),
+                v.end());
+    };
+    evict(symDEFs_);
+    evict(symUSEs_);
+
+    for (auto it = nameIdx_.begin(); it != nameIdx_.end(); ) {
+        auto& v = it->second;
+        v.erase(std::remove_if(v.begin(),
+                               v.end(),
+                               [&syms] (const Symbol* sym) { return syms.count(sym) != 0; }),
+                v.end());
+        if (v.empty())
+            it = nameIdx_.erase(it);
+        else
+            ++it;
+    }
 }
@@ -24,11 +24,16 @@
 #include "API.h"
 #include "Fwds.h"
 
+#include "binder/NameSpaceKind.h"
 #include "symbols/Symbol.h"
+#include "symbols/SymbolKind.h"
 
 #include "../common/infra/InternalAccess.h"
 
+#include <cstddef>
 #include <functional>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -50,14 +55,68 @@ public:
      */
     std::vector<const Symbol*> symbols() const;
 
+    /**
+     * The number of Symbols defined in \c this Assembly.
+     */
+    std::size_t symbolCount() const;
+
+    /**
+     * The Symbol, defined in \c this Assembly, at index \p idx (in the
+     * order in which Symbols are defined).
+     */
+    const Symbol* symbolAt(std::size_t idx) const;
+
+    /**
+     * The Symbols of SymbolKind \p symK, defined in \c this Assembly,
+     * that are named \p name in the NameSpace of NameSpaceKind \p nsK.
+     */
+    const std::vector<const Symbol*>& searchForSymbols(const std::string& name,
+                                                       NameSpaceKind nsK,
+                                                       SymbolKind symK) const;
+
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(SemanticModel);
+    PSY_GRANT_ACCESS(TypeInterner);
 
-    Symbol* findSymDEF(std::function<bool (const std::unique_ptr<Symbol>&)> pred) const;
+    void addSymDEF(Symbol* sym);
+    void addSymUSE(Symbol* sym);
+    void indexSymDEF(const std::string& name, NameSpaceKind nsK, const Symbol* sym);
+    void evictSyms(const std::unordered_set<const Symbol*>& syms);
 
 private:
-    std::unordered_set<std::unique_ptr<Symbol>> symDEFs_;
-    std::vector<std::unique_ptr<Symbol>> symUSEs_;
+    struct NameKey
+    {
+        const std::string* name_;
+        NameSpaceKind nsK_;
+        SymbolKind symK_;
+
+        bool operator==(const NameKey& other) const
+        {
+            return name_ == other.name_
+                    && nsK_ == other.nsK_
+                    && symK_ == other.symK_;
+        }
+    };
+
+    struct NameKeyHash
+    {
+        std::size_t operator()(const NameKey& key) const
+        {
+            return std::hash<const std::string*>()(key.name_)
+                    ^ (static_cast<std::size_t>(key.nsK_) << 8)
+                    ^ static_cast<std::size_t>(key.symK_);
+        }
+    };
+
+    /*
+     * The Symbols are owned by the SemanticModels' Arenas; the USEs, which
+     * are canonical TypeSymbols, by its TypeInterner.
+     */
+    std::vector<Symbol*> symDEFs_;
+    std::vector<Symbol*> symUSEs_;
+
+    std::unordered_set<std::string> names_;
+    std::unordered_map<NameKey, std::vector<const Symbol*>, NameKeyHash> nameIdx_;
 };
 
 } // C
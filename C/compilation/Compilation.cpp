@@ -24,8 +24,11 @@
 #include "Assembly.h"
 #include "SemanticModel.h"
 #include "SyntaxTree.h"
+#include "TypeInterner.h"
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include <unordered_map>
 
 using namespace psy;
@@ -36,13 +39,19 @@ struct Compilation::CompilationImpl
     CompilationImpl(Compilation* q)
         : Q_(q)
         , assembly_(new Assembly)
+        , tyInterner_(new TypeInterner(assembly_.get()))
+        , treatOfFuncBodies_(TreatmentOfFunctionBodies::BindEagerly)
     {}
 
     Compilation* Q_;
     std::string id_;
     std::unique_ptr<Assembly> assembly_;
+    std::unique_ptr<TypeInterner> tyInterner_;
+    std::vector<const SyntaxTree*> trees_;
     std::unordered_map<const SyntaxTree*, bool> isDirty_;
     std::unordered_map<const SyntaxTree*, std::unique_ptr<SemanticModel>> semaModels_;
+    TreatmentOfFunctionBodies treatOfFuncBodies_;
+    std::mutex onDemandBindingMutex_;
 };
 
 Compilation::Compilation()
@@ -78,6 +87,16 @@ Assembly* Compilation::assembly()
     return P->assembly_.get();
 }
 
+TypeInterner* Compilation::typeInterner()
+{
+    return P->tyInterner_.get();
+}
+
+std::mutex& Compilation::onDemandBindingMutex()
+{
+    return P->onDemandBindingMutex_;
+}
+
 void Compilation::addSyntaxTree(const SyntaxTree* tree)
 {
     auto it = P->semaModels_.find(tree);
@@ -85,6 +104,7 @@ void Compilation::addSyntaxTree(const SyntaxTree* tree)
         return;
 
     P->semaModels_.insert(it, std::make_pair(tree, nullptr));
+    P->trees_.push_back(tree);
     P->isDirty_[tree] = true;
     tree->attachCompilation(this);
 }
@@ -95,24 +115,96 @@ void Compilation::addSyntaxTrees(std::vector<const SyntaxTree*> trees)
         addSyntaxTree(tree);
 }
 
+void Compilation::replaceSyntaxTree(const SyntaxTree* oldTree, const SyntaxTree* newTree)
+{
+    if (oldTree == newTree)
+        return;
+
+    auto treeIt = std::find(P->trees_.begin(), P->trees_.end(), oldTree);
+    if (treeIt == P->trees_.end()) {
+        addSyntaxTree(newTree);
+        return;
+    }
+    *treeIt = newTree;
+
+    auto oldSemaModel = std::move(P->semaModels_[oldTree]);
+    P->semaModels_.erase(oldTree);
+    P->isDirty_.erase(oldTree);
+    oldTree->detachCompilation(this);
+    newTree->attachCompilation(this);
+
+    if (!oldSemaModel) {
+        P->semaModels_[newTree] = nullptr;
+        P->isDirty_[newTree] = true;
+        return;
+    }
+
+    P->semaModels_[newTree].reset(new SemanticModel(newTree, this, oldSemaModel.get()));
+    P->semaModels_[newTree]->commitSyms();
+    P->isDirty_[newTree] = false;
+}
+
 std::vector<const SyntaxTree*> Compilation::syntaxTrees() const
 {
-    std::vector<const SyntaxTree*> trees(P->semaModels_.size());
-    std::transform(P->semaModels_.begin(),
-                   P->semaModels_.end(),
-                   std::back_inserter(trees),
-                   [] (const auto& kv) { return kv.first; });
-    return  trees;
+    return P->trees_;
 }
 
 const SemanticModel* Compilation::semanticModel(const SyntaxTree* tree) const
 {
+    // A tree is dirty until its first SemanticModel is computed; there are
+    // no stale symbols to remove (see replaceSyntaxTree).
     if (P->isDirty_[tree]) {
-        // TODO: Remove from the assembly the symbols associated
-        // with the given syntax tree.
         P->semaModels_[tree].reset(new SemanticModel(tree, const_cast<Compilation*>(this)));
+        P->semaModels_[tree]->commitSyms();
         P->isDirty_[tree] = false;
     }
 
     return P->semaModels_[tree].get();
 }
+
+void Compilation::setTreatmentOfFunctionBodies(TreatmentOfFunctionBodies treatOfFuncBodies)
+{
+    P->treatOfFuncBodies_ = treatOfFuncBodies;
+}
+
+Compilation::TreatmentOfFunctionBodies Compilation::treatmentOfFunctionBodies() const
+{
+    return P->treatOfFuncBodies_;
+}
+
+void Compilation::computeAllSemanticModels(unsigned int threadCnt)
+{
+    std::vector<const SyntaxTree*> trees;
+    for (auto tree : P->trees_) {
+        if (P->isDirty_[tree])
+            trees.push_back(tree);
+    }
+    if (trees.empty())
+        return;
+
+    threadCnt = std::max(1u, std::min(threadCnt, static_cast<unsigned int>(trees.size())));
+
+    /*
+     * Every SemanticModel binds into an Arena of its own, and holds on to
+     * its symbols until they're committed (serially) below.
+     */
+    std::vector<std::unique_ptr<SemanticModel>> semaModels(trees.size());
+    std::atomic<std::size_t> nextIdx(0);
+    auto bindTrees = [&] () {
+        for (auto idx = nextIdx++; idx < trees.size(); idx = nextIdx++)
+            semaModels[idx].reset(new SemanticModel(trees[idx], this));
+    };
+
+    std::vector<std::thread> workers;
+    for (auto i = 1u; i < threadCnt; ++i)
+        workers.emplace_back(bindTrees);
+    bindTrees();
+    for (auto& worker : workers)
+        worker.join();
+
+    for (auto i = 0u; i < trees.size(); ++i) {
+        semaModels[i]->commitSyms();
+        P->semaModels_[trees[i]] = std::move(semaModels[i]);
+        P->isDirty_[trees[i]] = false;
+    }
+}
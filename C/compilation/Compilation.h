@@ -29,6 +29,8 @@
 #include "../common/infra/InternalAccess.h"
 #include "../common/infra/Pimpl.h"
 
+#include <cstdint>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -71,6 +73,24 @@ public:
      */
     void addSyntaxTrees(std::vector<const SyntaxTree*> trees);
 
+    /**
+     * Replace, in \c this Compilation, SyntaxTree \p oldTree by \p newTree
+     * (typically, a reparse of an edited text).
+     *
+     * \remark
+     * If the SemanticModel of \p oldTree was computed, that of \p newTree is
+     * computed incrementally: only the external declarations whose text
+     * changed are bound (and the Symbols of those that were changed or
+     * removed are evicted from the Assembly); the Symbols of every other
+     * declaration are carried over.
+     *
+     * \remark
+     * The storage of evicted Symbols is released when the SemanticModel of
+     * \p newTree is computed from scratch, which happens once they outnumber
+     * the carried-over ones (or after a number of incremental replacements).
+     */
+    void replaceSyntaxTree(const SyntaxTree* oldTree, const SyntaxTree* newTree);
+
     /**
      * The SyntaxTrees in \c this Compilation.
      */
@@ -81,10 +101,47 @@ public:
      */
     const SemanticModel* semanticModel(const SyntaxTree* tree) const;
 
+    /**
+     * Compute the SemanticModel of every SyntaxTree in \c this Compilation,
+     * binding up to \p threadCnt SyntaxTrees concurrently.
+     *
+     * \remark
+     * The Symbols of each SyntaxTree are merged into the Assembly in the
+     * order in which the SyntaxTrees were added; so, the result is the same
+     * as that of requesting each SemanticModel in that order.
+     */
+    void computeAllSemanticModels(unsigned int threadCnt);
+
+    //!@{
+    /**
+     * \brief The alternatives for TreatmentOfFunctionBodies during binding.
+     */
+    enum class TreatmentOfFunctionBodies : std::uint8_t
+    {
+        BindEagerly,  /**< Bind function bodies together with the external declarations. */
+        BindOnDemand  /**< Bind a function body upon the first query to a Symbol within it. */
+    };
+    /**
+     * The TreatmentOfFunctionBodies of \c this Compilation.
+     *
+     * \remark
+     * The treatment applies to SemanticModels computed after it's set.
+     *
+     * \remark
+     * The SemanticModels may be queried concurrently: the binding of a
+     * function body on demand is serialized within \c this Compilation.
+     * But the Assembly must not be read while that's underway.
+     */
+    void setTreatmentOfFunctionBodies(TreatmentOfFunctionBodies treatOfFuncBodies);
+    TreatmentOfFunctionBodies treatmentOfFunctionBodies() const;
+    //!@}
+
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(SemanticModel);
 
     Assembly* assembly();
+    TypeInterner* typeInterner();
+    std::mutex& onDemandBindingMutex();
 
 private:
     Compilation();
@@ -22,41 +22,514 @@
 
 #include "Assembly.h"
 #include "Compilation.h"
+#include "TypeInterner.h"
 
 #include "binder/Binder.h"
+#include "binder/Scope.h"
+#include "binder/TypeChecker.h"
+#include "syntax/SyntaxLexeme_ALL.h"
 #include "syntax/SyntaxNodes.h"
 #include "syntax/SyntaxUtilities.h"
 #include "symbols/Symbol_ALL.h"
 
+#include "infra/Arena.h"
+
 #include "../common/infra/Assertions.h"
 #include "../common/infra/Escape.h"
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 using namespace psy;
 using namespace C;
 
 struct SemanticModel::SemanticModelImpl
 {
-    SemanticModelImpl(const SyntaxTree* tree, Compilation* compilation)
-        : expectValidSyms_(true)
+    SemanticModelImpl(SemanticModel* q,
+                      const SyntaxTree* tree,
+                      Compilation* compilation)
+        : Q_(q)
+        , expectValidSyms_(true)
         , tree_(tree)
         , compilation_(compilation)
-    {}
+        , evictedSymsCnt_(0)
+        , declSyms_(tree->nodeCount(), nullptr)
+        , exprTySyms_(tree->nodeCount(), nullptr)
+        , fileScope_(nullptr)
+        , curExtDeclIdx_(kNoExtDecl)
+        , unboundBodiesCnt_(0)
+    {
+        arenas_.emplace_back(new Arena);
+    }
+
+    static constexpr std::size_t kNoExtDecl = static_cast<std::size_t>(-1);
+    static constexpr std::size_t kMaxArenasCnt = 16;
+
+    /*
+     * While a function body remains unbound, a query (which may bind one)
+     * takes place under the lock of the Compilation for on-demand binding.
+     */
+    Symbol* declSymAt(const SyntaxNode* node)
+    {
+        if (!unboundBodiesCnt_.load(std::memory_order_acquire))
+            return storedDeclSymAt(node);
+
+        std::lock_guard<std::mutex> lock(compilation_->onDemandBindingMutex());
+        auto sym = storedDeclSymAt(node);
+        if (!sym && bindDeferredBodyOf(node))
+            sym = storedDeclSymAt(node);
+        return sym;
+    }
+
+    Symbol* storedDeclSymAt(const SyntaxNode* node) const
+    {
+        auto idx = node->ordinal();
+        return idx < declSyms_.size() ? declSyms_[idx] : nullptr;
+    }
+
+    const TypeSymbol* exprTySymAt(const SyntaxNode* node)
+    {
+        if (!unboundBodiesCnt_.load(std::memory_order_acquire))
+            return storedExprTySymAt(node);
+
+        std::lock_guard<std::mutex> lock(compilation_->onDemandBindingMutex());
+        auto tySym = storedExprTySymAt(node);
+        if (!tySym && bindDeferredBodyOf(node))
+            tySym = storedExprTySymAt(node);
+        return tySym;
+    }
+
+    const TypeSymbol* storedExprTySymAt(const SyntaxNode* node) const
+    {
+        auto idx = node->ordinal();
+        return idx < exprTySyms_.size() ? exprTySyms_[idx] : nullptr;
+    }
+
+    bool bindDeferredBodyOf(const SyntaxNode* node);
+    void typeCheck();
+    void rebindIncrementally(SemanticModelImpl* oldP);
 
+    void indexMember(const Identifier* ident, const Symbol* sym)
+    {
+        auto tagSym = sym->containingSymbol();
+        if (!ident || !tagSym || !tagSym->asType())
+            return;
+
+        tagDefs_[compilation_->typeInterner()->intern(tagSym->asType(), &tyUses_)] = tagSym;
+        membersOf_[tagSym][ident] = sym->asValue()->asField();
+    }
+
+    /*
+     * Index a field carried over from the SemanticModel of a replaced
+     * SyntaxTree, by the identifier of its name in this one.
+     */
+    void reindexMember(const Symbol* sym)
+    {
+        if (sym->kind() != SymbolKind::Value
+                || sym->asValue()->valueKind() != ValueKind::Field
+                || !sym->asValue()->asField()->name()) {
+            return;
+        }
+        const auto& name = sym->asValue()->asField()->name()->text();
+        indexMember(tree_->findIdentifier(name.c_str(), name.size()), sym);
+    }
+
+    SemanticModel* Q_;
     bool expectValidSyms_;
     const SyntaxTree* tree_;
     Compilation* compilation_;
-    std::unordered_map<const SyntaxNode*, Symbol*> declSyms_;
+
+    /*
+     * The Arenas of the symbols (and scopes), the last of which is the
+     * current one; those before it are carried over from the SemanticModels
+     * of replaced SyntaxTrees, along with the symbols (alive or evicted)
+     * in them.
+     */
+    std::vector<std::unique_ptr<Arena>> arenas_;
+    std::size_t evictedSymsCnt_;
+
+    /*
+     * Side tables indexed by the (dense) ordinal of a node.
+     */
+    std::vector<Symbol*> declSyms_;
+    std::vector<const TypeSymbol*> exprTySyms_;
+
+    /*
+     * The (last) definition of each (canonical) structure or union type,
+     * and the fields, by name, of each definition.
+     */
+    std::unordered_map<const TypeSymbol*, const Symbol*> tagDefs_;
+    std::unordered_map<const Symbol*,
+                       std::unordered_map<const Identifier*, const FieldSymbol*>> membersOf_;
+
+    /*
+     * The symbols (and their names), in the order they're bound, until
+     * committed to the Assembly.
+     */
+    std::vector<Symbol*> pendingSymDEFs_;
+    std::vector<std::tuple<std::string, NameSpaceKind, const Symbol*>> pendingNames_;
+
+    /*
+     * The canonical types obtained, until committed (as USEs) to the Assembly.
+     */
+    TypeUses tyUses_;
+
+    /*
+     * What's bound within each external declaration (in the order of the
+     * translation unit) and outside any of them, so that the SemanticModel
+     * of a replacing SyntaxTree may be computed incrementally.
+     */
+    struct ExternalDeclarationRecord
+    {
+        std::vector<Symbol*> syms_;
+        std::vector<std::pair<unsigned int, Symbol*>> declSyms_;
+        std::vector<Scope*> scopes_;
+    };
+    std::vector<ExternalDeclarationRecord> extDeclRecs_;
+    std::vector<Symbol*> unitSyms_;
+    std::vector<std::string_view> extDeclTexts_;
+    Scope* fileScope_;
+    std::size_t curExtDeclIdx_;
+
+    ExternalDeclarationRecord* currentRecord()
+    {
+        if (curExtDeclIdx_ == kNoExtDecl)
+            return nullptr;
+
+        if (curExtDeclIdx_ >= extDeclRecs_.size())
+            extDeclRecs_.resize(curExtDeclIdx_ + 1);
+        return &extDeclRecs_[curExtDeclIdx_];
+    }
+
+    /*
+     * The function bodies whose binding is deferred, in source order.
+     */
+    struct DeferredBody
+    {
+        const CompoundStatementSyntax* body_;
+        Scope* scope_;
+        Symbol* containingSym_;
+        std::size_t extDeclIdx_;
+        unsigned int start_;
+        unsigned int end_;
+        bool bound_;
+    };
+    std::vector<DeferredBody> deferredBodies_;
+    std::atomic<std::size_t> unboundBodiesCnt_;
 };
 
+/*
+ * Bind the deferred function body that encloses the given node, if any.
+ *
+ * \remark Called under the lock of the Compilation for on-demand binding.
+ */
+bool SemanticModel::SemanticModelImpl::bindDeferredBodyOf(const SyntaxNode* node)
+{
+    auto tk = node->firstToken();
+    if (!tk.isValid())
+        return false;
+
+    auto offset = tk.span().start();
+    auto it = std::upper_bound(deferredBodies_.begin(),
+                               deferredBodies_.end(),
+                               offset,
+                               [] (unsigned int offset, const DeferredBody& deferred) {
+                                   return offset < deferred.start_;
+                               });
+    if (it == deferredBodies_.begin())
+        return false;
+    --it;
+    if (it->bound_ || offset >= it->end_)
+        return false;
+
+    it->bound_ = true;
+
+    curExtDeclIdx_ = it->extDeclIdx_;
+    Binder binder(Q_, tree_);
+    binder.bindFunctionBody(it->body_, it->scope_, it->containingSym_);
+    curExtDeclIdx_ = kNoExtDecl;
+
+    TypeChecker tyChecker(Q_, tree_);
+    tyChecker.typeCheckFunctionBody(it->body_, it->scope_);
+
+    Q_->commitSyms();
+
+    // Only once everything is stored may a query skip the lock.
+    unboundBodiesCnt_.fetch_sub(1, std::memory_order_release);
+
+    return true;
+}
+
+void SemanticModel::SemanticModelImpl::typeCheck()
+{
+    TypeChecker tyChecker(Q_, tree_);
+    tyChecker.typeCheck(fileScope_);
+}
+
+namespace {
+
+std::vector<const DeclarationSyntax*> externalDeclarations(const TranslationUnitSyntax* node)
+{
+    std::vector<const DeclarationSyntax*> decls;
+    for (auto declIt = node->declarations(); declIt; declIt = declIt->next)
+        decls.push_back(declIt->value);
+    return decls;
+}
+
+/*
+ * The text of each external declaration: from its first token up to the
+ * first token of the next one (or the end of the text).
+ */
+std::vector<std::string_view> textsOf(const SyntaxTree* tree,
+                                      const std::vector<const DeclarationSyntax*>& decls)
+{
+    std::string_view text = tree->text().rawText();
+    std::vector<std::string_view> texts(decls.size());
+    auto end = text.size();
+    for (auto i = decls.size(); i-- > 0; ) {
+        auto tk = decls[i]->firstToken();
+        if (!tk.isValid())
+            continue;
+        auto start = std::min<std::size_t>(tk.span().start(), end);
+        texts[i] = text.substr(start, end - start);
+        end = start;
+    }
+    return texts;
+}
+
+bool declaresTypedef(const DeclarationSyntax* decl)
+{
+    auto varAndOrFunDecl = decl->asVariableAndOrFunctionDeclaration();
+    if (!varAndOrFunDecl)
+        return false;
+
+    for (auto specIt = varAndOrFunDecl->specifiers(); specIt; specIt = specIt->next) {
+        if (specIt->value->kind() == TypedefStorageClass)
+            return true;
+    }
+    return false;
+}
+
+} // anonymous
+
+/*
+ * Compute this SemanticModel from that of the SyntaxTree being replaced:
+ * the symbols (and scopes) of every external declaration whose text is
+ * unchanged are carried over; those of the remaining ones are evicted from
+ * the Assembly, and the corresponding declarations are bound anew. The
+ * storage of the evicted symbols is reclaimed once the SemanticModel that
+ * owns it is replaced by one that's computed from scratch.
+ *
+ * The nodes of an external declaration are created in sequence, so, if its
+ * text is unchanged, the ordinal of a node in the new tree differs from
+ * that in the old tree by the same amount as that of the declaration. But
+ * because the disambiguation of the syntax depends on typedefs, a change to
+ * a typedef declaration falls back to binding the whole tree.
+ *
+ * The types of expressions aren't carried over: that of an expression within
+ * an unchanged declaration may depend on a changed one.
+ */
+void SemanticModel::SemanticModelImpl::rebindIncrementally(SemanticModelImpl* oldP)
+{
+    auto oldTU = oldP->tree_->translationUnitRoot();
+    auto newTU = tree_->translationUnitRoot();
+    auto libSym = oldTU ? oldP->storedDeclSymAt(oldTU) : nullptr;
+
+    std::vector<const DeclarationSyntax*> oldDecls;
+    std::vector<const DeclarationSyntax*> newDecls;
+    std::vector<std::size_t> keptFrom;
+    std::vector<bool> isKept;
+    auto matchDecls = [&] () {
+        oldDecls = externalDeclarations(oldTU);
+        newDecls = externalDeclarations(newTU);
+        // The texts are kept for a subsequent replacement.
+        if (oldP->extDeclTexts_.size() != oldDecls.size())
+            oldP->extDeclTexts_ = textsOf(oldP->tree_, oldDecls);
+        const auto& oldTexts = oldP->extDeclTexts_;
+        extDeclTexts_ = textsOf(tree_, newDecls);
+        const auto& newTexts = extDeclTexts_;
+
+        // The candidates are taken (from the back) in source order.
+        std::unordered_map<std::string_view, std::vector<std::size_t>> oldDeclsByText;
+        for (auto i = oldDecls.size(); i-- > 0; ) {
+            if (!oldTexts[i].empty())
+                oldDeclsByText[oldTexts[i]].push_back(i);
+        }
+
+        keptFrom.assign(newDecls.size(), kNoExtDecl);
+        isKept.assign(oldDecls.size(), false);
+        for (std::size_t j = 0; j < newDecls.size(); ++j) {
+            auto it = oldDeclsByText.find(newTexts[j]);
+            if (it == oldDeclsByText.end() || it->second.empty()) {
+                if (declaresTypedef(newDecls[j]))
+                    return false;
+                continue;
+            }
+            keptFrom[j] = it->second.back();
+            isKept[keptFrom[j]] = true;
+            it->second.pop_back();
+        }
+        for (std::size_t i = 0; i < oldDecls.size(); ++i) {
+            if (!isKept[i] && declaresTypedef(oldDecls[i]))
+                return false;
+        }
+        return true;
+    };
+
+    // The Arenas of the old SemanticModel are carried over (since they own
+    // the kept symbols and scopes) unless it's worth to release them: when
+    // the evicted symbols, which they also own, outnumber the kept ones, or
+    // when there're already too many of them.
+    auto releasesArenas = [&] () {
+        auto evictedCnt = oldP->evictedSymsCnt_;
+        auto keptCnt = oldP->unitSyms_.size();
+        for (std::size_t i = 0; i < oldP->extDeclRecs_.size() && i < oldDecls.size(); ++i) {
+            if (isKept[i])
+                keptCnt += oldP->extDeclRecs_[i].syms_.size();
+            else
+                evictedCnt += oldP->extDeclRecs_[i].syms_.size();
+        }
+        if (evictedCnt > keptCnt || oldP->arenas_.size() >= kMaxArenasCnt)
+            return true;
+        evictedSymsCnt_ = evictedCnt;
+        return false;
+    };
+
+    if (!newTU
+            || !libSym
+            || !oldP->fileScope_
+            || !matchDecls()
+            || releasesArenas()) {
+        std::unordered_set<const Symbol*> evictedSyms(oldP->unitSyms_.begin(), oldP->unitSyms_.end());
+        for (const auto& rec : oldP->extDeclRecs_)
+            evictedSyms.insert(rec.syms_.begin(), rec.syms_.end());
+        compilation_->assembly()->evictSyms(evictedSyms);
+
+        Binder binder(Q_, tree_);
+        binder.bind();
+        typeCheck();
+        return;
+    }
+
+    auto arena = std::move(arenas_.back());
+    arenas_ = std::move(oldP->arenas_);
+    arenas_.push_back(std::move(arena));
+
+    oldP->extDeclRecs_.resize(oldDecls.size());
+    extDeclRecs_.resize(newDecls.size());
+
+    std::unordered_map<std::size_t, std::vector<const DeferredBody*>> unboundBodies;
+    for (const auto& deferred : oldP->deferredBodies_) {
+        if (!deferred.bound_)
+            unboundBodies[deferred.extDeclIdx_].push_back(&deferred);
+    }
+
+    for (std::size_t j = 0; j < newDecls.size(); ++j) {
+        auto i = keptFrom[j];
+        if (i == kNoExtDecl)
+            continue;
+
+        auto& rec = extDeclRecs_[j];
+        rec = std::move(oldP->extDeclRecs_[i]);
+        for (auto sym : rec.syms_)
+            sym->setSyntaxTree(tree_);
+
+        auto delta = static_cast<long long>(newDecls[j]->ordinal()) - oldDecls[i]->ordinal();
+        for (const auto& [ordinal, sym] : rec.declSyms_) {
+            auto idx = static_cast<std::size_t>(ordinal + delta);
+            if (idx >= declSyms_.size())
+                declSyms_.resize(idx + 1, nullptr);
+            declSyms_[idx] = sym;
+        }
+        for (auto& ordinal : rec.declSyms_)
+            ordinal.first = static_cast<unsigned int>(ordinal.first + delta);
+
+        for (auto sym : rec.syms_)
+            reindexMember(sym);
+
+        auto it = unboundBodies.find(i);
+        if (it == unboundBodies.end())
+            continue;
+        auto body = newDecls[j]->asFunctionDefinition()->body()->asCompoundStatement();
+        for (auto deferred : it->second) {
+            deferredBodies_.push_back({ body,
+                                        deferred->scope_,
+                                        deferred->containingSym_,
+                                        j,
+                                        body->firstToken().span().start(),
+                                        body->lastToken().span().end(),
+                                        false });
+            ++unboundBodiesCnt_;
+        }
+    }
+
+    std::unordered_set<const Symbol*> evictedSyms;
+    std::unordered_set<const Scope*> evictedScopes;
+    for (std::size_t i = 0; i < oldDecls.size(); ++i) {
+        if (isKept[i])
+            continue;
+        const auto& rec = oldP->extDeclRecs_[i];
+        evictedSyms.insert(rec.syms_.begin(), rec.syms_.end());
+        evictedScopes.insert(rec.scopes_.begin(), rec.scopes_.end());
+    }
+    compilation_->assembly()->evictSyms(evictedSyms);
+
+    fileScope_ = oldP->fileScope_;
+    fileScope_->detachEnclosedScopes([&evictedScopes] (const Scope* scope) {
+        return evictedScopes.count(scope) != 0;
+    });
+    fileScope_->rekeyIdentifiers([this, &evictedSyms] (const Identifier* ident, const Symbol* sym) {
+        return evictedSyms.count(sym) ? nullptr
+                                      : tree_->findIdentifier(ident->c_str(), ident->size());
+    });
+
+    unitSyms_ = std::move(oldP->unitSyms_);
+    for (auto sym : unitSyms_)
+        sym->setSyntaxTree(tree_);
+    declSyms_[newTU->ordinal()] = libSym;
+
+    Binder binder(Q_, tree_);
+    for (std::size_t j = 0; j < newDecls.size(); ++j) {
+        if (keptFrom[j] != kNoExtDecl)
+            continue;
+        curExtDeclIdx_ = j;
+        binder.bindExternalDeclaration(newDecls[j], fileScope_, libSym);
+    }
+    curExtDeclIdx_ = kNoExtDecl;
+
+    std::sort(deferredBodies_.begin(),
+              deferredBodies_.end(),
+              [] (const DeferredBody& a, const DeferredBody& b) {
+                  return a.start_ < b.start_;
+              });
+
+    typeCheck();
+}
+
 SemanticModel::SemanticModel(const SyntaxTree* tree, Compilation* compilation)
-    : P(new SemanticModelImpl(tree, compilation))
+    : P(new SemanticModelImpl(this, tree, compilation))
 {
     Binder binder(this, tree);
     binder.bind();
+
+    P->typeCheck();
+}
+
+SemanticModel::SemanticModel(const SyntaxTree* tree,
+                             Compilation* compilation,
+                             SemanticModel* oldSemaModel)
+    : P(new SemanticModelImpl(this, tree, compilation))
+{
+    P->rebindIncrementally(oldSemaModel->P.get());
 }
 
 SemanticModel::~SemanticModel()
@@ -87,13 +560,13 @@ const SymCastT* SemanticModel::castSym(const SymOriT* symOri,
 
 const LibrarySymbol* SemanticModel::declaredSymbol(const TranslationUnitSyntax* node) const
 {
-    auto it = P->declSyms_.find(node);
-    if (it == P->declSyms_.end()) {
+    auto sym = P->declSymAt(node);
+    if (!sym) {
         PSY_ASSERT_NO_STMT(!P->expectValidSyms_);
         return nullptr;
     }
 
-    auto libSym = castSym(it->second, &Symbol::asLibrary);
+    auto libSym = castSym(sym, &Symbol::asLibrary);
     if (!libSym)
         return nullptr;
 
@@ -132,13 +605,13 @@ const ParameterSymbol* SemanticModel::declaredSymbol(const ParameterDeclarationS
 
 const NamedTypeSymbol* SemanticModel::declaredSymbol(const TypeDeclarationSyntax* node) const
 {
-    auto it = P->declSyms_.find(node);
-    if (it == P->declSyms_.end()) {
+    auto sym = P->declSymAt(node);
+    if (!sym) {
         PSY_ASSERT_NO_STMT(!P->expectValidSyms_);
         return nullptr;
     }
 
-    auto tySym = castSym(it->second, &Symbol::asType);
+    auto tySym = castSym(sym, &Symbol::asType);
     if (!tySym)
         return nullptr;
 
@@ -151,13 +624,13 @@ const NamedTypeSymbol* SemanticModel::declaredSymbol(const TypeDeclarationSyntax
 
 const EnumeratorSymbol* SemanticModel::declaredSymbol(const EnumeratorDeclarationSyntax* node) const
 {
-    auto it = P->declSyms_.find(node);
-    if (it == P->declSyms_.end()) {
+    auto sym = P->declSymAt(node);
+    if (!sym) {
         PSY_ASSERT_NO_STMT(!P->expectValidSyms_);
         return nullptr;
     }
 
-    auto valSym = castSym(it->second, &Symbol::asValue);
+    auto valSym = castSym(sym, &Symbol::asValue);
     if (!valSym)
         return nullptr;
 
@@ -210,30 +683,157 @@ const Symbol* SemanticModel::declaredSymbol(const DeclaratorSyntax* node) const
     auto node_P = SyntaxUtilities::strippedDeclaratorOrSelf(node);
     auto node_PP = SyntaxUtilities::innermostDeclaratorOrSelf(node_P);
 
-    auto it = P->declSyms_.find(node_PP);
-    if (it == P->declSyms_.end()) {
+    auto sym = P->declSymAt(node_PP);
+    if (!sym) {
         PSY_ASSERT_NO_STMT(!P->expectValidSyms_);
         return nullptr;
     }
 
-    return it->second;
+    return sym;
+}
+
+const TypeSymbol* SemanticModel::typeOf(const ExpressionSyntax* node) const
+{
+    return P->exprTySymAt(node);
+}
+
+Arena* SemanticModel::symbolArena() const
+{
+    return P->arenas_.back().get();
+}
+
+void SemanticModel::commitSyms()
+{
+    auto assembly = P->compilation_->assembly();
+    for (auto sym : P->pendingSymDEFs_)
+        assembly->addSymDEF(sym);
+    for (const auto& [name, nsK, sym] : P->pendingNames_)
+        assembly->indexSymDEF(name, nsK, sym);
+
+    P->pendingSymDEFs_.clear();
+    P->pendingNames_.clear();
+
+    P->compilation_->typeInterner()->commitUses(&P->tyUses_);
+}
+
+void SemanticModel::deferFunctionBody(const CompoundStatementSyntax* body,
+                                      Scope* scope,
+                                      Symbol* containingSym)
+{
+    P->deferredBodies_.push_back({ body,
+                                   scope,
+                                   containingSym,
+                                   P->curExtDeclIdx_,
+                                   body->firstToken().span().start(),
+                                   body->lastToken().span().end(),
+                                   false });
+    ++P->unboundBodiesCnt_;
+}
+
+/*
+ * Whether the given function body is deferred and not yet bound.
+ */
+bool SemanticModel::isFunctionBodyDeferred(const CompoundStatementSyntax* body) const
+{
+    if (!P->unboundBodiesCnt_)
+        return false;
+
+    auto tk = body->firstToken();
+    if (!tk.isValid())
+        return false;
+
+    auto offset = tk.span().start();
+    auto it = std::lower_bound(P->deferredBodies_.begin(),
+                               P->deferredBodies_.end(),
+                               offset,
+                               [] (const SemanticModelImpl::DeferredBody& deferred, unsigned int offset) {
+                                   return deferred.start_ < offset;
+                               });
+    return it != P->deferredBodies_.end() && it->body_ == body && !it->bound_;
+}
+
+void SemanticModel::enterExternalDeclaration(std::size_t declIdx)
+{
+    P->curExtDeclIdx_ = declIdx;
+}
+
+void SemanticModel::exitExternalDeclarations()
+{
+    P->curExtDeclIdx_ = SemanticModelImpl::kNoExtDecl;
+}
+
+Symbol* SemanticModel::storeDeclaredSym(const SyntaxNode* node, Symbol* sym)
+{
+    P->pendingSymDEFs_.push_back(sym);
+    if (auto rec = P->currentRecord()) {
+        rec->syms_.push_back(sym);
+        rec->declSyms_.emplace_back(node->ordinal(), sym);
+    } else {
+        P->unitSyms_.push_back(sym);
+    }
+
+    auto idx = node->ordinal();
+    if (idx >= P->declSyms_.size())
+        P->declSyms_.resize(idx + 1, nullptr);
+    PSY_ASSERT(!P->declSyms_[idx], return sym);
+    P->declSyms_[idx] = sym;
+
+    return sym;
 }
 
-Symbol* SemanticModel::storeDeclaredSym(const SyntaxNode* node, std::unique_ptr<Symbol> sym)
+const Symbol* SemanticModel::storedDeclaredSym(const SyntaxNode* node) const
 {
-    auto& allSyms = P->compilation_->assembly()->symDEFs_;
-    auto [it, _] = allSyms.insert(std::move(sym));
-    Symbol* rawSym = it->get();
+    return P->storedDeclSymAt(node);
+}
 
-    PSY_ASSERT(P->declSyms_.count(node) == 0, return rawSym);
-    P->declSyms_[node] = rawSym;
+const TypeSymbol* SemanticModel::canonicalizeType(const TypeSymbol* tySym)
+{
+    return P->compilation_->typeInterner()->intern(tySym, &P->tyUses_);
+}
 
-    return rawSym;
+TypeInterner* SemanticModel::typeInterner() const
+{
+    return P->compilation_->typeInterner();
+}
+
+TypeUses* SemanticModel::typeUses()
+{
+    return &P->tyUses_;
+}
+
+void SemanticModel::storeExprType(const ExpressionSyntax* node, const TypeSymbol* tySym)
+{
+    auto idx = node->ordinal();
+    if (idx >= P->exprTySyms_.size())
+        P->exprTySyms_.resize(idx + 1, nullptr);
+    P->exprTySyms_[idx] = tySym;
+}
+
+const FieldSymbol* SemanticModel::memberOf(const TypeSymbol* tySym, const Identifier* ident) const
+{
+    auto defIt = P->tagDefs_.find(tySym);
+    if (defIt == P->tagDefs_.end())
+        return nullptr;
+
+    auto fldSymsIt = P->membersOf_.find(defIt->second);
+    if (fldSymsIt == P->membersOf_.end())
+        return nullptr;
+
+    auto it = fldSymsIt->second.find(ident);
+    return it == fldSymsIt->second.end() ? nullptr : it->second;
+}
+
+void SemanticModel::storeScope(Scope* scope)
+{
+    if (auto rec = P->currentRecord())
+        rec->scopes_.push_back(scope);
+    else if (scope->kind() == ScopeKind::File)
+        P->fileScope_ = scope;
 }
 
-Symbol* SemanticModel::storeUsedSym(std::unique_ptr<Symbol> sym)
+void SemanticModel::indexDeclaredSym(const Identifier* ident, NameSpaceKind nsK, const Symbol* sym)
 {
-    auto& syms = P->compilation_->assembly()->symUSEs_;
-    syms.emplace_back(sym.release());
-    return syms.back().get();
+    if (nsK == NameSpaceKind::Members)
+        P->indexMember(ident, sym);
+    P->pendingNames_.emplace_back(std::string(ident->c_str(), ident->size()), nsK, sym);
 }
@@ -24,15 +24,19 @@
 #include "API.h"
 #include "Fwds.h"
 
+#include "binder/NameSpaceKind.h"
+
 #include "../common/infra/InternalAccess.h"
 #include "../common/infra/Pimpl.h"
 
+#include <cstddef>
 #include <vector>
 
 namespace psy {
 namespace C {
 
 class Binder;
+struct TypeUses;
 
 /**
  * \brief The SemanticModel class.
@@ -82,14 +86,39 @@ public:
     const Symbol* declaredSymbol(const DeclaratorSyntax* node) const;
     //!@}
 
+    /**
+     * The TypeSymbol of ExpressionSyntax \p node (or \c nullptr, if its type
+     * couldn't be determined).
+     *
+     * \remark The TypeSymbol is canonical (see Compilation).
+     */
+    const TypeSymbol* typeOf(const ExpressionSyntax* node) const;
+
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(Binder);
     PSY_GRANT_ACCESS(Compilation);
+    PSY_GRANT_ACCESS(TypeChecker);
 
     SemanticModel(const SyntaxTree* tree, Compilation* compilation);
-
-    Symbol* storeDeclaredSym(const SyntaxNode* node, std::unique_ptr<Symbol> sym);
-    Symbol* storeUsedSym(std::unique_ptr<Symbol> sym);
+    SemanticModel(const SyntaxTree* tree, Compilation* compilation, SemanticModel* oldSemaModel);
+
+    void commitSyms();
+    void deferFunctionBody(const CompoundStatementSyntax* body, Scope* scope, Symbol* containingSym);
+    bool isFunctionBodyDeferred(const CompoundStatementSyntax* body) const;
+
+    void enterExternalDeclaration(std::size_t declIdx);
+    void exitExternalDeclarations();
+
+    Arena* symbolArena() const;
+    Symbol* storeDeclaredSym(const SyntaxNode* node, Symbol* sym);
+    const Symbol* storedDeclaredSym(const SyntaxNode* node) const;
+    const TypeSymbol* canonicalizeType(const TypeSymbol* tySym);
+    TypeInterner* typeInterner() const;
+    TypeUses* typeUses();
+    void storeExprType(const ExpressionSyntax* node, const TypeSymbol* tySym);
+    const FieldSymbol* memberOf(const TypeSymbol* tySym, const Identifier* ident) const;
+    void storeScope(Scope* scope);
+    void indexDeclaredSym(const Identifier* ident, NameSpaceKind nsK, const Symbol* sym);
 
     template <class SymCastT, class SymOriT> const SymCastT* castSym(
             const SymOriT* sym,
@@ -0,0 +1,390 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "TypeInterner.h"
+
+#include "Assembly.h"
+
+#include "symbols/Symbol_ALL.h"
+#include "symbols/SymbolName_ALL.h"
+
+#include "../common/infra/Assertions.h"
+
+#include <functional>
+
+using namespace psy;
+using namespace C;
+
+namespace {
+
+enum : std::uint8_t
+{
+    Const = 1 << 0,
+    Volatile = 1 << 1,
+    Restrict = 1 << 2,
+    ArrayDecay = 1 << 3,
+    FunctionDecay = 1 << 4
+};
+
+} // anonymous
+
+TypeInterner::Key::Key(TypeKind tyK)
+    : tyK_(tyK)
+    , bits_(0)
+    , namedTyK_(NamedTypeKind::UNSPECIFIED)
+    , builtTyK_(BuiltinTypeKind::UNSPECIFIED)
+    , tySym_(nullptr)
+    , scope_(nullptr)
+{}
+
+bool TypeInterner::Key::operator==(const Key& other) const
+{
+    return tyK_ == other.tyK_
+            && bits_ == other.bits_
+            && namedTyK_ == other.namedTyK_
+            && builtTyK_ == other.builtTyK_
+            && tySym_ == other.tySym_
+            && scope_ == other.scope_
+            && name_ == other.name_
+            && parmTySyms_ == other.parmTySyms_;
+}
+
+std::size_t TypeInterner::KeyHash::operator()(const Key& key) const
+{
+    std::size_t h = static_cast<std::size_t>(key.tyK_)
+            ^ (static_cast<std::size_t>(key.bits_) << 4)
+            ^ (static_cast<std::size_t>(key.namedTyK_) << 12)
+            ^ (static_cast<std::size_t>(key.builtTyK_) << 16);
+    h ^= std::hash<const TypeSymbol*>()(key.tySym_) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    h ^= std::hash<const Scope*>()(key.scope_) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    if (!key.name_.empty())
+        h ^= std::hash<std::string>()(key.name_) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    for (auto tySym : key.parmTySyms_)
+        h ^= std::hash<const TypeSymbol*>()(tySym) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return h;
+}
+
+TypeInterner::TypeInterner(Assembly* assembly)
+    : assembly_(assembly)
+{}
+
+std::size_t TypeInterner::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return canonTySyms_.size();
+}
+
+const TypeSymbol* TypeInterner::intern(const TypeSymbol* tySym, TypeUses* uses)
+{
+    PSY_ASSERT(tySym, return nullptr);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    return intern_(tySym, uses);
+}
+
+const TypeSymbol* TypeInterner::builtinType(BuiltinTypeKind builtTyK, TypeUses* uses)
+{
+    Key key(TypeKind::Named);
+    key.namedTyK_ = NamedTypeKind::Builtin;
+    key.builtTyK_ = builtTyK;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    return canonical_(std::move(key), uses);
+}
+
+const TypeSymbol* TypeInterner::tagType(TagSymbolName::TagChoice tagChoice,
+                                        const std::string& tag,
+                                        const Scope* scope,
+                                        TypeUses* uses)
+{
+    Key key(TypeKind::Named);
+    switch (tagChoice) {
+        case TagSymbolName::TagChoice::Struct:
+            key.namedTyK_ = NamedTypeKind::Structure;
+            break;
+        case TagSymbolName::TagChoice::Union:
+            key.namedTyK_ = NamedTypeKind::Union;
+            break;
+        case TagSymbolName::TagChoice::Enum:
+            key.namedTyK_ = NamedTypeKind::Enumeration;
+            break;
+        default:
+            PSY_ESCAPE_VIA_RETURN(nullptr);
+    }
+    key.name_ = tag;
+    key.scope_ = scope;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    return canonical_(std::move(key), uses);
+}
+
+const TypeSymbol* TypeInterner::synonymType(const std::string& name, TypeUses* uses)
+{
+    Key key(TypeKind::Named);
+    key.namedTyK_ = NamedTypeKind::Synonym;
+    key.name_ = name;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    return canonical_(std::move(key), uses);
+}
+
+const TypeSymbol* TypeInterner::pointerType(const TypeSymbol* refedTySym, TypeUses* uses)
+{
+    PSY_ASSERT(refedTySym, return nullptr);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Key key(TypeKind::Pointer);
+    key.tySym_ = intern_(refedTySym, uses);
+    return canonical_(std::move(key), uses);
+}
+
+const TypeSymbol* TypeInterner::arrayType(const TypeSymbol* elemTySym, TypeUses* uses)
+{
+    PSY_ASSERT(elemTySym, return nullptr);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Key key(TypeKind::Array);
+    key.tySym_ = intern_(elemTySym, uses);
+    return canonical_(std::move(key), uses);
+}
+
+const TypeSymbol* TypeInterner::unqualifiedType(const TypeSymbol* tySym, TypeUses* uses)
+{
+    PSY_ASSERT(tySym, return nullptr);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!(tySym->isConstQualified()
+            || tySym->isVolatileQualified()
+            || tySym->isRestrictQualified())) {
+        return intern_(tySym, uses);
+    }
+    auto key = keyOf(tySym, uses);
+    key.bits_ &= ~(Const | Volatile | Restrict);
+    return canonical_(std::move(key), uses);
+}
+
+const TypeSymbol* TypeInterner::constQualifiedType(const TypeSymbol* tySym, TypeUses* uses)
+{
+    PSY_ASSERT(tySym, return nullptr);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto key = keyOf(tySym, uses);
+    key.bits_ |= Const;
+    return canonical_(std::move(key), uses);
+}
+
+const TypeSymbol* TypeInterner::intern_(const TypeSymbol* tySym, TypeUses* uses)
+{
+    if (!tySym)
+        return nullptr;
+    if (canonTySyms_.count(tySym))
+        return use(tySym, uses);
+
+    return canonical_(keyOf(tySym, uses), uses);
+}
+
+TypeInterner::Key TypeInterner::keyOf(const TypeSymbol* tySym, TypeUses* uses)
+{
+    Key key(tySym->typeKind());
+    key.bits_ = (tySym->isConstQualified() ? Const : 0)
+            | (tySym->isVolatileQualified() ? Volatile : 0)
+            | (tySym->isRestrictQualified() ? Restrict : 0);
+
+    switch (key.tyK_) {
+        case TypeKind::Array:
+            key.tySym_ = intern_(tySym->asArrayType()->elementType(), uses);
+            break;
+
+        case TypeKind::Function: {
+            auto funcTySym = tySym->asFunctionType();
+            key.tySym_ = intern_(funcTySym->returnType(), uses);
+            for (auto parmTySym : funcTySym->parameterTypes())
+                key.parmTySyms_.push_back(intern_(parmTySym, uses));
+            break;
+        }
+
+        case TypeKind::Named: {
+            auto namedTySym = tySym->asNamedType();
+            if (namedTySym->resolvedSynonym()) {
+                auto bits = key.bits_;
+                key = keyOf(intern_(namedTySym->resolvedSynonym(), uses), uses);
+                key.bits_ |= bits;
+                break;
+            }
+            key.namedTyK_ = namedTySym->namedTypeKind();
+            if (key.namedTyK_ == NamedTypeKind::Builtin) {
+                key.builtTyK_ = namedTySym->builtinTypeKind();
+            } else if (namedTySym->name()) {
+                key.name_ = namedTySym->name()->text();
+                // The text of a tag name is prefixed by its tag choice.
+                if (namedTySym->name()->asTagSymbolName()) {
+                    key.name_ = key.name_.substr(key.name_.find(' ') + 1);
+                    auto it = canonTySyms_.find(tySym);
+                    key.scope_ = it != canonTySyms_.end() ? it->second.scope_
+                                                          : namedTySym->scope();
+                }
+            }
+            break;
+        }
+
+        case TypeKind::Pointer: {
+            auto ptrTySym = tySym->asPointerType();
+            if (ptrTySym->arisesFromArrayDecay())
+                key.bits_ |= ArrayDecay;
+            if (ptrTySym->arisesFromFunctionDecay())
+                key.bits_ |= FunctionDecay;
+            key.tySym_ = intern_(ptrTySym->referencedType(), uses);
+            break;
+        }
+
+        default:
+            PSY_ESCAPE_VIA_RETURN(key);
+    }
+
+    return key;
+}
+
+const TypeSymbol* TypeInterner::canonical_(Key&& key, TypeUses* uses)
+{
+    auto it = tySyms_.find(key);
+    if (it != tySyms_.end())
+        return use(it->second, uses);
+
+    auto canonTySym = make(key);
+    if (!canonTySym)
+        return nullptr;
+
+    canonTySyms_.emplace(canonTySym, Canon{ key.scope_, false });
+    tySyms_.emplace(std::move(key), canonTySym);
+
+    return use(canonTySym, uses);
+}
+
+const TypeSymbol* TypeInterner::use(const TypeSymbol* tySym, TypeUses* uses)
+{
+    if (uses && uses->seen_.insert(tySym).second)
+        uses->tySyms_.push_back(tySym);
+    return tySym;
+}
+
+void TypeInterner::commitUses(TypeUses* uses)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto tySym : uses->tySyms_) {
+        auto& isUsed = canonTySyms_[tySym].isUsed_;
+        if (isUsed)
+            continue;
+        isUsed = true;
+        assembly_->addSymUSE(const_cast<TypeSymbol*>(tySym));
+    }
+    uses->tySyms_.clear();
+}
+
+/*
+ * A canonical TypeSymbol doesn't belong to a SyntaxTree nor to a Scope:
+ * it's shared by all declarations of its type.
+ */
+TypeSymbol* TypeInterner::make(const Key& key)
+{
+    TypeSymbol* canonTySym = nullptr;
+    switch (key.tyK_) {
+        case TypeKind::Array:
+            canonTySym = new (&arena_) ArrayTypeSymbol(&arena_,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       key.tySym_);
+            break;
+
+        case TypeKind::Function: {
+            auto funcTySym = new (&arena_) FunctionTypeSymbol(&arena_,
+                                                              nullptr,
+                                                              nullptr,
+                                                              nullptr,
+                                                              key.tySym_);
+            for (auto parmTySym : key.parmTySyms_)
+                funcTySym->addParameter(parmTySym);
+            canonTySym = funcTySym;
+            break;
+        }
+
+        case TypeKind::Named:
+            switch (key.namedTyK_) {
+                case NamedTypeKind::Builtin:
+                    canonTySym = new (&arena_) NamedTypeSymbol(&arena_,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               key.builtTyK_);
+                    break;
+
+                case NamedTypeKind::Structure:
+                case NamedTypeKind::Union:
+                case NamedTypeKind::Enumeration:
+                    canonTySym = new (&arena_) NamedTypeSymbol(
+                                &arena_,
+                                nullptr,
+                                nullptr,
+                                nullptr,
+                                key.namedTyK_ == NamedTypeKind::Structure
+                                    ? TagSymbolName::TagChoice::Struct
+                                    : key.namedTyK_ == NamedTypeKind::Union
+                                        ? TagSymbolName::TagChoice::Union
+                                        : TagSymbolName::TagChoice::Enum,
+                                key.name_);
+                    break;
+
+                default:
+                    canonTySym = new (&arena_) NamedTypeSymbol(&arena_,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               key.name_);
+                    break;
+            }
+            break;
+
+        case TypeKind::Pointer: {
+            auto ptrTySym = new (&arena_) PointerTypeSymbol(&arena_,
+                                                            nullptr,
+                                                            nullptr,
+                                                            nullptr,
+                                                            key.tySym_);
+            if (key.bits_ & ArrayDecay)
+                ptrTySym->markAsArisingFromArrayDecay();
+            if (key.bits_ & FunctionDecay)
+                ptrTySym->markAsArisingFromFunctionDecay();
+            canonTySym = ptrTySym;
+            break;
+        }
+
+        default:
+            PSY_ESCAPE_VIA_RETURN(nullptr);
+    }
+
+    if (key.bits_ & Const)
+        canonTySym->qualifyWithConst();
+    if (key.bits_ & Volatile)
+        canonTySym->qualifyWithVolatile();
+    if (key.bits_ & Restrict)
+        canonTySym->qualifyWithRestrict();
+
+    return canonTySym;
+}
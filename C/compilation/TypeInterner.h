@@ -0,0 +1,167 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_TYPE_INTERNER_H__
+#define PSYCHE_C_TYPE_INTERNER_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "infra/Arena.h"
+#include "symbols/SymbolName_Tag.h"
+#include "symbols/TypeKind_Builtin.h"
+#include "symbols/TypeKind_Named.h"
+#include "symbols/TypeKind.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace psy {
+namespace C {
+
+/**
+ * The canonical TypeSymbols obtained (by a SemanticModel), in the order
+ * in which they're first obtained, until they're used by the Assembly.
+ */
+struct PSY_C_NON_API TypeUses
+{
+    std::vector<const TypeSymbol*> tySyms_;
+    std::unordered_set<const TypeSymbol*> seen_;
+};
+
+/**
+ * \brief The TypeInterner class.
+ *
+ * The canonical TypeSymbols of a Compilation: structurally identical
+ * types (qualifiers included) are interned into a single TypeSymbol,
+ * so that type identity is pointer equality.
+ *
+ * \remark A TypeSymbol is interned only once complete, given that the
+ * Binder amends it (e.g., with qualifiers and parameters) after creation.
+ *
+ * \remark A tag type is identified by the Scope in which its tag is
+ * declared, and a synonym whose typedef is resolved is interned as the
+ * type that it designates.
+ */
+class PSY_C_NON_API TypeInterner
+{
+public:
+    TypeInterner(Assembly* assembly);
+
+    // Unavailable
+    TypeInterner(const TypeInterner&) = delete;
+    void operator=(const TypeInterner&) = delete;
+
+    /**
+     * The canonical TypeSymbol of \p tySym.
+     */
+    const TypeSymbol* intern(const TypeSymbol* tySym, TypeUses* uses);
+
+    //!@{
+    /**
+     * The canonical TypeSymbol of a type (made up of canonical TypeSymbols).
+     */
+    const TypeSymbol* builtinType(BuiltinTypeKind builtTyK, TypeUses* uses);
+    const TypeSymbol* tagType(TagSymbolName::TagChoice tagChoice,
+                              const std::string& tag,
+                              const Scope* scope,
+                              TypeUses* uses);
+    const TypeSymbol* synonymType(const std::string& name, TypeUses* uses);
+    const TypeSymbol* pointerType(const TypeSymbol* refedTySym, TypeUses* uses);
+    const TypeSymbol* arrayType(const TypeSymbol* elemTySym, TypeUses* uses);
+    //!@}
+
+    //!@{
+    /**
+     * The canonical TypeSymbol of \p tySym, with(out) qualifiers.
+     */
+    const TypeSymbol* unqualifiedType(const TypeSymbol* tySym, TypeUses* uses);
+    const TypeSymbol* constQualifiedType(const TypeSymbol* tySym, TypeUses* uses);
+    //!@}
+
+    /**
+     * Add the canonical TypeSymbols of \p uses, not yet used by the Assembly,
+     * to it (in the order of \p uses).
+     *
+     * \remark The SemanticModels of a Compilation commit their uses in
+     * sequence, so that the Assembly is the same regardless of the order in
+     * which they're computed.
+     */
+    void commitUses(TypeUses* uses);
+
+    /**
+     * The number of canonical TypeSymbols.
+     */
+    std::size_t size() const;
+
+private:
+    struct Key
+    {
+        Key(TypeKind tyK);
+
+        TypeKind tyK_;
+        std::uint8_t bits_;
+        NamedTypeKind namedTyK_;
+        BuiltinTypeKind builtTyK_;
+        const TypeSymbol* tySym_;
+        const Scope* scope_;
+        std::string name_;
+        std::vector<const TypeSymbol*> parmTySyms_;
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const;
+    };
+
+    const TypeSymbol* intern_(const TypeSymbol* tySym, TypeUses* uses);
+    const TypeSymbol* canonical_(Key&& key, TypeUses* uses);
+    Key keyOf(const TypeSymbol* tySym, TypeUses* uses);
+    TypeSymbol* make(const Key& key);
+    static const TypeSymbol* use(const TypeSymbol* tySym, TypeUses* uses);
+
+    mutable std::mutex mutex_;
+    Arena arena_;
+    Assembly* assembly_;
+    std::unordered_map<Key, const TypeSymbol*, KeyHash> tySyms_;
+
+    /*
+     * The Scope of each canonical (tag) TypeSymbol, which isn't one of its
+     * own (the Scope may be released along with its SemanticModel), and
+     * whether it's used by the Assembly.
+     */
+    struct Canon
+    {
+        const Scope* scope_;
+        bool isUsed_;
+    };
+    std::unordered_map<const TypeSymbol*, Canon> canonTySyms_;
+};
+
+} // C
+} // psy
+
+#endif
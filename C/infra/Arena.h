@@ -0,0 +1,97 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_ARENA_H__
+#define PSYCHE_C_ARENA_H__
+
+#include "API.h"
+
+#include "MemoryPool.h"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The Arena class.
+ *
+ * A MemoryPool that, in addition, owns the objects allocated from it:
+ * the destructor of every registered object runs (in reverse order of
+ * registration) when the arena is destroyed; then, the memory is freed
+ * in bulk.
+ */
+class PSY_C_NON_API Arena
+{
+public:
+    Arena();
+    ~Arena();
+
+    // Unavailable
+    Arena(const Arena&) = delete;
+    void operator=(const Arena&) = delete;
+
+    void* allocate(std::size_t size) { return pool_.allocate(size); }
+
+    /**
+     * The MemoryPool of \c this Arena, for Managed objects (which are not
+     * adopted).
+     */
+    MemoryPool* pool() { return &pool_; }
+
+    /**
+     * Register \p obj, allocated from \c this Arena, for destruction.
+     */
+    template <class T> void adopt(T* obj)
+    {
+        static_assert(!std::is_trivially_destructible<T>::value,
+                      "objects of trivially destructible type need not be adopted");
+        auto fin = new (pool_.allocate(sizeof(Finalizer))) Finalizer;
+        fin->obj_ = obj;
+        fin->finalize_ = [] (void* p) { static_cast<T*>(p)->~T(); };
+        fin->next_ = finalizers_;
+        finalizers_ = fin;
+        ++adoptedCnt_;
+    }
+
+    /**
+     * The number of objects adopted by \c this Arena.
+     */
+    std::size_t adoptedCount() const { return adoptedCnt_; }
+
+private:
+    struct Finalizer
+    {
+        void* obj_;
+        void (*finalize_)(void*);
+        Finalizer* next_;
+    };
+
+    MemoryPool pool_;
+    Finalizer* finalizers_;
+    std::size_t adoptedCnt_;
+};
+
+} // C
+} // psy
+
+#endif
@@ -49,14 +49,6 @@ public:
         , next(nullptr)
     {}
 
-    DerivedListT** skipToLast()
-    {
-        DerivedListT** cur = &next;
-        while (*cur)
-            cur = &(*cur)->next;
-        return &(*cur);
-    }
-
     ValueT lastValue() const
     {
         ValueT v = nullptr;
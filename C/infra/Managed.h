@@ -36,7 +36,6 @@ class PSY_C_NON_API Managed
 {
 public:
     Managed();
-    virtual ~Managed();
 
     // Unavailable
     Managed(const Managed&) = delete;
@@ -45,6 +44,13 @@ public:
     void* operator new(size_t size, MemoryPool* pool);
     void operator delete(void*);
     void operator delete(void*, MemoryPool*);
+
+protected:
+    /*
+     * Not virtual: a Managed object is released along with its MemoryPool,
+     * never deleted through a pointer to this base.
+     */
+    ~Managed();
 };
 
 } // C
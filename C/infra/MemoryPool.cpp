@@ -31,8 +31,9 @@ MemoryPool::MemoryPool()
     : blocks_(0)
     , allocatedBlocks_(0)
     , blockCount_(-1)
-    , ptr_(0)\
+    , ptr_(0)
     , end_(0)
+    , largeBlocks_(0)
 {}
 
 MemoryPool::~MemoryPool()
@@ -44,6 +45,12 @@ MemoryPool::~MemoryPool()
         }
         std::free(blocks_);
     }
+
+    while (largeBlocks_) {
+        void* next = *static_cast<void**>(largeBlocks_);
+        std::free(largeBlocks_);
+        largeBlocks_ = next;
+    }
 }
 
 void MemoryPool::reset()
@@ -54,6 +61,9 @@ void MemoryPool::reset()
 
 void* MemoryPool::allocate_helper(size_t size)
 {
+    if (size > BLOCK_SIZE)
+        return allocate_large(size);
+
     if (++blockCount_ == allocatedBlocks_) {
         if (!allocatedBlocks_)
             allocatedBlocks_ = DEFAULT_BLOCK_COUNT;
@@ -78,3 +88,16 @@ void* MemoryPool::allocate_helper(size_t size)
 
     return addr;
 }
+
+/*
+ * An allocation that doesn't fit in a block gets a dedicated one, linked
+ * to the previous such blocks (the current block remains in use).
+ */
+void* MemoryPool::allocate_large(size_t size)
+{
+    void** block = static_cast<void**>(std::malloc(sizeof(void*) + size));
+    *block = largeBlocks_;
+    largeBlocks_ = block;
+
+    return block + 1;
+}
@@ -54,12 +54,14 @@ public:
 
 private:
     void* allocate_helper(size_t size);
+    void* allocate_large(size_t size);
 
     char** blocks_;
     int allocatedBlocks_;
     int blockCount_;
     char* ptr_;
     char* end_;
+    void* largeBlocks_;
 
     enum
     {
@@ -38,6 +38,8 @@ ParseOptions::ParseOptions(LanguageDialect dialect,
     setTreatmentOfIdentifiers(TreatmentOfIdentifiers::Classify);
     setTreatmentOfComments(TreatmentOfComments::None);
     setTreatmentOfAmbiguities(TreatmentOfAmbiguities::DisambiguateAlgorithmicallyOrHeuristically);
+    setTrackingOfTypedefNames(true);
+    setIndexingOfNodesByKind(false);
 }
 
 const LanguageDialect& ParseOptions::dialect() const
@@ -82,3 +84,25 @@ ParseOptions::TreatmentOfAmbiguities ParseOptions::treatmentOfAmbiguities() cons
 {
     return static_cast<TreatmentOfAmbiguities>(BF_.treatmentOfAmbiguities_);
 }
+
+ParseOptions& ParseOptions::setTrackingOfTypedefNames(bool track)
+{
+    BF_.trackingOfTypedefNames_ = track;
+    return *this;
+}
+
+bool ParseOptions::trackingOfTypedefNames() const
+{
+    return BF_.trackingOfTypedefNames_;
+}
+
+ParseOptions& ParseOptions::setIndexingOfNodesByKind(bool index)
+{
+    BF_.indexingOfNodesByKind_ = index;
+    return *this;
+}
+
+bool ParseOptions::indexingOfNodesByKind() const
+{
+    return BF_.indexingOfNodesByKind_;
+}
@@ -113,6 +113,30 @@ public:
     TreatmentOfAmbiguities treatmentOfAmbiguities() const;
     //!@}
 
+    //!@{
+    /**
+     * Whether the type synonyms (\c typedef names) in scope are tracked during
+     * parse, so that ambiguities are disambiguated as they're parsed.
+     *
+     * \remark Tracking only takes place for text whose TextCompleteness is
+     * \c Full and when the TreatmentOfAmbiguities is algorithmic; otherwise,
+     * ambiguities are disambiguated (if so specified) after parse.
+     */
+    ParseOptions& setTrackingOfTypedefNames(bool track);
+    bool trackingOfTypedefNames() const;
+    //!@}
+
+    //!@{
+    /**
+     * Whether the nodes of the SyntaxTree are indexed by SyntaxKind, so
+     * that SyntaxTree::nodesOfKind may be used.
+     *
+     * \remark Indexing is done once, at the end of parse, and is off by default.
+     */
+    ParseOptions& setIndexingOfNodesByKind(bool index);
+    bool indexingOfNodesByKind() const;
+    //!@}
+
 private:
     LanguageDialect dialect_;
     LanguageExtensions extensions_;
@@ -121,7 +145,9 @@ private:
     {
         std::uint16_t treatmentOfIdentifiers_ : 2;
         std::uint16_t treatmentOfComments_ : 2;
-        std::uint16_t treatmentOfAmbiguities_ : 2;
+        std::uint16_t treatmentOfAmbiguities_ : 3;
+        std::uint16_t trackingOfTypedefNames_ : 1;
+        std::uint16_t indexingOfNodesByKind_ : 1;
     };
     union
     {
@@ -31,6 +31,7 @@ int depth_ = 0;
 Parser::Backtracker::Backtracker(Parser* parser, LexedTokens::IndexType tkIdx)
     : parser_(parser)
     , refTkIdx_(tkIdx == 0 ? parser->curTkIdx_ : tkIdx)
+    , tydefNamesMark_(parser->tydefNames_ ? parser->tydefNames_->mark() : 0)
     , done_(false)
 {
     if (parser_->backtracker_)
@@ -78,6 +79,9 @@ void Parser::Backtracker::backtrack()
     else
         parser_->curTkIdx_ = tkCnt - 1;
 
+    if (parser_->tydefNames_)
+        parser_->tydefNames_->restore(tydefNamesMark_);
+
 #ifdef DEBUG_RULE
     std::cerr << "`" << parser_->peek().valueText() << "'  "
               << parser_->curTkIdx_ << std::endl;
@@ -86,6 +90,49 @@ void Parser::Backtracker::backtrack()
     discard();
 }
 
+/* TypedefNameTable */
+
+void Parser::TypedefNameTable::enterScope()
+{
+    scopes_.push_back(declaredIdents_.size());
+}
+
+void Parser::TypedefNameTable::exitScope()
+{
+    PSY_ASSERT_W_MSG(!scopes_.empty(), return, "");
+
+    restore(scopes_.back());
+    scopes_.pop_back();
+}
+
+void Parser::TypedefNameTable::declare(const Identifier* ident, bool isTydef)
+{
+    if (!ident)
+        return;
+
+    ordinaryIdents_[ident].push_back(isTydef);
+    declaredIdents_.push_back(ident);
+}
+
+bool Parser::TypedefNameTable::isTypedefName(const Identifier* ident) const
+{
+    auto it = ordinaryIdents_.find(ident);
+    return it != ordinaryIdents_.end() && !it->second.empty() && it->second.back();
+}
+
+std::size_t Parser::TypedefNameTable::mark() const
+{
+    return declaredIdents_.size();
+}
+
+void Parser::TypedefNameTable::restore(std::size_t mark)
+{
+    while (declaredIdents_.size() > mark) {
+        ordinaryIdents_[declaredIdents_.back()].pop_back();
+        declaredIdents_.pop_back();
+    }
+}
+
 /* DepthControl */
 
 Parser::DepthControl::DepthControl(int& depth)
@@ -105,6 +152,7 @@ Parser::DepthControl::~DepthControl()
 
 Parser::Parser(SyntaxTree* tree)
     : pool_(tree->unitPool())
+    , listPool_(tree->listPool())
     , tree_(tree)
     , backtracker_(nullptr)
     , diagReporter_(this)
@@ -182,6 +230,53 @@ bool Parser::mightBacktrack() const
     return static_cast<bool>(backtracker_);
 }
 
+/**
+ * Track the type synonyms (typedef names) in scope while parsing, so that
+ * an otherwise ambiguous syntax is decided upon immediately.
+ *
+ * \remark This is only sound when the text is complete.
+ */
+void Parser::trackTypedefNames()
+{
+    tydefNames_.reset(new TypedefNameTable);
+}
+
+bool Parser::isTypedefName(const SyntaxToken& tk) const
+{
+    PSY_ASSERT_W_MSG(tydefNames_, return false, "");
+
+    auto lexeme = tk.valueLexeme();
+    return lexeme && tydefNames_->isTypedefName(lexeme->asIdentifier());
+}
+
+void Parser::declareTypedefNameOrName(LexedTokens::IndexType identTkIdx, bool isTydef)
+{
+    if (!tydefNames_)
+        return;
+
+    auto lexeme = tree_->tokenAt(identTkIdx).valueLexeme();
+    if (lexeme)
+        tydefNames_->declare(lexeme->asIdentifier(), isTydef);
+}
+
+void Parser::declareTypedefNameOrName(const DeclaratorSyntax* decltor, bool isTydef)
+{
+    if (!tydefNames_)
+        return;
+
+    while (decltor) {
+        decltor = SyntaxUtilities::strippedDeclaratorOrSelf(decltor);
+        if (decltor->kind() == IdentifierDeclarator) {
+            declareTypedefNameOrName(decltor->asIdentifierDeclarator()->identTkIdx_, isTydef);
+            return;
+        }
+        auto innerDecltor = SyntaxUtilities::innerDeclaratorOrSelf(decltor);
+        if (innerDecltor == decltor)
+            return;
+        decltor = innerDecltor;
+    }
+}
+
 /**
  * Parse the syntax associated to the SyntaxTree used to construct \c this Parser.
  *
@@ -206,6 +301,15 @@ std::vector<
     return std::move(diagReporter_.retainedAmbiguityDiags_);
 }
 
+/**
+ * The (external) declarations of the translation unit within which an ambiguity
+ * was detected; the Reparser can restrict its work to them.
+ */
+std::vector<const DeclarationSyntax*> Parser::releaseDeclarationsWithAmbiguities()
+{
+    return std::move(declsWithAmbigs_);
+}
+
 bool Parser::ignoreDeclarator()
 {
     while (true) {
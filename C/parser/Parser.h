@@ -33,10 +33,13 @@
 
 #include "../common/infra/InternalAccess.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <stack>
 #include <vector>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -61,6 +64,8 @@ PSY_INTERNAL_AND_RESTRICTED:
 
     Parser(SyntaxTree* tree);
 
+    void trackTypedefNames();
+
     TranslationUnitSyntax* parse();
 
     bool detectedAnyAmbiguity() const;
@@ -71,8 +76,22 @@ private:
     void operator=(const Parser&) = delete;
 
     MemoryPool* pool_;
+    MemoryPool* listPool_;
     SyntaxTree* tree_;
 
+    // The cells of a list are allocated in chunks (of increasing size), so
+    // that they're contiguous: a chunk is found through the tail of the list
+    // (i.e., the next of its last cell) to which a cell is appended. Only
+    // the chunks of the lists most recently appended to are kept.
+    struct ListChunk
+    {
+        const void* tail_;
+        char* free_;
+        char* end_;
+        std::size_t cellCnt_;
+    };
+    mutable std::vector<ListChunk> listChunks_;
+
     // While the parser is in backtracking mode, diagnostics are disabled.
     // To avoid unintended omission of syntax errors, the backtracker
     // should be discarded immediately after use, either explicitly or
@@ -87,6 +106,7 @@ private:
 
         Parser* parser_;
         LexedTokens::IndexType refTkIdx_;
+        std::size_t tydefNamesMark_;
         bool done_;
         std::stack<const Backtracker*> chained_;
     };
@@ -94,6 +114,49 @@ private:
     const Backtracker* backtracker_;
     bool mightBacktrack() const;
 
+    // When the text is complete, the type synonyms (typedef names) in scope
+    // are tracked, so that an otherwise ambiguous syntax is decided upon as
+    // it's parsed (no ambiguity node is created). Every declaration of an
+    // ordinary identifier is recorded, since an object declared in an inner
+    // scope hides a type synonym of an outer one; the undo log restores the
+    // table upon a scope exit or a backtrack.
+    struct TypedefNameTable
+    {
+        void enterScope();
+        void exitScope();
+        void declare(const Identifier* ident, bool isTydef);
+        bool isTypedefName(const Identifier* ident) const;
+        std::size_t mark() const;
+        void restore(std::size_t mark);
+
+        std::unordered_map<const Identifier*, std::vector<bool>> ordinaryIdents_;
+        std::vector<const Identifier*> declaredIdents_;
+        std::vector<std::size_t> scopes_;
+    };
+    std::unique_ptr<TypedefNameTable> tydefNames_;
+
+    struct TypedefNameScope
+    {
+        TypedefNameScope(Parser* parser)
+            : tydefNames_(parser->tydefNames_.get())
+        {
+            if (tydefNames_)
+                tydefNames_->enterScope();
+        }
+
+        ~TypedefNameScope()
+        {
+            if (tydefNames_)
+                tydefNames_->exitScope();
+        }
+
+        TypedefNameTable* tydefNames_;
+    };
+
+    bool isTypedefName(const SyntaxToken& tk) const;
+    void declareTypedefNameOrName(LexedTokens::IndexType identTkIdx, bool isTydef);
+    void declareTypedefNameOrName(const DeclaratorSyntax* decltor, bool isTydef);
+
     struct DiagnosticsReporter
     {
         DiagnosticsReporter(Parser* parser)
@@ -203,6 +266,9 @@ private:
         std::pair<DiagnosticDescriptor,
                   LexedTokens::IndexType>> releaseRetainedAmbiguityDiags() const;
 
+    std::vector<const DeclarationSyntax*> declsWithAmbigs_;
+    std::vector<const DeclarationSyntax*> releaseDeclarationsWithAmbiguities();
+
     struct DiagnosticsReporterDelayer
     {
         DiagnosticsReporterDelayer(DiagnosticsReporter* diagReporter,
@@ -275,6 +341,7 @@ private:
     friend StatementContext operator+(StatementContext a, StatementContext b);
 
     template <class NodeT, class... Args> NodeT* makeNode(Args&&... args) const;
+    template <class ListT, class... Args> ListT* makeListNode(ListT** list_cur, Args&&... args) const;
 
     //--------------//
     // Declarations //
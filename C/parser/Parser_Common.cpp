@@ -56,18 +56,22 @@ bool Parser::parseParenthesizedTypeNameOrExpression(TypeReferenceSyntax*& tyRef)
 {
     switch (peek().kind()) {
         case OpenParenToken: {
-            Backtracker BT(this);
-            ExpressionSyntax* expr = nullptr;
-            if (parseExpressionWithPrecedenceUnary(expr)) {
-                auto exprAsTyRef = makeNode<ExpressionAsTypeReferenceSyntax>();
-                tyRef = exprAsTyRef;
-                exprAsTyRef->expr_ = expr;
-                if (expr->kind() == ParenthesizedExpression)
-                    maybeAmbiguateTypeReference(tyRef);
-                return true;
+            if (!(tydefNames_
+                    && peek(2).kind() == IdentifierToken
+                    && isTypedefName(peek(2)))) {
+                Backtracker BT(this);
+                ExpressionSyntax* expr = nullptr;
+                if (parseExpressionWithPrecedenceUnary(expr)) {
+                    auto exprAsTyRef = makeNode<ExpressionAsTypeReferenceSyntax>();
+                    tyRef = exprAsTyRef;
+                    exprAsTyRef->expr_ = expr;
+                    if (!tydefNames_ && expr->kind() == ParenthesizedExpression)
+                        maybeAmbiguateTypeReference(tyRef);
+                    return true;
+                }
+                BT.backtrack();
             }
 
-            BT.backtrack();
             auto openParenTkIdx = consume();
             TypeNameSyntax* typeName = nullptr;
             if (!parseTypeName(typeName))
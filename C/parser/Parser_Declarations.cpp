@@ -38,6 +38,7 @@ void Parser::parseTranslationUnit(TranslationUnitSyntax*& unit)
 
     while (true) {
         DeclarationSyntax* decl = nullptr;
+        auto ambigCnt = diagReporter_.retainedAmbiguityDiags_.size();
         switch (peek().kind()) {
             case EndOfFile:
                 return;
@@ -58,8 +59,11 @@ void Parser::parseTranslationUnit(TranslationUnitSyntax*& unit)
                 continue;
         }
 
-        *declList_cur = makeNode<DeclarationListSyntax>(decl);
+        *declList_cur = makeListNode(declList_cur, decl);
         declList_cur = &(*declList_cur)->next;
+
+        if (decl && diagReporter_.retainedAmbiguityDiags_.size() != ambigCnt)
+            declsWithAmbigs_.push_back(decl);
     }
 
     diagReporter_.diagnoseDelayed();
@@ -256,12 +260,23 @@ bool Parser::parseDeclarationOrFunctionDefinition_AtFollowOfSpecifiers(
     DeclaratorListSyntax* decltorList = nullptr;
     DeclaratorListSyntax** decltorList_cur = &decltorList;
 
+    bool isTydef = false;
+    if (tydefNames_) {
+        for (auto iter = specList; iter; iter = iter->next) {
+            if (iter->value->kind() == TypedefStorageClass) {
+                isTydef = true;
+                break;
+            }
+        }
+    }
+
     while (true) {
         DeclaratorSyntax* decltor = nullptr;
         if (!parseDeclarator(decltor, DeclarationScope::File))
             return false;
 
-        *decltorList_cur = makeNode<DeclaratorListSyntax>(decltor);
+        *decltorList_cur = makeListNode(decltorList_cur, decltor);
+        declareTypedefNameOrName(decltor, isTydef);
 
         InitializerSyntax** init = nullptr;
         if (peek().kind() == EqualsToken) {
@@ -388,6 +403,20 @@ bool Parser::parseFunctionDefinition_AtOpenBrace(
         funcDef->specs_ = const_cast<SpecifierListSyntax*>(specList);
         funcDef->decltor_ = decltor;
         funcDef->extKR_params_ = paramKRList;
+
+        TypedefNameScope tydefNameScope(this);
+        if (tydefNames_) {
+            auto sfx = prevDecltor->asArrayOrFunctionDeclarator()->suffix_;
+            if (sfx && sfx->kind() == ParameterSuffix) {
+                for (auto iter = sfx->asParameterSuffix()->decls_; iter; iter = iter->next)
+                    declareTypedefNameOrName(iter->value->decltor_, false);
+            }
+            for (auto iter = paramKRList; iter; iter = iter->next) {
+                for (auto decltorIt = iter->value->decltors_; decltorIt; decltorIt = decltorIt->next)
+                    declareTypedefNameOrName(decltorIt->value, false);
+            }
+        }
+
         parseCompoundStatement_AtFirst(funcDef->body_, StatementContext::None);
         return true;
     }
@@ -571,7 +600,7 @@ bool Parser::parseStructDeclaration_AtFollowOfSpecifierQualifierList(
         if (!parseDeclarator(decltor, DeclarationScope::Block))
             return false;
 
-        *decltorList_cur = makeNode<DeclaratorListSyntax>(decltor);
+        *decltorList_cur = makeListNode(decltorList_cur, decltor);
 
         switch (peek().kind()) {
             case CommaToken:
@@ -659,6 +688,7 @@ bool Parser::parseEnumerator(DeclarationSyntax*& decl)
             enumMembDecl = makeNode<EnumeratorDeclarationSyntax>();
             decl = enumMembDecl;
             enumMembDecl->identTkIdx_ = consume();
+            declareTypedefNameOrName(enumMembDecl->identTkIdx_, false);
             break;
         }
 
@@ -764,7 +794,7 @@ bool Parser::parseParameterDeclarationList(ParameterDeclarationListSyntax*& para
     if (!parseParameterDeclaration(paramDecl))
         return false;
 
-    *paramList_cur = makeNode<ParameterDeclarationListSyntax>(paramDecl);
+    *paramList_cur = makeListNode(paramList_cur, paramDecl);
 
     while (peek().kind() == CommaToken) {
         (*paramList_cur)->delimTkIdx_ = consume();
@@ -775,7 +805,7 @@ bool Parser::parseParameterDeclarationList(ParameterDeclarationListSyntax*& para
                 return true;
 
             default:
-                *paramList_cur = makeNode<ParameterDeclarationListSyntax>();
+                *paramList_cur = makeListNode(paramList_cur);
                 if (!parseParameterDeclaration((*paramList_cur)->value))
                     return false;
                 break;
@@ -855,7 +885,7 @@ bool Parser::parseExtKR_ParameterDeclarationList(
     if (!parseExtKR_ParameterDeclaration(paramDecl))
         return false;
 
-    *paramList_cur = makeNode<ExtKR_ParameterDeclarationListSyntax>(paramDecl);
+    *paramList_cur = makeListNode(paramList_cur, paramDecl);
 
     while (peek().kind() != OpenBraceToken) {
         paramList_cur = &(*paramList_cur)->next;
@@ -864,7 +894,7 @@ bool Parser::parseExtKR_ParameterDeclarationList(
         if (!parseExtKR_ParameterDeclaration(nextParamDecl))
             return false;
 
-        *paramList_cur = makeNode<ExtKR_ParameterDeclarationListSyntax>(nextParamDecl);
+        *paramList_cur = makeListNode(paramList_cur, nextParamDecl);
     }
 
     return true;
@@ -888,7 +918,7 @@ bool Parser::parseExtKR_ParameterDeclaration(ExtKR_ParameterDeclarationSyntax*&
         if (!parseDeclarator(decltor, DeclarationScope::FunctionPrototype))
             return false;
 
-        *decltorList_cur = makeNode<DeclaratorListSyntax>(decltor);
+        *decltorList_cur = makeListNode(decltorList_cur, decltor);
         switch (peek().kind()) {
             case CommaToken:
                 (*decltorList_cur)->delimTkIdx_ = consume();
@@ -1114,7 +1144,7 @@ bool Parser::parseDeclarationSpecifiers(DeclarationSyntax*& decl,
                 return true;
         }
 
-        *specList_cur = makeNode<SpecifierListSyntax>(spec);
+        *specList_cur = makeListNode(specList_cur, spec);
         specList_cur = &(*specList_cur)->next;
 
         if (decl)
@@ -1270,7 +1300,7 @@ bool Parser::parseSpecifierQualifierList(DeclarationSyntax*& decl,
                 return true;
         }
 
-        *specList_cur = makeNode<SpecifierListSyntax>(spec);
+        *specList_cur = makeListNode(specList_cur, spec);
         specList_cur = &(*specList_cur)->next;
 
         if (decl)
@@ -1499,7 +1529,7 @@ bool Parser::parseTagTypeSpecifier_AtFirst(
                 }
                 break;
         }
-        *declList_cur = makeNode<DeclarationListSyntax>(memberDecl);
+        *declList_cur = makeListNode(declList_cur, memberDecl);
         declList_cur = &(*declList_cur)->next;
     }
 
@@ -1527,7 +1557,7 @@ bool Parser::parseExtGNU_AttributeSpecifierList_AtFirst(SpecifierListSyntax*& sp
         if (!parseExtGNU_AttributeSpecifier_AtFirst(spec))
             return false;
 
-        *specList_cur = makeNode<SpecifierListSyntax>(spec);
+        *specList_cur = makeListNode(specList_cur, spec);
         specList_cur = &(*specList_cur)->next;
     }
     while (peek().kind() == Keyword_ExtGNU___attribute__);
@@ -1574,7 +1604,7 @@ bool Parser::parseExtGNU_AttributeList(ExtGNU_AttributeListSyntax*& attrList)
         if (!parseExtGNU_Attribute(attr))
             return false;
 
-        *attrList_cur = makeNode<ExtGNU_AttributeListSyntax>(attr);
+        *attrList_cur = makeListNode(attrList_cur, attr);
 
         switch (peek().kind()) {
             case CommaToken:
@@ -1676,7 +1706,7 @@ bool Parser::parseExtGNU_AttributeArgumentsLLVM(ExpressionListSyntax*& exprList)
     if (!parseIdentifierName(platName))
         return false;
 
-    *exprList_cur = makeNode<ExpressionListSyntax>(platName);
+    *exprList_cur = makeListNode(exprList_cur, platName);
 
     while (peek().kind() == CommaToken) {
         (*exprList_cur)->delimTkIdx_ = consume();
@@ -1703,7 +1733,7 @@ bool Parser::parseExtGNU_AttributeArgumentsLLVM(ExpressionListSyntax*& exprList)
                         consume();
                 }
 
-                auto assign = makeNode<BinaryExpressionSyntax>(BasicAssignmentExpression);
+                auto assign = makeNode<AssignmentExpressionSyntax>(BasicAssignmentExpression);
                 assign->leftExpr_ = expr;
                 assign->oprtrTkIdx_ = equalsTkIdx_;
                 assign->rightExpr_ = versionExpr;
@@ -1714,7 +1744,7 @@ bool Parser::parseExtGNU_AttributeArgumentsLLVM(ExpressionListSyntax*& exprList)
             default:
                 break;
         }
-        *exprList_cur = makeNode<ExpressionListSyntax>(expr);
+        *exprList_cur = makeListNode(exprList_cur, expr);
     }
 
     return true;
@@ -1834,7 +1864,7 @@ bool Parser::parseDirectDeclarator(DeclaratorSyntax*& decltor,
                     if (!parseExtGNU_AsmLabel_AtFirst(spec))
                         return false;
 
-                    *specList_cur = makeNode<SpecifierListSyntax>(spec);
+                    *specList_cur = makeListNode(specList_cur, spec);
                     specList_cur = &(*specList_cur)->next;
 
                     if (peek().kind() != Keyword_ExtGNU___attribute__)
@@ -2132,7 +2162,7 @@ bool Parser::parseDirectDeclaratorSuffix(DeclaratorSyntax*& decltor,
             if (!parseExtGNU_AsmLabel_AtFirst(spec))
                 return false;
 
-            *specList_cur = makeNode<SpecifierListSyntax>(spec);
+            *specList_cur = makeListNode(specList_cur, spec);
             specList_cur = &(*specList_cur)->next;
 
             if (peek().kind() != Keyword_ExtGNU___attribute__)
@@ -2223,7 +2253,7 @@ bool Parser::parseTypeQualifiersAndAttributes(SpecifierListSyntax*& specList)
                 return true;
         }
 
-        *specList_cur = makeNode<SpecifierListSyntax>(spec);
+        *specList_cur = makeListNode(specList_cur, spec);
         specList_cur = &(*specList_cur)->next;
     }
 }
@@ -2413,7 +2443,7 @@ bool Parser::parseDesignatorList_AtFirst(DesignatorListSyntax*& desigList,
         if (!(((this)->*(parseDesig))(desig)))
             return false;
 
-        *desigs_cur = makeNode<DesignatorListSyntax>(desig);
+        *desigs_cur = makeListNode(desigs_cur, desig);
         desigs_cur = &(*desigs_cur)->next;
 
         switch (peek().kind()) {
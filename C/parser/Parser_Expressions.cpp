@@ -1106,9 +1106,12 @@ bool Parser::parseExpressionWithPrecedenceCast(ExpressionSyntax*& expr)
                 // type-name ->* typedef-name -> identifier
                 // expression ->* identifier
                 case IdentifierToken: {
+                    if (tydefNames_ && !isTypedefName(peek(2)))
+                        return parseExpressionWithPrecedenceUnary(expr);
+
                     Backtracker BT(this);
                     if (parseCompoundLiteralOrCastExpression_AtFirst(expr)) {
-                        if (expr->kind() == CastExpression)
+                        if (!tydefNames_ && expr->kind() == CastExpression)
                             maybeAmbiguateCastExpression(expr);
                         return true;
                     }
@@ -1172,7 +1175,7 @@ void Parser::maybeAmbiguateCastExpression(ExpressionSyntax*& expr)
 
     auto castExpr = expr->asCastExpression();
     auto prefixExpr = castExpr->expr_->asPrefixUnaryExpression();
-    if (!(prefixExpr->asPrefixUnaryExpression()
+    if (!(prefixExpr
             && (prefixExpr->kind() == AddressOfExpression
                     || prefixExpr->kind() == PointerIndirectionExpression
                     || prefixExpr->kind() == UnaryPlusExpression
@@ -90,6 +90,12 @@ bool Parser::parseStatement(StatementSyntax*& stmt, StatementContext stmtCtx)
             if (peek(2).kind() == ColonToken)
                 return parseLabeledStatement_AtFirst(stmt, stmtCtx);
 
+            if (tydefNames_ && isTypedefName(peek())) {
+                return parseDeclarationStatement(
+                            stmt,
+                            &Parser::parseDeclarationOrFunctionDefinition);
+            }
+
             Backtracker BT(this);
             if (!parseExpressionStatement(stmt)) {
                 BT.backtrack();
@@ -97,7 +103,8 @@ bool Parser::parseStatement(StatementSyntax*& stmt, StatementContext stmtCtx)
                             stmt,
                             &Parser::parseDeclarationOrFunctionDefinition);
             }
-            maybeAmbiguateStatement(stmt);
+            if (!tydefNames_)
+                maybeAmbiguateStatement(stmt);
             return true;
         }
 
@@ -294,6 +301,7 @@ bool Parser::parseCompoundStatement_AtFirst(StatementSyntax*& stmt,
                   "assert failure: `{'");
 
     DepthControl _(DEPTH_OF_STMTS_);
+    TypedefNameScope tydefNameScope(this);
 
     auto block = makeNode<CompoundStatementSyntax>();
     stmt = block;
@@ -321,7 +329,7 @@ bool Parser::parseCompoundStatement_AtFirst(StatementSyntax*& stmt,
             }
         }
 
-        *stmtList_cur = makeNode<StatementListSyntax>(innerStmt);
+        *stmtList_cur = makeListNode(stmtList_cur, innerStmt);
         stmtList_cur = &(*stmtList_cur)->next;
     }
 
@@ -535,6 +543,8 @@ bool Parser::parseForStatement_AtFirst(StatementSyntax*& stmt,
                   return false,
                   "assert failure: `for'");
 
+    TypedefNameScope tydefNameScope(this);
+
     auto forStmt = makeNode<ForStatementSyntax>();
     stmt = forStmt;
     forStmt->forKwTkIdx_ = consume();
@@ -595,6 +605,16 @@ bool Parser::parseForStatement_AtFirst(StatementSyntax*& stmt,
             break;
 
         case IdentifierToken: {
+            if (tydefNames_ && isTypedefName(peek())) {
+                if (parseDeclarationStatement(
+                            forStmt->initStmt_,
+                            &Parser::parseDeclarationOrFunctionDefinition)) {
+                    break;
+                }
+                skipTo(CloseParenToken);
+                return false;
+            }
+
             Backtracker BT(this);
             if (!parseExpressionStatement(forStmt->initStmt_)) {
                 BT.backtrack();
@@ -606,7 +626,8 @@ bool Parser::parseForStatement_AtFirst(StatementSyntax*& stmt,
                 skipTo(CloseParenToken);
                 return false;
             }
-            maybeAmbiguateStatement(forStmt->initStmt_);
+            if (!tydefNames_)
+                maybeAmbiguateStatement(forStmt->initStmt_);
             break;
         }
 
@@ -831,7 +852,7 @@ void Parser::parseExtGNU_AsmQualifiers(SpecifierListSyntax*& specList)
                 return;
         }
 
-        *qualsList_cur = makeNode<SpecifierListSyntax>(qual);
+        *qualsList_cur = makeListNode(qualsList_cur, qual);
         qualsList_cur = &(*qualsList_cur)->next;
     }
 }
@@ -30,10 +30,58 @@
 using namespace psy;
 using namespace C;
 
-void Unparser::unparse(const SyntaxNode* node, std::ostream& os)
+void Unparser::unparse(const SyntaxNode* node, std::ostream& os, Spacing spacing)
 {
-    os_ = &os;
+    ownBuf_.clear();
+    unparse(node, ownBuf_, spacing);
+    os.write(ownBuf_.data(), ownBuf_.size());
+}
+
+void Unparser::unparse(const SyntaxNode* node, std::FILE* file, Spacing spacing)
+{
+    ownBuf_.clear();
+    unparse(node, ownBuf_, spacing);
+    std::fwrite(ownBuf_.data(), 1, ownBuf_.size(), file);
+}
+
+/**
+ * With Spacing::Original, the text between consecutive tokens is taken from
+ * the source. When the root of the tree is unparsed, the text before the
+ * first token and after the last one is included as well, so the output of
+ * a tree without ambiguities is identical to its source.
+ */
+void Unparser::unparse(const SyntaxNode* node, std::string& buffer, Spacing spacing)
+{
+    const auto& rawText = tree_->text().rawText();
+
+    // The text of the node (with some room for ambiguities, whose text
+    // appears twice).
+    std::size_t textSize = 0;
+    if (node == tree_->root())
+        textSize = rawText.size();
+    else if (node) {
+        auto firstTk = node->firstToken();
+        auto lastTk = node->lastToken();
+        if (firstTk.isValid()
+                && lastTk.isValid()
+                && lastTk.span().end() > firstTk.span().start()) {
+            textSize = lastTk.span().end() - firstTk.span().start();
+        }
+    }
+    buffer.reserve(buffer.size() + textSize + textSize / 4);
+
+    buf_ = &buffer;
+    spacing_ = spacing;
+    rawText_ = rawText.c_str();
+
+    auto whole = spacing == Spacing::Original && node == tree_->root();
+    prevByteEnd_ = 0;
+    prevByteEndIsSet_ = whole;
+
     visit(node);
+
+    if (whole && prevByteEnd_ < rawText.size())
+        buf_->append(rawText_ + prevByteEnd_, rawText.size() - prevByteEnd_);
 }
 
 void Unparser::terminal(const SyntaxToken& tk, const SyntaxNode*)
@@ -41,12 +89,28 @@ void Unparser::terminal(const SyntaxToken& tk, const SyntaxNode*)
     if (tk.kind() == EndOfFile)
         return;
 
-    *os_ << tk.valueText_c_str();
+    if (spacing_ == Spacing::Original) {
+        if (tk.isMissing() || tk.byteStart() == tk.byteEnd())
+            return;
+
+        if (prevByteEndIsSet_) {
+            if (tk.byteStart() >= prevByteEnd_)
+                buf_->append(rawText_ + prevByteEnd_, tk.byteStart() - prevByteEnd_);
+            else
+                buf_->push_back(' '); // A token revisited (in an ambiguity).
+        }
+        buf_->append(rawText_ + tk.byteStart(), tk.byteEnd() - tk.byteStart());
+        prevByteEnd_ = tk.byteEnd();
+        prevByteEndIsSet_ = true;
+        return;
+    }
+
+    buf_->append(tk.valueText_c_str());
 
     if (tk.kind() == CloseBraceToken
             || tk.kind() == OpenBraceToken
             || tk.kind() == SemicolonToken)
-        *os_ << "\n";
+        buf_->push_back('\n');
     else
-        *os_ << " ";
+        buf_->push_back(' ');
 }
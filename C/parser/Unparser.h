@@ -25,22 +25,54 @@
 
 #include "syntax/SyntaxDumper.h"
 
+#include <cstdint>
+#include <cstdio>
 #include <ostream>
+#include <string>
 
 namespace psy {
 namespace C {
 
+/**
+ * \brief The Unparser class.
+ *
+ * Regenerates the text of a SyntaxNode. The output is accumulated in a
+ * buffer (retained across calls to \c unparse, so that a reused Unparser
+ * doesn't allocate again) and written to the sink at once.
+ */
 class PSY_C_NON_API Unparser : public SyntaxDumper
 {
 public:
     using SyntaxDumper::SyntaxDumper;
 
-    void unparse(const SyntaxNode* node, std::ostream& os);
+    /**
+     * \brief The Spacing enumeration.
+     *
+     * How tokens are separated in the output.
+     */
+    enum class Spacing : std::uint8_t
+    {
+        Normalized, /**< A newline after braces and semicolons, and a space after other tokens. */
+        Original    /**< The source text between tokens (including comments), as is. */
+    };
+
+    void unparse(const SyntaxNode* node, std::ostream& os, Spacing spacing = Spacing::Normalized);
+    void unparse(const SyntaxNode* node, std::FILE* file, Spacing spacing = Spacing::Normalized);
+
+    /**
+     * Append the text of \p node to \p buffer.
+     */
+    void unparse(const SyntaxNode* node, std::string& buffer, Spacing spacing = Spacing::Normalized);
 
 protected:
     void terminal(const SyntaxToken& tk, const SyntaxNode* node) override;
 
-    std::ostream* os_;
+    std::string* buf_;
+    std::string ownBuf_;
+    Spacing spacing_;
+    const char* rawText_;
+    unsigned int prevByteEnd_;
+    bool prevByteEndIsSet_;
 };
 
 } // C
@@ -34,6 +34,7 @@ Disambiguator::~Disambiguator()
 Disambiguator::Disambiguator(SyntaxTree* tree)
     : SyntaxVisitor(tree)
     , pendingAmbigs_(0)
+    , declsWithAmbigs_(nullptr)
 {}
 
 unsigned int Disambiguator::disambiguate()
@@ -43,9 +44,25 @@ unsigned int Disambiguator::disambiguate()
     return pendingAmbigs_;
 }
 
+/**
+ * Disambiguate only the given (external) \p declsWithAmbigs of the translation
+ * unit, which are the ones within which the parser detected an ambiguity.
+ */
+unsigned int Disambiguator::disambiguate(const std::vector<const DeclarationSyntax*>& declsWithAmbigs)
+{
+    declsWithAmbigs_ = &declsWithAmbigs;
+    visit(tree_->root());
+    declsWithAmbigs_ = nullptr;
+
+    return pendingAmbigs_;
+}
+
 template <class ExprT>
 SyntaxVisitor::Action Disambiguator::visitMaybeAmbiguousExpression(ExprT* const& node)
 {
+    if (!node)
+        return Action::Skip;
+
     ExprT*& node_P = const_cast<ExprT*&>(node);
     switch (node->kind()) {
         case AmbiguousCastOrBinaryExpression: {
@@ -57,7 +74,7 @@ SyntaxVisitor::Action Disambiguator::visitMaybeAmbiguousExpression(ExprT* const&
                     visit(node_P);
                     break;
 
-                case Disambiguation::KeepExpressionStatement:
+                case Disambiguation::KeepBinaryExpression:
                     node_P = ambigNode->binExpr_;
                     visit(node_P);
                     break;
@@ -83,6 +100,9 @@ SyntaxVisitor::Action Disambiguator::visitMaybeAmbiguousExpression(ExprT* const&
 template <class StmtT>
 SyntaxVisitor::Action Disambiguator::visitMaybeAmbiguousStatement(StmtT* const& node)
 {
+    if (!node)
+        return Action::Skip;
+
     StmtT*& node_P = const_cast<StmtT*&>(node);
     switch (node->kind()) {
         case AmbiguousMultiplicationOrPointerDeclaration:
@@ -121,6 +141,9 @@ SyntaxVisitor::Action Disambiguator::visitMaybeAmbiguousStatement(StmtT* const&
 template <class TypeRefT>
 SyntaxVisitor::Action Disambiguator::visitMaybeAmbiguousTypeReference(TypeRefT* const& node)
 {
+    if (!node)
+        return Action::Skip;
+
     TypeRefT*& node_P = const_cast<TypeRefT*&>(node);
     switch (node->kind()) {
         case AmbiguousTypeNameOrExpressionAsTypeReference: {
@@ -132,7 +155,7 @@ SyntaxVisitor::Action Disambiguator::visitMaybeAmbiguousTypeReference(TypeRefT*
                     visit(node_P);
                     break;
 
-                case Disambiguation::KeepExpressionStatement:
+                case Disambiguation::KeepExpression:
                     node_P = ambigNode->exprAsTyRef_;
                     visit(node_P);
                     break;
@@ -159,6 +182,20 @@ SyntaxVisitor::Action Disambiguator::visitMaybeAmbiguousTypeReference(TypeRefT*
 // Declarations //
 //--------------//
 
+SyntaxVisitor::Action Disambiguator::visitTranslationUnit(const TranslationUnitSyntax* node)
+{
+    if (declsWithAmbigs_ && !declsWithAmbigs_->empty()) {
+        for (auto decl : *declsWithAmbigs_)
+            visit(decl);
+        return Action::Skip;
+    }
+
+    for (auto iter = node->declarations(); iter; iter = iter->next)
+        visit(iter->value);
+
+    return Action::Skip;
+}
+
 SyntaxVisitor::Action Disambiguator::visitStaticAssertDeclaration(const StaticAssertDeclarationSyntax* node)
 {
     visitMaybeAmbiguousExpression(node->expr_);
@@ -401,7 +438,7 @@ SyntaxVisitor::Action Disambiguator::visitDoStatement(const DoStatementSyntax* n
 
 SyntaxVisitor::Action Disambiguator::visitForStatement(const ForStatementSyntax* node)
 {
-    visit(node->initStmt_);
+    visitMaybeAmbiguousStatement(node->initStmt_);
     visitMaybeAmbiguousExpression(node->cond_);
     visitMaybeAmbiguousExpression(node->expr_);
     visitMaybeAmbiguousStatement(node->stmt_);
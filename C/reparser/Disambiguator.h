@@ -29,6 +29,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace psy {
 namespace C {
@@ -42,6 +43,7 @@ PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(Reparser);
 
     unsigned int disambiguate();
+    unsigned int disambiguate(const std::vector<const DeclarationSyntax*>& declsWithAmbigs);
 
 PSY_INTERNAL_AND_EXTENSIBLE:
     Disambiguator(SyntaxTree* tree);
@@ -69,9 +71,12 @@ private:
     unsigned int pendingAmbigs_;
 
 protected:
+    const std::vector<const DeclarationSyntax*>* declsWithAmbigs_;
+
     //--------------//
     // Declarations //
     //--------------//
+    Action visitTranslationUnit(const TranslationUnitSyntax*) override;
     Action visitStaticAssertDeclaration(const StaticAssertDeclarationSyntax*) override;
 
     /* Specifiers */
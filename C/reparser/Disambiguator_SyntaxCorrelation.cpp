@@ -20,6 +20,7 @@
 
 #include "Disambiguator_SyntaxCorrelation.h"
 
+#include "syntax/SyntaxLexeme_Identifier.h"
 #include "syntax/SyntaxNodes.h"
 
 #include "../common/infra/Assertions.h"
@@ -43,8 +44,27 @@ SyntaxVisitor::Action SyntaxCorrelationDisambiguator::visitTranslationUnit(const
 {
     catalog_->enterLevel(node);
 
-    for (auto iter = node->declarations(); iter; iter = iter->next)
+    Disambiguator::visitTranslationUnit(node);
+
+    catalog_->exitLevel();
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action SyntaxCorrelationDisambiguator::visitFunctionDefinition(const FunctionDefinitionSyntax* node)
+{
+    if (!catalog_->levelExists(node))
+        return Action::Visit;
+
+    for (auto iter = node->specifiers(); iter; iter = iter->next)
+        visit(iter->value);
+    visit(node->declarator());
+
+    catalog_->enterLevel(node);
+
+    for (auto iter = node->extKR_params(); iter; iter = iter->next)
         visit(iter->value);
+    visit(node->body());
 
     catalog_->exitLevel();
 
@@ -61,7 +81,9 @@ Disambiguator::Disambiguation SyntaxCorrelationDisambiguator::disambiguateExpres
                return Disambiguation::Inconclusive);
 
     auto typedefName = typeName->specifiers()->value->asTypedefName();
-    auto name = typedefName->identifierToken().valueText();
+    auto lexeme = typedefName->identifierToken().valueLexeme();
+    PSY_ASSERT(lexeme, return Disambiguation::Inconclusive);
+    auto name = lexeme->asIdentifier();
 
     return recognizesTypeName(name)
             ? Disambiguation::KeepCastExpression
@@ -83,7 +105,9 @@ Disambiguator::Disambiguation SyntaxCorrelationDisambiguator::disambiguateStatem
                return Disambiguation::Inconclusive);
 
     auto typedefName = varDecl->specifiers()->value->asTypedefName();
-    auto name = typedefName->identifierToken().valueText();
+    auto lexeme = typedefName->identifierToken().valueLexeme();
+    PSY_ASSERT(lexeme, return Disambiguation::Inconclusive);
+    auto name = lexeme->asIdentifier();
 
     return recognizesTypeName(name)
             ? Disambiguation::KeepDeclarationStatement
@@ -102,7 +126,9 @@ Disambiguator::Disambiguation SyntaxCorrelationDisambiguator::disambiguateTypeRe
                return Disambiguation::Inconclusive);
 
     auto typedefName = typeName->specifiers()->value->asTypedefName();
-    auto name = typedefName->identifierToken().valueText();
+    auto lexeme = typedefName->identifierToken().valueLexeme();
+    PSY_ASSERT(lexeme, return Disambiguation::Inconclusive);
+    auto name = lexeme->asIdentifier();
 
     return recognizesTypeName(name)
             ? Disambiguation::KeepTypeName
@@ -111,12 +137,12 @@ Disambiguator::Disambiguation SyntaxCorrelationDisambiguator::disambiguateTypeRe
                     : Disambiguation::Inconclusive;
 }
 
-bool SyntaxCorrelationDisambiguator::recognizesTypeName(const std::string& name) const
+bool SyntaxCorrelationDisambiguator::recognizesTypeName(const Identifier* name) const
 {
     return catalog_->containsTypeName(name);
 }
 
-bool SyntaxCorrelationDisambiguator::recognizesName(const std::string& name) const
+bool SyntaxCorrelationDisambiguator::recognizesName(const Identifier* name) const
 {
     return catalog_->containsName(name);
 }
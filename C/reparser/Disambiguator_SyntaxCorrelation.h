@@ -49,13 +49,14 @@ private:
     virtual Disambiguation disambiguateStatement(const AmbiguousExpressionOrDeclarationStatementSyntax*) const override;
     virtual Disambiguation disambiguateTypeReference(const AmbiguousTypeNameOrExpressionAsTypeReferenceSyntax*) const override;
 
-    bool recognizesTypeName(const std::string& name) const;
-    bool recognizesName(const std::string& name) const;
+    bool recognizesTypeName(const Identifier* name) const;
+    bool recognizesName(const Identifier* name) const;
 
     //--------------//
     // Declarations //
     //--------------//
     Action visitTranslationUnit(const TranslationUnitSyntax*) override;
+    Action visitFunctionDefinition(const FunctionDefinitionSyntax*) override;
 };
 
 } // C
@@ -17,3 +17,333 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
+
+#include "Disambiguator_TypeSynonymsVerification.h"
+
+#include "syntax/SyntaxLexeme_Identifier.h"
+#include "syntax/SyntaxNodes.h"
+
+#include "../common/infra/Assertions.h"
+#include "../common/infra/Escape.h"
+
+using namespace psy;
+using namespace C;
+
+TypeSynonymsVerificationDisambiguator::TypeSynonymsVerificationDisambiguator(SyntaxTree* tree)
+    : Disambiguator(tree)
+{}
+
+namespace {
+
+const Identifier* identifierOf(const SyntaxToken& tk)
+{
+    auto lexeme = tk.valueLexeme();
+    return lexeme ? lexeme->asIdentifier() : nullptr;
+}
+
+const DeclaratorSyntax* innerDeclaratorOf(const DeclaratorSyntax* decltor)
+{
+    switch (decltor->kind()) {
+        case PointerDeclarator:
+            return decltor->asPointerDeclarator()->innerDeclarator();
+
+        case ParenthesizedDeclarator:
+            return decltor->asParenthesizedDeclarator()->innerDeclarator();
+
+        case ArrayDeclarator:
+        case FunctionDeclarator:
+            return decltor->asArrayOrFunctionDeclarator()->innerDeclarator();
+
+        case BitfieldDeclarator:
+            return decltor->asBitfieldDeclarator()->innerDeclarator();
+
+        default:
+            return nullptr;
+    }
+}
+
+bool isTypeSynonymDeclaration(const SpecifierListSyntax* specs)
+{
+    for (auto iter = specs; iter; iter = iter->next) {
+        if (iter->value->kind() == TypedefStorageClass)
+            return true;
+    }
+    return false;
+}
+
+} // anonymous
+
+void TypeSynonymsVerificationDisambiguator::enterScope()
+{
+    scopes_.push_back(declaredIdents_.size());
+}
+
+void TypeSynonymsVerificationDisambiguator::exitScope()
+{
+    PSY_ASSERT(!scopes_.empty(), return);
+
+    auto size = scopes_.back();
+    scopes_.pop_back();
+    while (declaredIdents_.size() > size) {
+        ordinaryIdents_[declaredIdents_.back()].pop_back();
+        declaredIdents_.pop_back();
+    }
+}
+
+void TypeSynonymsVerificationDisambiguator::declare(const Identifier* ident, bool isTySyn)
+{
+    if (!ident)
+        return;
+
+    ordinaryIdents_[ident].push_back(isTySyn);
+    declaredIdents_.push_back(ident);
+}
+
+void TypeSynonymsVerificationDisambiguator::declare(const DeclaratorSyntax* decltor, bool isTySyn)
+{
+    for (; decltor; decltor = innerDeclaratorOf(decltor)) {
+        if (decltor->kind() == IdentifierDeclarator) {
+            declare(identifierOf(decltor->asIdentifierDeclarator()->identifierToken()), isTySyn);
+            return;
+        }
+    }
+}
+
+void TypeSynonymsVerificationDisambiguator::declareParametersOf(const DeclaratorSyntax* decltor)
+{
+    for (; decltor; decltor = innerDeclaratorOf(decltor)) {
+        if (decltor->kind() != FunctionDeclarator)
+            continue;
+
+        auto funcDecltor = decltor->asArrayOrFunctionDeclarator();
+        auto inner = funcDecltor->innerDeclarator();
+        while (inner && inner->kind() == ParenthesizedDeclarator)
+            inner = inner->asParenthesizedDeclarator()->innerDeclarator();
+        if (!(inner && inner->kind() == IdentifierDeclarator))
+            continue;
+
+        auto suffix = funcDecltor->suffix();
+        if (!(suffix && suffix->kind() == ParameterSuffix))
+            return;
+
+        for (auto iter = suffix->asParameterSuffix()->parameters(); iter; iter = iter->next)
+            declare(iter->value->declarator(), false);
+        return;
+    }
+}
+
+bool TypeSynonymsVerificationDisambiguator::isTypeSynonym(const Identifier* ident) const
+{
+    auto it = ordinaryIdents_.find(ident);
+    return it != ordinaryIdents_.end() && !it->second.empty() && it->second.back();
+}
+
+bool TypeSynonymsVerificationDisambiguator::isTypeSynonym(const TypedefNameSyntax* tydefName) const
+{
+    return isTypeSynonym(identifierOf(tydefName->identifierToken()));
+}
+
+/*
+ * In complete text, a name that isn't a type synonym in scope is not a type
+ * at all, so an ambiguity is always resolved, as long as it's well-formed.
+ */
+
+Disambiguator::Disambiguation TypeSynonymsVerificationDisambiguator::disambiguateExpression(
+        const AmbiguousCastOrBinaryExpressionSyntax* node) const
+{
+    auto typeName = node->castExpression()->typeName();
+    PSY_ASSERT(typeName->specifiers()
+                   && typeName->specifiers()->value
+                   && typeName->specifiers()->value->kind() == TypedefName,
+               return Disambiguation::Inconclusive);
+
+    return isTypeSynonym(typeName->specifiers()->value->asTypedefName())
+            ? Disambiguation::KeepCastExpression
+            : Disambiguation::KeepBinaryExpression;
+}
+
+Disambiguator::Disambiguation TypeSynonymsVerificationDisambiguator::disambiguateStatement(
+        const AmbiguousExpressionOrDeclarationStatementSyntax* node) const
+{
+    auto decl = node->declarationStatement()->declaration();
+    PSY_ASSERT(decl->kind() == VariableAndOrFunctionDeclaration, return Disambiguation::Inconclusive);
+
+    auto varDecl = decl->asVariableAndOrFunctionDeclaration();
+    PSY_ASSERT(varDecl->specifiers()
+                   && varDecl->specifiers()->value
+                   && varDecl->specifiers()->value->kind() == TypedefName,
+               return Disambiguation::Inconclusive);
+
+    return isTypeSynonym(varDecl->specifiers()->value->asTypedefName())
+            ? Disambiguation::KeepDeclarationStatement
+            : Disambiguation::KeepExpressionStatement;
+}
+
+Disambiguator::Disambiguation TypeSynonymsVerificationDisambiguator::disambiguateTypeReference(
+        const AmbiguousTypeNameOrExpressionAsTypeReferenceSyntax* node) const
+{
+    auto typeName = node->typeNameAsTypeReference()->typeName();
+    PSY_ASSERT(typeName->specifiers()
+                   && typeName->specifiers()->value
+                   && typeName->specifiers()->value->kind() == TypedefName,
+               return Disambiguation::Inconclusive);
+
+    return isTypeSynonym(typeName->specifiers()->value->asTypedefName())
+            ? Disambiguation::KeepTypeName
+            : Disambiguation::KeepExpression;
+}
+
+//--------------//
+// Declarations //
+//--------------//
+
+SyntaxVisitor::Action TypeSynonymsVerificationDisambiguator::visitTranslationUnit(
+        const TranslationUnitSyntax* node)
+{
+    enterScope();
+
+    if (!declsWithAmbigs_ || declsWithAmbigs_->empty()) {
+        for (auto iter = node->declarations(); iter; iter = iter->next)
+            visit(iter->value);
+    }
+    else {
+        /*
+         * Type synonyms may be declared by any declaration of the translation
+         * unit, but only the bodies of the function definitions with
+         * ambiguities need to be visited.
+         */
+        auto declIt = declsWithAmbigs_->begin();
+        for (auto iter = node->declarations(); iter; iter = iter->next) {
+            auto decl = iter->value;
+            if (declIt != declsWithAmbigs_->end() && *declIt == decl) {
+                ++declIt;
+                visit(decl);
+                continue;
+            }
+
+            if (decl->kind() == FunctionDefinition)
+                declare(decl->asFunctionDefinition()->declarator(), false);
+            else
+                visit(decl);
+        }
+    }
+
+    exitScope();
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeSynonymsVerificationDisambiguator::visitEnumeratorDeclaration(
+        const EnumeratorDeclarationSyntax* node)
+{
+    declare(identifierOf(node->identifierToken()), false);
+
+    return Action::Visit;
+}
+
+SyntaxVisitor::Action TypeSynonymsVerificationDisambiguator::visitVariableAndOrFunctionDeclaration(
+        const VariableAndOrFunctionDeclarationSyntax* node)
+{
+    for (auto iter = node->specifiers(); iter; iter = iter->next)
+        visit(iter->value);
+
+    auto isTySyn = isTypeSynonymDeclaration(node->specifiers());
+    for (auto iter = node->declarators(); iter; iter = iter->next) {
+        declare(iter->value, isTySyn);
+        visit(iter->value);
+    }
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeSynonymsVerificationDisambiguator::visitParameterDeclaration(
+        const ParameterDeclarationSyntax* node)
+{
+    for (auto iter = node->specifiers(); iter; iter = iter->next)
+        visit(iter->value);
+
+    declare(node->declarator(), false);
+    visit(node->declarator());
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeSynonymsVerificationDisambiguator::visitFunctionDefinition(
+        const FunctionDefinitionSyntax* node)
+{
+    for (auto iter = node->specifiers(); iter; iter = iter->next)
+        visit(iter->value);
+
+    declare(node->declarator(), false);
+
+    enterScope();
+
+    declareParametersOf(node->declarator());
+    visit(node->declarator());
+    for (auto iter = node->extKR_params(); iter; iter = iter->next)
+        visit(iter->value);
+    visit(node->body());
+
+    exitScope();
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeSynonymsVerificationDisambiguator::visitExtKR_ParameterDeclaration(
+        const ExtKR_ParameterDeclarationSyntax* node)
+{
+    for (auto iter = node->specifiers(); iter; iter = iter->next)
+        visit(iter->value);
+
+    for (auto iter = node->declarators(); iter; iter = iter->next) {
+        declare(iter->value, false);
+        visit(iter->value);
+    }
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeSynonymsVerificationDisambiguator::visitParameterSuffix(
+        const ParameterSuffixSyntax* node)
+{
+    enterScope();
+
+    for (auto iter = node->parameters(); iter; iter = iter->next)
+        visit(iter->value);
+
+    exitScope();
+
+    return Action::Skip;
+}
+
+//------------//
+// Statements //
+//------------//
+
+SyntaxVisitor::Action TypeSynonymsVerificationDisambiguator::visitCompoundStatement(
+        const CompoundStatementSyntax* node)
+{
+    enterScope();
+    Disambiguator::visitCompoundStatement(node);
+    exitScope();
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeSynonymsVerificationDisambiguator::visitDeclarationStatement(
+        const DeclarationStatementSyntax* node)
+{
+    visit(node->declaration());
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeSynonymsVerificationDisambiguator::visitForStatement(
+        const ForStatementSyntax* node)
+{
+    enterScope();
+    Disambiguator::visitForStatement(node);
+    exitScope();
+
+    return Action::Skip;
+}
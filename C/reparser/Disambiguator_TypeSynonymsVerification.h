@@ -18,20 +18,80 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+
 #ifndef PSYCHE_C_TYPE_SYNONYS_VERIFICATION_DISAMBIGUATOR_H__
 #define PSYCHE_C_TYPE_SYNONYS_VERIFICATION_DISAMBIGUATOR_H__
 
 #include "API.h"
+#include "Fwds.h"
+
+#include "reparser/Disambiguator.h"
+
+#include "../common/infra/InternalAccess.h"
 
-#include "syntax/SyntaxVisitor.h"
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
 
 namespace psy {
 namespace C {
 
-class PSY_C_NON_API TypeSynonymsVerificationReparser : public SyntaxVisitor
+/**
+ * \brief The TypeSynonymsVerificationDisambiguator class.
+ *
+ * A Disambiguator for complete text: the type synonyms (\c typedef names) in
+ * scope at an ambiguity are known, since they're declared before any use, so
+ * a table of them is built in the same pass that resolves the ambiguities.
+ */
+class PSY_C_NON_API TypeSynonymsVerificationDisambiguator final : public Disambiguator
 {
-public:
-    TypeSynonymsVerificationReparser(SyntaxTree* tree);
+PSY_INTERNAL_AND_RESTRICTED:
+    PSY_GRANT_ACCESS(Reparser);
+
+    TypeSynonymsVerificationDisambiguator(SyntaxTree* tree);
+
+private:
+    /*
+     * Every declaration of an ordinary identifier is recorded (whether or not
+     * it's a type synonym), so that an object declared in an inner scope hides
+     * a type synonym of an outer one. The undo log restores the table when a
+     * scope is exited.
+     */
+    std::unordered_map<const Identifier*, std::vector<bool>> ordinaryIdents_;
+    std::vector<const Identifier*> declaredIdents_;
+    std::vector<std::size_t> scopes_;
+
+    void enterScope();
+    void exitScope();
+    void declare(const Identifier* ident, bool isTySyn);
+    void declare(const DeclaratorSyntax* decltor, bool isTySyn);
+    void declareParametersOf(const DeclaratorSyntax* decltor);
+    bool isTypeSynonym(const Identifier* ident) const;
+    bool isTypeSynonym(const TypedefNameSyntax* tydefName) const;
+
+    virtual Disambiguation disambiguateExpression(const AmbiguousCastOrBinaryExpressionSyntax*) const override;
+    virtual Disambiguation disambiguateStatement(const AmbiguousExpressionOrDeclarationStatementSyntax*) const override;
+    virtual Disambiguation disambiguateTypeReference(const AmbiguousTypeNameOrExpressionAsTypeReferenceSyntax*) const override;
+
+    //--------------//
+    // Declarations //
+    //--------------//
+    Action visitTranslationUnit(const TranslationUnitSyntax*) override;
+    Action visitEnumeratorDeclaration(const EnumeratorDeclarationSyntax*) override;
+    Action visitVariableAndOrFunctionDeclaration(const VariableAndOrFunctionDeclarationSyntax*) override;
+    Action visitParameterDeclaration(const ParameterDeclarationSyntax*) override;
+    Action visitFunctionDefinition(const FunctionDefinitionSyntax*) override;
+    Action visitExtKR_ParameterDeclaration(const ExtKR_ParameterDeclarationSyntax*) override;
+
+    /* Declarators */
+    Action visitParameterSuffix(const ParameterSuffixSyntax*) override;
+
+    //------------//
+    // Statements //
+    //------------//
+    Action visitCompoundStatement(const CompoundStatementSyntax*) override;
+    Action visitDeclarationStatement(const DeclarationStatementSyntax*) override;
+    Action visitForStatement(const ForStatementSyntax*) override;
 };
 
 } // C
@@ -20,6 +20,7 @@
 
 #include "NameCatalog.h"
 
+#include "syntax/SyntaxLexeme_Identifier.h"
 #include "syntax/SyntaxNode.h"
 
 #include "../common/infra/Assertions.h"
@@ -38,17 +39,18 @@ void NameCatalog::createLevelAndEnter(const SyntaxNode* node)
     PSY_ASSERT(node, return);
     PSY_ASSERT(!levelExists(node), return);
 
-    TypeNames types;
-    Names nonTypes;
+    const NameIndex* outer = nullptr;
     if (!levelKeys_.empty()) {
-        auto levelIt = levels_.find(levelKeys_.top());
-        PSY_ASSERT(levelIt != levels_.end(), return);
-
-        types = levelIt->second.first;
-        nonTypes = levelIt->second.second;
+        outer = currentLevel();
+        PSY_ASSERT(outer, return);
     }
 
-    levels_.insert(std::make_pair(node, std::make_pair(types, nonTypes)));
+    auto& level = levels_[node];
+    level.outer_ = outer;
+    if (outer) {
+        level.outerTypeNamesCnt_ = outer->typeNames_.size();
+        level.outerNamesCnt_ = outer->names_.size();
+    }
 
     enterLevel(node);
 }
@@ -63,31 +65,55 @@ void NameCatalog::enterLevel(const SyntaxNode* node)
 
 void NameCatalog::exitLevel()
 {
+    auto level = currentLevel();
+    PSY_ASSERT(level, return);
+
+    level->typeNames_.compact();
+    level->names_.compact();
+
     levelKeys_.pop();
 }
 
-void NameCatalog::catalogTypeName(std::string s)
+void NameCatalog::catalogTypeName(const Identifier* ident)
 {
+    PSY_ASSERT(ident, return);
+
     auto level = currentLevel();
-    level->first.insert(std::move(s));
+    level->typeNames_.insert(ident);
 }
 
-void NameCatalog::catalogName(std::string s)
+void NameCatalog::catalogName(const Identifier* ident)
 {
+    PSY_ASSERT(ident, return);
+
     auto level = currentLevel();
-    level->second.insert(std::move(s));
+    level->names_.insert(ident);
 }
 
-bool NameCatalog::containsTypeName(const std::string& s) const
+bool NameCatalog::containsTypeName(const Identifier* ident) const
 {
-    auto level = currentLevel();
-    return level->first.find(s) != level->first.end();
+    const NameIndex* level = currentLevel();
+    auto cnt = level->typeNames_.size();
+    while (level) {
+        if (level->typeNames_.contains(ident, cnt))
+            return true;
+        cnt = level->outerTypeNamesCnt_;
+        level = level->outer_;
+    }
+    return false;
 }
 
-bool NameCatalog::containsName(const std::string &s) const
+bool NameCatalog::containsName(const Identifier* ident) const
 {
-    auto level = currentLevel();
-    return level->second.find(s) != level->first.end();
+    const NameIndex* level = currentLevel();
+    auto cnt = level->names_.size();
+    while (level) {
+        if (level->names_.contains(ident, cnt))
+            return true;
+        cnt = level->outerNamesCnt_;
+        level = level->outer_;
+    }
+    return false;
 }
 
 bool NameCatalog::levelExists(const SyntaxNode* node) const
@@ -103,6 +129,50 @@ NameCatalog::NameIndex* NameCatalog::currentLevel() const
     return &levels_[levelKeys_.top()];
 }
 
+void NameCatalog::NameSet::insert(const Identifier* ident)
+{
+    if (!idents_.empty() && idents_.back() == ident)
+        return;
+    idents_.push_back(ident);
+}
+
+/*
+ * Whether the identifier is among the first \p cnt names catalogued.
+ */
+bool NameCatalog::NameSet::contains(const Identifier* ident, std::size_t cnt) const
+{
+    compact();
+    auto it = std::lower_bound(index_.begin(),
+                               index_.end(),
+                               ident,
+                               [] (const std::pair<const Identifier*, std::size_t>& p,
+                                   const Identifier* ident) {
+                                   return p.first < ident;
+                               });
+    return it != index_.end() && it->first == ident && it->second < cnt;
+}
+
+void NameCatalog::NameSet::compact() const
+{
+    if (indexedCnt_ == idents_.size())
+        return;
+
+    // Each name is indexed at the position where it first appears.
+    auto mid = index_.size();
+    for (auto i = indexedCnt_; i < idents_.size(); ++i)
+        index_.emplace_back(idents_[i], i);
+    std::sort(index_.begin() + mid, index_.end());
+    std::inplace_merge(index_.begin(), index_.begin() + mid, index_.end());
+    index_.erase(std::unique(index_.begin(),
+                             index_.end(),
+                             [] (const std::pair<const Identifier*, std::size_t>& a,
+                                 const std::pair<const Identifier*, std::size_t>& b) {
+                                 return a.first == b.first;
+                             }),
+                 index_.end());
+    indexedCnt_ = idents_.size();
+}
+
 namespace psy {
 namespace C {
 
@@ -111,12 +181,12 @@ std::ostream& operator<<(std::ostream& os, const NameCatalog& disambigCatalog)
     for (const auto& p : disambigCatalog.levels_) {
         os << to_string(p.first->kind()) << std::endl;
         os << "\tTypes: ";
-        for (const auto& t : p.second.first)
-            os << t << " ";
-        std::cout << std::endl;
+        for (const auto& t : p.second.typeNames_.idents_)
+            os << t->c_str() << " ";
+        os << std::endl;
         os << "\tAny: ";
-        for (const auto& v : p.second.second)
-            os << v << " ";
+        for (const auto& v : p.second.names_.idents_)
+            os << v->c_str() << " ";
         os << std::endl;
     }
     return os;
@@ -28,10 +28,9 @@
 
 #include <ostream>
 #include <stack>
-#include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace psy {
 namespace C {
@@ -50,24 +49,50 @@ PSY_INTERNAL_AND_RESTRICTED:
     void createLevelAndEnter(const SyntaxNode*);
     void enterLevel(const SyntaxNode*);
     void exitLevel();
+    bool levelExists(const SyntaxNode*) const;
 
-    void catalogTypeName(std::string s);
-    void catalogName(std::string s);
+    void catalogTypeName(const Identifier* ident);
+    void catalogName(const Identifier* ident);
 
-    bool containsTypeName(const std::string& s) const;
-    bool containsName(const std::string& s) const;
+    bool containsTypeName(const Identifier* ident) const;
+    bool containsName(const Identifier* ident) const;
 
 private:
-    using TypeNames = std::unordered_set<std::string>;
-    using Names = std::unordered_set<std::string>;
-    using NameIndex = std::pair<TypeNames, Names>;
+    /*
+     * Names are the interned identifiers of the tree, kept in flat vectors
+     * in the order they're catalogued; a sorted (and deduplicated) index of
+     * them, with the position of each, is merged lazily, upon a lookup or
+     * when the level is exited. A nested level doesn't copy the names of its
+     * enclosing one; but it records how many of them there were when it was
+     * created, and a lookup walks up the chain of levels considering only
+     * those names.
+     */
+    struct NameSet
+    {
+        void insert(const Identifier* ident);
+        bool contains(const Identifier* ident, std::size_t cnt) const;
+        void compact() const;
+        std::size_t size() const { return idents_.size(); }
+
+        std::vector<const Identifier*> idents_;
+        mutable std::vector<std::pair<const Identifier*, std::size_t>> index_;
+        mutable std::size_t indexedCnt_ = 0;
+    };
+
+    struct NameIndex
+    {
+        NameSet typeNames_;
+        NameSet names_;
+        const NameIndex* outer_ = nullptr;
+        std::size_t outerTypeNamesCnt_ = 0;
+        std::size_t outerNamesCnt_ = 0;
+    };
 
     using Levels = std::unordered_map<const SyntaxNode*, NameIndex>;
 
     mutable Levels levels_;
     std::stack<const SyntaxNode*> levelKeys_;
 
-    bool levelExists(const SyntaxNode*) const;
     NameIndex* currentLevel() const;
 };
 
@@ -23,14 +23,27 @@
 #include "../common/infra/Assertions.h"
 #include "../common/infra/Escape.h"
 
+#include "syntax/SyntaxLexeme_Identifier.h"
 #include "syntax/SyntaxNodes.h"
 
 using namespace psy;
 using namespace C;
 
+namespace {
+
+const Identifier* identifierOf(const SyntaxToken& tk)
+{
+    auto lexeme = tk.valueLexeme();
+    return lexeme ? lexeme->asIdentifier() : nullptr;
+}
+
+} // anonymous
+
 NameCataloger::NameCataloger(SyntaxTree* tree)
-    : SyntaxVisitor(tree)
+    : StaticSyntaxVisitor(tree)
     , catalog_(new NameCatalog)
+    , declsWithAmbigs_(nullptr)
+    , nextDeclWithAmbigs_(0)
 {}
 
 std::unique_ptr<NameCatalog> NameCataloger::catalogFor(const SyntaxNode* node)
@@ -39,30 +52,79 @@ std::unique_ptr<NameCatalog> NameCataloger::catalogFor(const SyntaxNode* node)
     return std::move(catalog_);
 }
 
+/**
+ * Catalog only the scopes that enclose the given (external) \p declsWithAmbigs
+ * of the translation unit: the file scope and the bodies of those declarations
+ * (each one in a level of its own). The bodies of other function definitions
+ * are skipped.
+ */
+std::unique_ptr<NameCatalog> NameCataloger::catalogFor(
+        const SyntaxNode* node,
+        const std::vector<const DeclarationSyntax*>& declsWithAmbigs)
+{
+    declsWithAmbigs_ = &declsWithAmbigs;
+    nextDeclWithAmbigs_ = 0;
+    visit(node);
+    declsWithAmbigs_ = nullptr;
+
+    return std::move(catalog_);
+}
+
 SyntaxVisitor::Action NameCataloger::visitTranslationUnit(const TranslationUnitSyntax* node)
 {
     catalog_->createLevelAndEnter(node);
 
-    for (auto iter = node->declarations(); iter; iter = iter->next)
+    for (auto iter = node->declarations(); iter; iter = iter->next) {
         visit(iter->value);
 
+        if (declsWithAmbigs_
+                && nextDeclWithAmbigs_ < declsWithAmbigs_->size()
+                && (*declsWithAmbigs_)[nextDeclWithAmbigs_] == iter->value) {
+            ++nextDeclWithAmbigs_;
+        }
+    }
+
     catalog_->exitLevel();
 
-    std::cout << "CATALOG\n" << *catalog_ << std::endl;
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action NameCataloger::visitFunctionDefinition(const FunctionDefinitionSyntax* node)
+{
+    if (!declsWithAmbigs_ || declsWithAmbigs_->empty())
+        return Action::Visit;
+
+    for (auto iter = node->specifiers(); iter; iter = iter->next)
+        visit(iter->value);
+    visit(node->declarator());
+
+    if (nextDeclWithAmbigs_ == declsWithAmbigs_->size()
+            || (*declsWithAmbigs_)[nextDeclWithAmbigs_] != node)
+        return Action::Skip;
+
+    ++nextDeclWithAmbigs_;
+
+    catalog_->createLevelAndEnter(node);
+
+    for (auto iter = node->extKR_params(); iter; iter = iter->next)
+        visit(iter->value);
+    visit(node->body());
+
+    catalog_->exitLevel();
 
     return Action::Skip;
 }
 
 SyntaxVisitor::Action NameCataloger::visitTypedefName(const TypedefNameSyntax* node)
 {
-    catalog_->catalogTypeName(node->identifierToken().valueText());
+    catalog_->catalogTypeName(identifierOf(node->identifierToken()));
 
     return Action::Skip;
 }
 
 SyntaxVisitor::Action NameCataloger::visitIdentifierDeclarator(const IdentifierDeclaratorSyntax* node)
 {
-    catalog_->catalogName(node->identifierToken().valueText());
+    catalog_->catalogName(identifierOf(node->identifierToken()));
 
     visit(node->initializer());
 
@@ -71,7 +133,7 @@ SyntaxVisitor::Action NameCataloger::visitIdentifierDeclarator(const IdentifierD
 
 SyntaxVisitor::Action NameCataloger::visitIdentifierName(const IdentifierNameSyntax* node)
 {
-    catalog_->catalogName(node->identifierToken().valueText());
+    catalog_->catalogName(identifierOf(node->identifierToken()));
 
     return Action::Skip;
 }
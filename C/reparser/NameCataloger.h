@@ -25,49 +25,57 @@
 
 #include "NameCatalog.h"
 
-#include "syntax/SyntaxVisitor.h"
+#include "syntax/StaticSyntaxVisitor.h"
 
+#include <cstddef>
 #include <memory>
 #include <ostream>
+#include <vector>
 
 namespace psy {
 namespace C {
 
-class PSY_C_NON_API NameCataloger : public SyntaxVisitor
+class PSY_C_NON_API NameCataloger : public StaticSyntaxVisitor<NameCataloger>
 {
+    PSY_GRANT_ACCESS(StaticSyntaxVisitor<NameCataloger>);
+
 public:
     NameCataloger(SyntaxTree* tree);
 
     std::unique_ptr<NameCatalog> catalogFor(const SyntaxNode*);
+    std::unique_ptr<NameCatalog> catalogFor(const SyntaxNode*,
+                                            const std::vector<const DeclarationSyntax*>& declsWithAmbigs);
 
 private:
     std::unique_ptr<NameCatalog> catalog_;
+    const std::vector<const DeclarationSyntax*>* declsWithAmbigs_;
+    std::size_t nextDeclWithAmbigs_;
 
-    using SyntaxVisitor::visit;
-    using Base = SyntaxVisitor;
+    using StaticSyntaxVisitor::visit;
 
     //--------------//
     // Declarations //
     //--------------//
-    Action visitTranslationUnit(const TranslationUnitSyntax*) override;
+    Action visitTranslationUnit(const TranslationUnitSyntax*);
+    Action visitFunctionDefinition(const FunctionDefinitionSyntax*);
 
     /* Specifiers */
-    Action visitTypedefName(const TypedefNameSyntax*) override;
+    Action visitTypedefName(const TypedefNameSyntax*);
 
     /* Declarators */
-    Action visitIdentifierDeclarator(const IdentifierDeclaratorSyntax*) override;
+    Action visitIdentifierDeclarator(const IdentifierDeclaratorSyntax*);
 
     //-------------//
     // Expressions //
     //-------------//
-    Action visitIdentifierName(const IdentifierNameSyntax*) override;
+    Action visitIdentifierName(const IdentifierNameSyntax*);
 
     //-------------//
     // Ambiguities //
     //-------------//
-    Action visitAmbiguousTypeNameOrExpressionAsTypeReference(const AmbiguousTypeNameOrExpressionAsTypeReferenceSyntax*) override;
-    Action visitAmbiguousCastOrBinaryExpression(const AmbiguousCastOrBinaryExpressionSyntax*) override;
-    Action visitAmbiguousExpressionOrDeclarationStatement(const AmbiguousExpressionOrDeclarationStatementSyntax*) override;
+    Action visitAmbiguousTypeNameOrExpressionAsTypeReference(const AmbiguousTypeNameOrExpressionAsTypeReferenceSyntax*);
+    Action visitAmbiguousCastOrBinaryExpression(const AmbiguousCastOrBinaryExpressionSyntax*);
+    Action visitAmbiguousExpressionOrDeclarationStatement(const AmbiguousExpressionOrDeclarationStatementSyntax*);
 };
 
 } // C
@@ -49,25 +49,36 @@ void Reparser::setPermitHeuristic(bool heuristic)
 }
 
 void Reparser::reparse(SyntaxTree* tree)
+{
+    reparse(tree, {});
+}
+
+/**
+ * Reparse the \p tree, restricting the work to the given (external)
+ * \p declsWithAmbigs of its translation unit, if any is specified.
+ */
+void Reparser::reparse(SyntaxTree* tree, const std::vector<const DeclarationSyntax*>& declsWithAmbigs)
 {
     if (disambigStrategy_ == Reparser::DisambiguationStrategy::GuidelineImposition) {
         // TODO
         return;
     }
 
-    NameCataloger cataloger(tree);
-    auto catalog = cataloger.catalogFor(tree->root());
-
     switch (disambigStrategy_) {
         case Reparser::DisambiguationStrategy::SyntaxCorrelation: {
+            NameCataloger cataloger(tree);
+            auto catalog = cataloger.catalogFor(tree->root(), declsWithAmbigs);
             SyntaxCorrelationDisambiguator disambiguator(tree);
             disambiguator.acquireCatalog(std::move(catalog));
-            disambiguator.disambiguate();
+            disambiguator.disambiguate(declsWithAmbigs);
             break;
         }
 
-        case Reparser::DisambiguationStrategy::TypeSynonymsVerification:
+        case Reparser::DisambiguationStrategy::TypeSynonymsVerification: {
+            TypeSynonymsVerificationDisambiguator disambiguator(tree);
+            disambiguator.disambiguate(declsWithAmbigs);
             break;
+        }
 
         default:
             PSY_ESCAPE();
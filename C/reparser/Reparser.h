@@ -29,6 +29,7 @@
 #include "../common/infra/InternalAccess.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace psy {
 namespace C {
@@ -55,6 +56,7 @@ PSY_INTERNAL_AND_RESTRICTED:
     void setPermitHeuristic(bool heuristic);
 
     void reparse(SyntaxTree* tree);
+    void reparse(SyntaxTree* tree, const std::vector<const DeclarationSyntax*>& declsWithAmbigs);
 
 private:
     DisambiguationStrategy disambigStrategy_;
@@ -31,23 +31,52 @@
 #include <algorithm>
 #include <sstream>
 
-Symbol::Symbol(SymbolImpl* p)
+Symbol::Symbol(Arena* arena, SymbolImpl* p)
     : P(p)
-{}
+{
+    arena->adopt(this);
+}
 
 Symbol::~Symbol()
 {}
 
+void* Symbol::operator new(std::size_t size, Arena* arena)
+{
+    return arena->allocate(size);
+}
+
+void Symbol::operator delete(void*)
+{}
+
+void Symbol::operator delete(void*, Arena*)
+{}
+
+/*
+ * The implementation lives in the Arena: destroy it, but don't free it.
+ */
+void Symbol::SymbolImplFinalizer::operator()(SymbolImpl* p) const
+{
+    p->~SymbolImpl();
+}
+
 const Assembly* Symbol::owningAssembly() const
 {
-    for (auto compilation : P->tree_->linkedCompilations()) {
-        const auto&& syms = compilation->assembly()->symbols();
-        auto it = std::find(syms.begin(), syms.end(), this);
-        if (it != syms.end())
-            return compilation->assembly();
-    }
+    return P->assembly_;
+}
+
+void Symbol::setOwningAssembly(const Assembly* assembly)
+{
+    P->assembly_ = assembly;
+}
+
+void Symbol::setSyntaxTree(const SyntaxTree* tree)
+{
+    P->tree_ = tree;
+}
 
-    PSY_ESCAPE_VIA_RETURN(nullptr);
+const Symbol* Symbol::containingSymbol() const
+{
+    return P->containingSym_;
 }
 
 const Scope *Symbol::scope() const
@@ -75,6 +104,11 @@ const NameSpace* Symbol::nameSpace() const
     return P->ns_;
 }
 
+void Symbol::setNameSpace(const NameSpace* ns)
+{
+    P->ns_ = ns;
+}
+
 Location Symbol::location() const
 {
     const auto& synRefs = declaringSyntaxReferences();
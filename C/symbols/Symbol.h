@@ -32,8 +32,10 @@
 #include "syntax/SyntaxReference.h"
 
 #include "../common/location/Location.h"
+#include "../common/infra/InternalAccess.h"
 #include "../common/infra/Pimpl.h"
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -52,6 +54,13 @@ class PSY_C_API Symbol
 public:
     virtual ~Symbol();
 
+    /*
+     * Symbols are allocated from (and owned by) an Arena.
+     */
+    void* operator new(std::size_t size, Arena* arena);
+    void operator delete(void*);
+    void operator delete(void*, Arena*);
+
     /**
      * The SymbolKind of \c this Symbol.
      */
@@ -103,10 +112,19 @@ public:
      */
     std::vector<SyntaxReference> declaringSyntaxReferences() const;
 
+PSY_INTERNAL_AND_RESTRICTED:
+    PSY_GRANT_ACCESS(Assembly);
+    PSY_GRANT_ACCESS(Scope);
+    PSY_GRANT_ACCESS(SemanticModel);
+
+    void setOwningAssembly(const Assembly* assembly);
+    void setNameSpace(const NameSpace* ns);
+    void setSyntaxTree(const SyntaxTree* tree);
+
 protected:
-    DECL_PIMPL(Symbol);
+    DECL_PIMPL_IN_ARENA(Symbol);
 
-    Symbol(SymbolImpl* p);
+    Symbol(Arena* arena, SymbolImpl* p);
 
     // Unavailable
     Symbol(const Symbol&) = delete;
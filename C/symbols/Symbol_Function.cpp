@@ -44,12 +44,13 @@ struct FunctionSymbol::FunctionSymbolImpl : SymbolImpl
     const TypeSymbol* tySym_;
 };
 
-FunctionSymbol::FunctionSymbol(const SyntaxTree* tree,
+FunctionSymbol::FunctionSymbol(Arena* arena,
+                               const SyntaxTree* tree,
                                const Scope* scope,
                                const Symbol* containingSym)
-    : Symbol(new FunctionSymbolImpl(tree,
-                                    scope,
-                                    containingSym))
+    : Symbol(arena, new (arena) FunctionSymbolImpl(tree,
+                                                   scope,
+                                                   containingSym))
 {}
 
 const SymbolName* FunctionSymbol::name() const
@@ -72,7 +72,8 @@ public:
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(Binder);
 
-    FunctionSymbol(const SyntaxTree* tree,
+    FunctionSymbol(Arena* arena,
+                   const SyntaxTree* tree,
                    const Scope* scope,
                    const Symbol* containingSym);
 
@@ -26,13 +26,14 @@
 using namespace psy;
 using namespace C;
 
-LibrarySymbol::LibrarySymbol(const SyntaxTree* tree,
+LibrarySymbol::LibrarySymbol(Arena* arena,
+                             const SyntaxTree* tree,
                                const Scope* scope,
                                const Symbol* containingSym)
-    : Symbol(new SymbolImpl(tree,
-                            scope,
-                            containingSym,
-                            SymbolKind::Library))
+    : Symbol(arena, new (arena) SymbolImpl(tree,
+                                           scope,
+                                           containingSym,
+                                           SymbolKind::Library))
 {}
 
 namespace psy {
@@ -56,7 +56,8 @@ public:
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(Binder);
 
-    LibrarySymbol(const SyntaxTree* tree,
+    LibrarySymbol(Arena* arena,
+                  const SyntaxTree* tree,
                   const Scope* scope,
                   const Symbol* containingSym);
 };
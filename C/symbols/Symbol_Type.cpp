@@ -27,8 +27,8 @@
 using namespace psy;
 using namespace C;
 
-TypeSymbol::TypeSymbol(TypeSymbolImpl* p)
-    : Symbol(p)
+TypeSymbol::TypeSymbol(Arena* arena, TypeSymbolImpl* p)
+    : Symbol(arena, p)
 {}
 
 TypeSymbol::~TypeSymbol()
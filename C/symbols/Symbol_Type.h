@@ -94,6 +94,7 @@ public:
 
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(SemanticsOfTypeQualifiers);
+    PSY_GRANT_ACCESS(TypeInterner);
 
     void qualifyWithConst();
     void qualifyWithVolatile();
@@ -102,7 +103,7 @@ PSY_INTERNAL_AND_RESTRICTED:
 protected:
     DECL_PIMPL_SUB(TypeSymbol);
 
-    TypeSymbol(TypeSymbolImpl* p);
+    TypeSymbol(Arena* arena, TypeSymbolImpl* p);
 };
 
 std::string PSY_C_API to_string(const TypeSymbol& tySym);
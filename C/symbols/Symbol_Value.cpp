@@ -45,14 +45,15 @@ struct ValueSymbol::ValueSymbolImpl : SymbolImpl
     const TypeSymbol* tySym_;
 };
 
-ValueSymbol::ValueSymbol(const SyntaxTree* tree,
+ValueSymbol::ValueSymbol(Arena* arena,
+                         const SyntaxTree* tree,
                           const Scope* scope,
                           const Symbol* containingSym,
                           ValueKind valKind)
-    : Symbol(new ValueSymbolImpl(tree,
-                                 scope,
-                                 containingSym,
-                                 valKind))
+    : Symbol(arena, new (arena) ValueSymbolImpl(tree,
+                                                scope,
+                                                containingSym,
+                                                valKind))
 {}
 
 ValueSymbol::~ValueSymbol()
@@ -42,14 +42,15 @@ struct ArrayTypeSymbol::ArrayTypeSymbolImpl : TypeSymbolImpl
     const TypeSymbol* elemTySym_;
 };
 
-ArrayTypeSymbol::ArrayTypeSymbol(const SyntaxTree* tree,
+ArrayTypeSymbol::ArrayTypeSymbol(Arena* arena,
+                                 const SyntaxTree* tree,
                                  const Scope* scope,
                                  const Symbol* containingSym,
                                  const TypeSymbol* elemTySym)
-    : TypeSymbol(new ArrayTypeSymbolImpl(tree,
-                                         scope,
-                                         containingSym,
-                                         elemTySym))
+    : TypeSymbol(arena, new (arena) ArrayTypeSymbolImpl(tree,
+                                                        scope,
+                                                        containingSym,
+                                                        elemTySym))
 {}
 
 const TypeSymbol* ArrayTypeSymbol::elementType() const
@@ -55,8 +55,10 @@ public:
 
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(Binder);
+    PSY_GRANT_ACCESS(TypeInterner);
 
-    ArrayTypeSymbol(const SyntaxTree* tree,
+    ArrayTypeSymbol(Arena* arena,
+                    const SyntaxTree* tree,
                     const Scope* scope,
                     const Symbol* containingSym,
                     const TypeSymbol* elemTySym);
@@ -43,14 +43,15 @@ struct FunctionTypeSymbol::FunctionTypeSymbolImpl : TypeSymbolImpl
     std::vector<const TypeSymbol*> parmTySyms_;
 };
 
-FunctionTypeSymbol::FunctionTypeSymbol(const SyntaxTree* tree,
+FunctionTypeSymbol::FunctionTypeSymbol(Arena* arena,
+                                       const SyntaxTree* tree,
                                        const Scope* scope,
                                        const Symbol* containingSym,
                                        const TypeSymbol* retTySym)
-    : TypeSymbol(new FunctionTypeSymbolImpl(tree,
-                                            scope,
-                                            containingSym,
-                                            retTySym))
+    : TypeSymbol(arena, new (arena) FunctionTypeSymbolImpl(tree,
+                                                           scope,
+                                                           containingSym,
+                                                           retTySym))
 {}
 
 const TypeSymbol* FunctionTypeSymbol::returnType() const
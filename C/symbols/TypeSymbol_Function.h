@@ -56,8 +56,10 @@ public:
 
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(Binder);
+    PSY_GRANT_ACCESS(TypeInterner);
 
-    FunctionTypeSymbol(const SyntaxTree* tree,
+    FunctionTypeSymbol(Arena* arena,
+                       const SyntaxTree* tree,
                        const Scope* scope,
                        const Symbol* containingSym,
                        const TypeSymbol* retTySym);
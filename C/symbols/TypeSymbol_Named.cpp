@@ -39,53 +39,58 @@ struct NamedTypeSymbol::NamedTypeSymbolImpl : TypeSymbolImpl
                          TypeKind::Named)
         , name_(nullptr)
         , namedTypeKind_(namedTypeKind)
+        , resolvedSynTySym_(nullptr)
     {}
 
     std::unique_ptr<SymbolName> name_;
     NamedTypeKind namedTypeKind_;
     BuiltinTypeKind builtTyKind_;
+    const TypeSymbol* resolvedSynTySym_;
 };
 
-NamedTypeSymbol::NamedTypeSymbol(const SyntaxTree* tree,
+NamedTypeSymbol::NamedTypeSymbol(Arena* arena,
+                                 const SyntaxTree* tree,
                                  const Scope* scope,
                                  const Symbol* containingSym,
                                  BuiltinTypeKind builtTyKind)
-    : TypeSymbol(new NamedTypeSymbolImpl(tree,
-                                         scope,
-                                         containingSym,
-                                         NamedTypeKind::Builtin))
+    : TypeSymbol(arena, new (arena) NamedTypeSymbolImpl(tree,
+                                                        scope,
+                                                        containingSym,
+                                                        NamedTypeKind::Builtin))
 {
     patchBuiltinTypeKind(builtTyKind);
 }
 
-NamedTypeSymbol::NamedTypeSymbol(const SyntaxTree* tree,
+NamedTypeSymbol::NamedTypeSymbol(Arena* arena,
+                                 const SyntaxTree* tree,
                                  const Scope* scope,
                                  const Symbol* containingSym,
                                  const std::string& name)
-    : TypeSymbol(new NamedTypeSymbolImpl(tree,
-                                         scope,
-                                         containingSym,
-                                         NamedTypeKind::Synonym))
+    : TypeSymbol(arena, new (arena) NamedTypeSymbolImpl(tree,
+                                                        scope,
+                                                        containingSym,
+                                                        NamedTypeKind::Synonym))
 {
     P_CAST->name_.reset(new PlainSymbolName(name));
 }
 
-NamedTypeSymbol::NamedTypeSymbol(const SyntaxTree* tree,
+NamedTypeSymbol::NamedTypeSymbol(Arena* arena,
+                                 const SyntaxTree* tree,
                                  const Scope* scope,
                                  const Symbol* containingSym,
                                  TagSymbolName::TagChoice tagChoice,
                                  const std::string& tag)
-    : TypeSymbol(new NamedTypeSymbolImpl(
-                        tree,
-                        scope,
-                        containingSym,
-                        tagChoice == TagSymbolName::TagChoice::Struct
-                            ? NamedTypeKind::Structure
-                            : tagChoice == TagSymbolName::TagChoice::Union
-                                ? NamedTypeKind::Union
-                                : tagChoice == TagSymbolName::TagChoice::Enum
-                                    ? NamedTypeKind::Enumeration
-                                    : NamedTypeKind::UNSPECIFIED))
+    : TypeSymbol(arena, new (arena) NamedTypeSymbolImpl(
+                tree,
+                scope,
+                containingSym,
+                tagChoice == TagSymbolName::TagChoice::Struct
+                    ? NamedTypeKind::Structure
+                    : tagChoice == TagSymbolName::TagChoice::Union
+                        ? NamedTypeKind::Union
+                        : tagChoice == TagSymbolName::TagChoice::Enum
+                            ? NamedTypeKind::Enumeration
+                            : NamedTypeKind::UNSPECIFIED))
 {
     P_CAST->name_.reset(new TagSymbolName(tagChoice, tag));
 }
@@ -111,6 +116,19 @@ void NamedTypeSymbol::patchBuiltinTypeKind(BuiltinTypeKind builtTyKind)
     P_CAST->builtTyKind_ = builtTyKind;
 }
 
+/*
+ * The type designated by a synonym, as declared by its typedef.
+ */
+void NamedTypeSymbol::resolveSynonymTo(const TypeSymbol* tySym)
+{
+    P_CAST->resolvedSynTySym_ = tySym;
+}
+
+const TypeSymbol* NamedTypeSymbol::resolvedSynonym() const
+{
+    return P_CAST->resolvedSynTySym_;
+}
+
 namespace psy {
 namespace C {
 
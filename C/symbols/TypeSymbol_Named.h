@@ -68,18 +68,23 @@ public:
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(Binder);
     PSY_GRANT_ACCESS(ConstraintsInTypeSpecifiers);
+    PSY_GRANT_ACCESS(TypeInterner);
+    PSY_GRANT_ACCESS(TypeChecker);
 
-    NamedTypeSymbol(const SyntaxTree* tree,
+    NamedTypeSymbol(Arena* arena,
+                    const SyntaxTree* tree,
                     const Scope* scope,
                     const Symbol* containingSym,
                     BuiltinTypeKind builtTyK);
 
-    NamedTypeSymbol(const SyntaxTree* tree,
+    NamedTypeSymbol(Arena* arena,
+                    const SyntaxTree* tree,
                     const Scope* scope,
                     const Symbol* containingSym,
                     const std::string& name);
 
-    NamedTypeSymbol(const SyntaxTree* tree,
+    NamedTypeSymbol(Arena* arena,
+                    const SyntaxTree* tree,
                     const Scope* scope,
                     const Symbol* containingSym,
                     TagSymbolName::TagChoice tagChoice,
@@ -87,6 +92,9 @@ PSY_INTERNAL_AND_RESTRICTED:
 
     void patchBuiltinTypeKind(BuiltinTypeKind);
 
+    void resolveSynonymTo(const TypeSymbol* tySym);
+    const TypeSymbol* resolvedSynonym() const;
+
 private:
     DECL_PIMPL_SUB(NamedTypeSymbol)
 };
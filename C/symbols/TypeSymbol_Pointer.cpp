@@ -46,14 +46,15 @@ struct PointerTypeSymbol::PointerTypeSymbolImpl : TypeSymbolImpl
     bool functionDecay_;
 };
 
-PointerTypeSymbol::PointerTypeSymbol(const SyntaxTree* tree,
+PointerTypeSymbol::PointerTypeSymbol(Arena* arena,
+                                     const SyntaxTree* tree,
                                      const Scope* scope,
                                      const Symbol* containingSym,
                                      const TypeSymbol* refedTySym)
-    : TypeSymbol(new PointerTypeSymbolImpl(tree,
-                                           scope,
-                                           containingSym,
-                                           refedTySym))
+    : TypeSymbol(arena, new (arena) PointerTypeSymbolImpl(tree,
+                                                          scope,
+                                                          containingSym,
+                                                          refedTySym))
 {}
 
 const TypeSymbol* PointerTypeSymbol::referencedType() const
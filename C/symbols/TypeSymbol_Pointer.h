@@ -69,8 +69,10 @@ public:
 
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(Binder);
+    PSY_GRANT_ACCESS(TypeInterner);
 
-    PointerTypeSymbol(const SyntaxTree* tree,
+    PointerTypeSymbol(Arena* arena,
+                      const SyntaxTree* tree,
                       const Scope* scope,
                       const Symbol* containingSym,
                       const TypeSymbol* refedTySym);
@@ -28,10 +28,12 @@
 using namespace psy;
 using namespace C;
 
-EnumeratorSymbol::EnumeratorSymbol(const SyntaxTree* tree,
+EnumeratorSymbol::EnumeratorSymbol(Arena* arena,
+                                   const SyntaxTree* tree,
                                    const Scope* scope,
                                    const Symbol* containingSym)
-    : ValueSymbol(tree,
+    : ValueSymbol(arena,
+                  tree,
                   scope,
                   containingSym,
                   ValueKind::Enumerator)
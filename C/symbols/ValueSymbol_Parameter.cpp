@@ -28,10 +28,12 @@
 using namespace psy;
 using namespace C;
 
-ParameterSymbol::ParameterSymbol(const SyntaxTree* tree,
+ParameterSymbol::ParameterSymbol(Arena* arena,
+                                 const SyntaxTree* tree,
                                  const Scope* scope,
                                  const Symbol* containingSym)
-    : ValueSymbol(tree,
+    : ValueSymbol(arena,
+                  tree,
                   scope,
                   containingSym,
                   ValueKind::Parameter)
@@ -47,7 +47,8 @@ public:
 PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(Binder);
 
-    ParameterSymbol(const SyntaxTree* tree,
+    ParameterSymbol(Arena* arena,
+                    const SyntaxTree* tree,
                     const Scope* scope,
                     const Symbol* containingSym);
 };
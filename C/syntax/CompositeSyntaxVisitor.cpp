@@ -0,0 +1,117 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "CompositeSyntaxVisitor.h"
+
+#include "StaticSyntaxVisitor.h"
+#include "SyntaxNodes.h"
+#include "SyntaxVisitor.h"
+
+#include <cstddef>
+#include <vector>
+
+using namespace psy;
+using namespace C;
+
+/*
+ * The traversal itself is that of a StaticSyntaxVisitor; the added visitors
+ * are dispatched to, virtually, from `preVisit'. The visitors still active
+ * at each level of the traversal are kept, by index, in a stack of frames
+ * (flattened into a single vector).
+ */
+struct CompositeSyntaxVisitor::CompositeSyntaxVisitorImpl
+        : StaticSyntaxVisitor<CompositeSyntaxVisitorImpl>
+{
+    CompositeSyntaxVisitorImpl()
+        : StaticSyntaxVisitor(nullptr)
+    {}
+
+    bool preVisit(const SyntaxNode* node)
+    {
+        auto frameBegin = active_.size();
+        for (auto i = frames_.back(); i < frameBegin; ++i) {
+            auto idx = active_[i];
+            if (quit_[idx])
+                continue;
+
+            auto visitor = visitors_[idx];
+            if (!visitor->preVisit(node))
+                continue;
+
+            switch (node->dispatchVisit(visitor)) {
+                case Action::Visit:
+                    active_.push_back(idx);
+                    break;
+
+                case Action::Skip:
+                    break;
+
+                case Action::Quit:
+                    quit_[idx] = true;
+                    break;
+            }
+        }
+        frames_.push_back(frameBegin);
+
+        return active_.size() > frameBegin;
+    }
+
+    void postVisit(const SyntaxNode* node)
+    {
+        auto frameBegin = frames_.back();
+        frames_.pop_back();
+        active_.resize(frameBegin);
+
+        for (auto i = frames_.back(); i < frameBegin; ++i) {
+            auto idx = active_[i];
+            if (!quit_[idx])
+                visitors_[idx]->postVisit(node);
+        }
+    }
+
+    std::vector<SyntaxVisitor*> visitors_;
+    std::vector<bool> quit_;
+    std::vector<std::size_t> active_;
+    std::vector<std::size_t> frames_;
+};
+
+CompositeSyntaxVisitor::CompositeSyntaxVisitor()
+    : P(new CompositeSyntaxVisitorImpl)
+{}
+
+CompositeSyntaxVisitor::~CompositeSyntaxVisitor()
+{}
+
+void CompositeSyntaxVisitor::add(SyntaxVisitor* visitor)
+{
+    P->visitors_.push_back(visitor);
+}
+
+void CompositeSyntaxVisitor::visit(const SyntaxNode* node)
+{
+    P->quit_.assign(P->visitors_.size(), false);
+    P->active_.clear();
+    for (std::size_t idx = 0; idx < P->visitors_.size(); ++idx)
+        P->active_.push_back(idx);
+    P->frames_.assign(1, 0);
+
+    P->visit(node);
+}
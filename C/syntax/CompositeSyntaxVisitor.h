@@ -0,0 +1,77 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef PSYCHE_C_COMPOSITE_SYNTAX_VISITOR_H__
+#define PSYCHE_C_COMPOSITE_SYNTAX_VISITOR_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "../common/infra/Pimpl.h"
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The CompositeSyntaxVisitor class.
+ *
+ * A driver that runs the added SyntaxVisitors in lock-step, during a single
+ * traversal: at every node, the callbacks of each visitor are invoked (in
+ * the order in which the visitors were added) before the traversal moves on.
+ *
+ * The Action of each visitor is honored independently: a visitor that
+ * returns \c Action::Skip (or whose \c preVisit returns \c false) doesn't
+ * see the descendants of the node at hand, while the others do; a visitor
+ * that returns \c Action::Quit receives no further callbacks for the rest
+ * of the traversal.
+ *
+ * \remark A visitor that, in a callback, drives the traversal on its own
+ * (by calling SyntaxVisitor::visit on a child) and returns \c Action::Skip
+ * still works as expected; only that portion of the tree isn't shared.
+ */
+class PSY_C_API CompositeSyntaxVisitor
+{
+public:
+    CompositeSyntaxVisitor();
+    ~CompositeSyntaxVisitor();
+
+    /**
+     * Add the SyntaxVisitor \p visitor to \c this CompositeSyntaxVisitor.
+     */
+    void add(SyntaxVisitor* visitor);
+
+    /**
+     * Visit the SyntaxNode \p node with every added SyntaxVisitor.
+     */
+    void visit(const SyntaxNode* node);
+
+private:
+    // Unavailable
+    CompositeSyntaxVisitor(const CompositeSyntaxVisitor&) = delete;
+    CompositeSyntaxVisitor& operator=(const CompositeSyntaxVisitor&) = delete;
+
+    DECL_PIMPL(CompositeSyntaxVisitor)
+};
+
+} // C
+} // psy
+
+#endif
@@ -0,0 +1,214 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "ParallelSyntaxTraversal.h"
+
+#include "SyntaxNodes.h"
+#include "SyntaxVisitor.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace psy;
+using namespace C;
+
+struct ParallelSyntaxTraversal::ParallelSyntaxTraversalImpl
+{
+    ParallelSyntaxTraversalImpl(VisitorFactory factory, Reducer reducer)
+        : factory_(std::move(factory))
+        , reducer_(std::move(reducer))
+        , quit_(false)
+    {}
+
+    ~ParallelSyntaxTraversalImpl()
+    {
+        {
+            std::lock_guard<std::mutex> lock(poolMutex_);
+            quit_ = true;
+        }
+        poolCond_.notify_all();
+        for (auto& thread : threads_)
+            thread.join();
+    }
+
+    void run(std::function<void()> task, unsigned int cnt);
+    void work();
+
+    VisitorFactory factory_;
+    Reducer reducer_;
+
+    /*
+     * The pool: its threads are created on demand (up to the largest count
+     * requested for a traversal) and wait for tasks until destruction.
+     */
+    std::vector<std::thread> threads_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex poolMutex_;
+    std::condition_variable poolCond_;
+    bool quit_;
+};
+
+void ParallelSyntaxTraversal::ParallelSyntaxTraversalImpl::run(std::function<void()> task,
+                                                               unsigned int cnt)
+{
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        while (threads_.size() < cnt)
+            threads_.emplace_back(&ParallelSyntaxTraversalImpl::work, this);
+        for (auto i = 0u; i < cnt; ++i)
+            tasks_.push_back(task);
+    }
+    poolCond_.notify_all();
+}
+
+void ParallelSyntaxTraversal::ParallelSyntaxTraversalImpl::work()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(poolMutex_);
+            poolCond_.wait(lock, [this] () { return quit_ || !tasks_.empty(); });
+            if (tasks_.empty())
+                return;
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+ParallelSyntaxTraversal::ParallelSyntaxTraversal(VisitorFactory factory, Reducer reducer)
+    : P(new ParallelSyntaxTraversalImpl(std::move(factory), std::move(reducer)))
+{}
+
+ParallelSyntaxTraversal::~ParallelSyntaxTraversal()
+{}
+
+void ParallelSyntaxTraversal::traverse(const TranslationUnitSyntax* unit,
+                                       unsigned int threadCnt) const
+{
+    if (!unit)
+        return;
+
+    std::vector<const DeclarationSyntax*> decls;
+    for (auto iter = unit->declarations(); iter; iter = iter->next) {
+        if (iter->value)
+            decls.push_back(iter->value);
+    }
+    if (decls.empty())
+        return;
+
+    threadCnt = std::max(1u, std::min(threadCnt, static_cast<unsigned int>(decls.size())));
+
+    /*
+     * The declarations (whose sizes vary wildly) are handed out one at a
+     * time, so that a worker that is done with a small one picks up the
+     * next instead of idling behind a static partition. The calling thread
+     * is a worker too and, in between declarations, it reduces those that
+     * are ready (in source order).
+     */
+    std::vector<std::unique_ptr<SyntaxVisitor>> visitors(decls.size());
+    std::vector<bool> isVisited(decls.size(), false);
+    std::size_t nextIdx = 0;
+    std::size_t reducedCnt = 0;
+    unsigned int busyCnt = threadCnt;
+    std::exception_ptr excpt;
+    std::mutex mutex;
+    std::condition_variable cond;
+
+    auto fail = [&] () {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!excpt)
+            excpt = std::current_exception();
+        nextIdx = decls.size();
+    };
+    auto visitDecl = [&] (std::size_t idx) {
+        try {
+            auto visitor = P->factory_();
+            visitor->visit(decls[idx]);
+            std::lock_guard<std::mutex> lock(mutex);
+            visitors[idx] = std::move(visitor);
+            isVisited[idx] = true;
+        } catch (...) {
+            fail();
+        }
+        cond.notify_all();
+    };
+    auto nextDecl = [&] () {
+        std::lock_guard<std::mutex> lock(mutex);
+        return nextIdx < decls.size() ? nextIdx++ : decls.size();
+    };
+    auto visitDecls = [&] () {
+        for (auto idx = nextDecl(); idx < decls.size(); idx = nextDecl())
+            visitDecl(idx);
+
+        // Once the count drops, the caller may be gone (see below).
+        std::lock_guard<std::mutex> lock(mutex);
+        --busyCnt;
+        cond.notify_all();
+    };
+    auto reduceReady = [&] (bool wait) {
+        while (reducedCnt < decls.size()) {
+            std::unique_ptr<SyntaxVisitor> visitor;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (wait) {
+                    cond.wait(lock, [&] () {
+                        return isVisited[reducedCnt] || (excpt && busyCnt == 0);
+                    });
+                }
+                if (excpt || !isVisited[reducedCnt])
+                    return;
+                visitor = std::move(visitors[reducedCnt]);
+            }
+            try {
+                P->reducer_(decls[reducedCnt], visitor.get());
+            } catch (...) {
+                fail();
+                return;
+            }
+            ++reducedCnt;
+        }
+    };
+
+    P->run(visitDecls, threadCnt - 1);
+    for (auto idx = nextDecl(); idx < decls.size(); idx = nextDecl()) {
+        visitDecl(idx);
+        reduceReady(false);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        --busyCnt;
+    }
+    reduceReady(true);
+
+    // The workers may still be referring to the local state.
+    std::unique_lock<std::mutex> lock(mutex);
+    cond.wait(lock, [&] () { return busyCnt == 0; });
+    if (excpt)
+        std::rethrow_exception(excpt);
+}
@@ -0,0 +1,80 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef PSYCHE_C_PARALLEL_SYNTAX_TRAVERSAL_H__
+#define PSYCHE_C_PARALLEL_SYNTAX_TRAVERSAL_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "../common/infra/Pimpl.h"
+
+#include <functional>
+#include <memory>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The ParallelSyntaxTraversal class.
+ *
+ * A traversal, for read-only analyses, in which the top-level declarations
+ * of a TranslationUnit are visited concurrently (by a pool of threads that's
+ * kept across traversals): each declaration is visited by a SyntaxVisitor of
+ * its own, created by the VisitorFactory; the Reducer is called, in the
+ * calling thread, once per declaration and in source order, as soon as that
+ * declaration and all the ones before it are visited. A visitor is destroyed
+ * right after its declaration is reduced.
+ *
+ * \remark The VisitorFactory is called from the worker threads. The visitors
+ * must not modify the SyntaxTree or share state with each other (unless
+ * synchronized); the Reducer is where results are merged.
+ *
+ * \remark If the VisitorFactory or a visitor throws, no further declaration
+ * is visited nor reduced, and the (first) exception is rethrown by traverse.
+ */
+class PSY_C_API ParallelSyntaxTraversal
+{
+public:
+    using VisitorFactory = std::function<std::unique_ptr<SyntaxVisitor>()>;
+    using Reducer = std::function<void(const DeclarationSyntax*, SyntaxVisitor*)>;
+
+    ParallelSyntaxTraversal(VisitorFactory factory, Reducer reducer);
+    ~ParallelSyntaxTraversal();
+
+    /**
+     * Traverse the TranslationUnit \p unit, visiting up to \p threadCnt
+     * top-level declarations concurrently.
+     */
+    void traverse(const TranslationUnitSyntax* unit, unsigned int threadCnt) const;
+
+private:
+    // Unavailable
+    ParallelSyntaxTraversal(const ParallelSyntaxTraversal&) = delete;
+    ParallelSyntaxTraversal& operator=(const ParallelSyntaxTraversal&) = delete;
+
+    DECL_PIMPL(ParallelSyntaxTraversal)
+};
+
+} // C
+} // psy
+
+#endif
@@ -0,0 +1,646 @@
+// Copyright (c) 2016/17/18/19/20/21/22 Leandro T. C. Melo <ltcmelo@gmail.com>
+// Copyright (c) 2008 Roberto Raggi <roberto.raggi@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_STATIC_SYNTAX_VISITOR_H__
+#define PSYCHE_C_STATIC_SYNTAX_VISITOR_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "SyntaxNodes.h"
+#include "SyntaxVisitor.h"
+
+#include "../common/infra/Escape.h"
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The StaticSyntaxVisitor class \b template.
+ *
+ * A SyntaxVisitor whose dispatch is resolved at compile time: the callbacks
+ * of \p DerivedT (which \em hide, rather than override, those declared
+ * here) are selected by a switch on the SyntaxKind of a node, and the
+ * children of the node are enumerated without a \c std::vector of
+ * SyntaxHolder. The callbacks and the traversal may thus be inlined.
+ *
+ * \remark The (virtual) SyntaxVisitor remains the visitor of the API; this
+ * one is meant for the internal passes in which traversal is hot.
+ *
+ * \note A \p DerivedT whose callbacks aren't public must grant access to
+ * \c StaticSyntaxVisitor<DerivedT>.
+ */
+template <class DerivedT>
+class PSY_C_NON_API StaticSyntaxVisitor
+{
+public:
+    StaticSyntaxVisitor(const SyntaxTree* tree)
+        : tree_(tree)
+    {}
+
+    using Action = SyntaxVisitor::Action;
+
+    bool preVisit(const SyntaxNode*) { return true; }
+    void postVisit(const SyntaxNode*) {}
+
+    /**
+     * Visit the SyntaxNode \p node.
+     */
+    void visit(const SyntaxNode* node)
+    {
+        if (!node)
+            return;
+
+        if (derived()->preVisit(node))
+            dispatch(node);
+        derived()->postVisit(node);
+    }
+
+    /**
+     * Visit the SyntaxNodePlainList \p it.
+     */
+    template <class PtrT, class DerivedListT>
+    void visit(const CoreSyntaxNodeList<PtrT, DerivedListT>* it)
+    {
+        for (; it; it = it->next)
+            visit(it->value);
+    }
+
+    //--------------//
+    // Declarations //
+    //--------------//
+    Action visitTranslationUnit(const TranslationUnitSyntax*) { return Action::Visit; }
+    Action visitIncompleteDeclaration(const IncompleteDeclarationSyntax*) { return Action::Visit; }
+    Action visitStructOrUnionDeclaration(const StructOrUnionDeclarationSyntax*) { return Action::Visit; }
+    Action visitEnumDeclaration(const EnumDeclarationSyntax*) { return Action::Visit; }
+    Action visitEnumeratorDeclaration(const EnumeratorDeclarationSyntax*) { return Action::Visit; }
+    Action visitVariableAndOrFunctionDeclaration(const VariableAndOrFunctionDeclarationSyntax*) { return Action::Visit; }
+    Action visitFieldDeclaration(const FieldDeclarationSyntax*) { return Action::Visit; }
+    Action visitParameterDeclaration(const ParameterDeclarationSyntax*) { return Action::Visit; }
+    Action visitStaticAssertDeclaration(const StaticAssertDeclarationSyntax*) { return Action::Visit; }
+    Action visitFunctionDefinition(const FunctionDefinitionSyntax*) { return Action::Visit; }
+    Action visitExtPSY_TemplateDeclaration(const ExtPSY_TemplateDeclarationSyntax*) { return Action::Visit; }
+    Action visitExtGNU_AsmStatementDeclaration(const ExtGNU_AsmStatementDeclarationSyntax*) { return Action::Visit; }
+    Action visitExtKR_ParameterDeclaration(const ExtKR_ParameterDeclarationSyntax*) { return Action::Visit; }
+
+    /* Specifiers */
+    Action visitStorageClass(const StorageClassSyntax*) { return Action::Visit; }
+    Action visitBuiltinTypeSpecifier(const BuiltinTypeSpecifierSyntax*) { return Action::Visit; }
+    Action visitTagTypeSpecifier(const TagTypeSpecifierSyntax*) { return Action::Visit; }
+    Action visitAtomicTypeSpecifier(const AtomicTypeSpecifierSyntax*) { return Action::Visit; }
+    Action visitTypeDeclarationAsSpecifier(const TypeDeclarationAsSpecifierSyntax*) { return Action::Visit; }
+    Action visitTypedefName(const TypedefNameSyntax*) { return Action::Visit; }
+    Action visitTypeQualifier(const TypeQualifierSyntax*) { return Action::Visit; }
+    Action visitFunctionSpecifier(const FunctionSpecifierSyntax*) { return Action::Visit; }
+    Action visitAlignmentSpecifier(const AlignmentSpecifierSyntax*) { return Action::Visit; }
+    Action visitExtGNU_Typeof(const ExtGNU_TypeofSyntax*) { return Action::Visit; }
+    Action visitExtGNU_AttributeSpecifier(const ExtGNU_AttributeSpecifierSyntax*) { return Action::Visit; }
+    Action visitExtGNU_Attribute(const ExtGNU_AttributeSyntax*) { return Action::Visit; }
+    Action visitExtGNU_AsmLabel(const ExtGNU_AsmLabelSyntax*) { return Action::Visit; }
+    Action visitExtPSY_QuantifiedTypeSpecifier(const ExtPSY_QuantifiedTypeSpecifierSyntax*) { return Action::Visit; }
+
+    /* Declarators */
+    Action visitArrayOrFunctionDeclarator(const ArrayOrFunctionDeclaratorSyntax*) { return Action::Visit; }
+    Action visitPointerDeclarator(const PointerDeclaratorSyntax*) { return Action::Visit; }
+    Action visitParenthesizedDeclarator(const ParenthesizedDeclaratorSyntax*) { return Action::Visit; }
+    Action visitIdentifierDeclarator(const IdentifierDeclaratorSyntax*) { return Action::Visit; }
+    Action visitAbstractDeclarator(const AbstractDeclaratorSyntax*) { return Action::Visit; }
+    Action visitSubscriptSuffix(const SubscriptSuffixSyntax*) { return Action::Visit; }
+    Action visitParameterSuffix(const ParameterSuffixSyntax*) { return Action::Visit; }
+    Action visitBitfieldDeclarator(const BitfieldDeclaratorSyntax*) { return Action::Visit; }
+
+    /* Initializers */
+    Action visitExpressionInitializer(const ExpressionInitializerSyntax*) { return Action::Visit; }
+    Action visitBraceEnclosedInitializer(const BraceEnclosedInitializerSyntax*) { return Action::Visit; }
+    Action visitDesignatedInitializer(const DesignatedInitializerSyntax*) { return Action::Visit; }
+    Action visitFieldDesignator(const FieldDesignatorSyntax*) { return Action::Visit; }
+    Action visitArrayDesignator(const ArrayDesignatorSyntax*) { return Action::Visit; }
+    Action visitOffsetOfDesignator(const OffsetOfDesignatorSyntax*) { return Action::Visit; }
+
+    //-------------//
+    // Expressions //
+    //-------------//
+    Action visitIdentifierName(const IdentifierNameSyntax*) { return Action::Visit; }
+    Action visitPredefinedName(const PredefinedNameSyntax*) { return Action::Visit; }
+    Action visitConstantExpression(const ConstantExpressionSyntax*) { return Action::Visit; }
+    Action visitStringLiteralExpression(const StringLiteralExpressionSyntax*) { return Action::Visit; }
+    Action visitParenthesizedExpression(const ParenthesizedExpressionSyntax*) { return Action::Visit; }
+    Action visitGenericSelectionExpression(const GenericSelectionExpressionSyntax*) { return Action::Visit; }
+    Action visitGenericAssociation(const GenericAssociationSyntax*) { return Action::Visit; }
+    Action visitExtGNU_EnclosedCompoundStatementExpression(const ExtGNU_EnclosedCompoundStatementExpressionSyntax*) { return Action::Visit; }
+    Action visitExtGNU_ComplexValuedExpression(const ExtGNU_ComplexValuedExpressionSyntax*) { return Action::Visit; }
+
+    /* Operations */
+    Action visitPrefixUnaryExpression(const PrefixUnaryExpressionSyntax*) { return Action::Visit; }
+    Action visitPostfixUnaryExpression(const PostfixUnaryExpressionSyntax*) { return Action::Visit; }
+    Action visitMemberAccessExpression(const MemberAccessExpressionSyntax*) { return Action::Visit; }
+    Action visitArraySubscriptExpression(const ArraySubscriptExpressionSyntax*) { return Action::Visit; }
+    Action visitTypeTraitExpression(const TypeTraitExpressionSyntax*) { return Action::Visit; }
+    Action visitCastExpression(const CastExpressionSyntax*) { return Action::Visit; }
+    Action visitCallExpression(const CallExpressionSyntax*) { return Action::Visit; }
+    Action visitVAArgumentExpression(const VAArgumentExpressionSyntax*) { return Action::Visit; }
+    Action visitOffsetOfExpression(const OffsetOfExpressionSyntax*) { return Action::Visit; }
+    Action visitCompoundLiteralExpression(const CompoundLiteralExpressionSyntax*) { return Action::Visit; }
+    Action visitBinaryExpression(const BinaryExpressionSyntax*) { return Action::Visit; }
+    Action visitConditionalExpression(const ConditionalExpressionSyntax*) { return Action::Visit; }
+    Action visitAssignmentExpression(const AssignmentExpressionSyntax*) { return Action::Visit; }
+    Action visitSequencingExpression(const SequencingExpressionSyntax*) { return Action::Visit; }
+    Action visitExtGNU_ChooseExpression(const ExtGNU_ChooseExpressionSyntax*) { return Action::Visit; }
+
+    //------------//
+    // Statements //
+    //------------//
+    Action visitCompoundStatement(const CompoundStatementSyntax*) { return Action::Visit; }
+    Action visitDeclarationStatement(const DeclarationStatementSyntax*) { return Action::Visit; }
+    Action visitExpressionStatement(const ExpressionStatementSyntax*) { return Action::Visit; }
+    Action visitLabeledStatement(const LabeledStatementSyntax*) { return Action::Visit; }
+    Action visitIfStatement(const IfStatementSyntax*) { return Action::Visit; }
+    Action visitSwitchStatement(const SwitchStatementSyntax*) { return Action::Visit; }
+    Action visitWhileStatement(const WhileStatementSyntax*) { return Action::Visit; }
+    Action visitDoStatement(const DoStatementSyntax*) { return Action::Visit; }
+    Action visitForStatement(const ForStatementSyntax*) { return Action::Visit; }
+    Action visitGotoStatement(const GotoStatementSyntax*) { return Action::Visit; }
+    Action visitContinueStatement(const ContinueStatementSyntax*) { return Action::Visit; }
+    Action visitBreakStatement(const BreakStatementSyntax*) { return Action::Visit; }
+    Action visitReturnStatement(const ReturnStatementSyntax*) { return Action::Visit; }
+    Action visitExtGNU_AsmStatement(const ExtGNU_AsmStatementSyntax*) { return Action::Visit; }
+    Action visitExtGNU_AsmQualifier(const ExtGNU_AsmQualifierSyntax*) { return Action::Visit; }
+    Action visitExtGNU_AsmOperand(const ExtGNU_AsmOperandSyntax*) { return Action::Visit; }
+
+    //--------//
+    // Common //
+    //--------//
+    Action visitTypeName(const TypeNameSyntax*) { return Action::Visit; }
+    Action visitExpressionAsTypeReference(const ExpressionAsTypeReferenceSyntax*) { return Action::Visit; }
+    Action visitTypeNameAsTypeReference(const TypeNameAsTypeReferenceSyntax*) { return Action::Visit; }
+
+    //-------------//
+    // Ambiguities //
+    //-------------//
+    Action visitAmbiguousTypeNameOrExpressionAsTypeReference(const AmbiguousTypeNameOrExpressionAsTypeReferenceSyntax*) { return Action::Visit; }
+    Action visitAmbiguousCastOrBinaryExpression(const AmbiguousCastOrBinaryExpressionSyntax*) { return Action::Visit; }
+    Action visitAmbiguousExpressionOrDeclarationStatement(const AmbiguousExpressionOrDeclarationStatementSyntax*) { return Action::Visit; }
+
+protected:
+    ~StaticSyntaxVisitor() = default;
+
+    // Unavailable.
+    StaticSyntaxVisitor(const StaticSyntaxVisitor&) = delete;
+    void operator=(const StaticSyntaxVisitor&) = delete;
+
+    const SyntaxTree* tree_;
+
+private:
+    DerivedT* derived() { return static_cast<DerivedT*>(this); }
+
+    template <class NodeT, class VisitorT>
+    void dispatch(const NodeT* node, Action (VisitorT::*visitFunc)(const NodeT*))
+    {
+        if ((derived()->*visitFunc)(node) == Action::Visit)
+            node->traverseChildren(this);
+    }
+
+    void dispatch(const SyntaxNode* node)
+    {
+        switch (node->kind()) {
+            case TranslationUnit:
+                dispatch(static_cast<const TranslationUnitSyntax*>(node), &DerivedT::visitTranslationUnit);
+                break;
+
+            case IncompleteDeclaration:
+                dispatch(static_cast<const IncompleteDeclarationSyntax*>(node), &DerivedT::visitIncompleteDeclaration);
+                break;
+
+            case StructDeclaration:
+            case UnionDeclaration:
+                dispatch(static_cast<const StructOrUnionDeclarationSyntax*>(node), &DerivedT::visitStructOrUnionDeclaration);
+                break;
+
+            case EnumDeclaration:
+                dispatch(static_cast<const EnumDeclarationSyntax*>(node), &DerivedT::visitEnumDeclaration);
+                break;
+
+            case EnumeratorDeclaration:
+                dispatch(static_cast<const EnumeratorDeclarationSyntax*>(node), &DerivedT::visitEnumeratorDeclaration);
+                break;
+
+            case VariableAndOrFunctionDeclaration:
+                dispatch(static_cast<const VariableAndOrFunctionDeclarationSyntax*>(node), &DerivedT::visitVariableAndOrFunctionDeclaration);
+                break;
+
+            case FieldDeclaration:
+                dispatch(static_cast<const FieldDeclarationSyntax*>(node), &DerivedT::visitFieldDeclaration);
+                break;
+
+            case ParameterDeclaration:
+                dispatch(static_cast<const ParameterDeclarationSyntax*>(node), &DerivedT::visitParameterDeclaration);
+                break;
+
+            case StaticAssertDeclaration:
+                dispatch(static_cast<const StaticAssertDeclarationSyntax*>(node), &DerivedT::visitStaticAssertDeclaration);
+                break;
+
+            case FunctionDefinition:
+                dispatch(static_cast<const FunctionDefinitionSyntax*>(node), &DerivedT::visitFunctionDefinition);
+                break;
+
+            case ExtPSY_TemplateDeclaration:
+                dispatch(static_cast<const ExtPSY_TemplateDeclarationSyntax*>(node), &DerivedT::visitExtPSY_TemplateDeclaration);
+                break;
+
+            case ExtGNU_AsmStatementDeclaration:
+                dispatch(static_cast<const ExtGNU_AsmStatementDeclarationSyntax*>(node), &DerivedT::visitExtGNU_AsmStatementDeclaration);
+                break;
+
+            case ExtKR_ParameterDeclaration:
+                dispatch(static_cast<const ExtKR_ParameterDeclarationSyntax*>(node), &DerivedT::visitExtKR_ParameterDeclaration);
+                break;
+
+            case TypedefStorageClass:
+            case ExternStorageClass:
+            case StaticStorageClass:
+            case AutoStorageClass:
+            case RegisterStorageClass:
+            case ThreadLocalStorageClass:
+                dispatch(static_cast<const StorageClassSyntax*>(node), &DerivedT::visitStorageClass);
+                break;
+
+            case BuiltinTypeSpecifier:
+                dispatch(static_cast<const BuiltinTypeSpecifierSyntax*>(node), &DerivedT::visitBuiltinTypeSpecifier);
+                break;
+
+            case StructTypeSpecifier:
+            case UnionTypeSpecifier:
+            case EnumTypeSpecifier:
+                dispatch(static_cast<const TagTypeSpecifierSyntax*>(node), &DerivedT::visitTagTypeSpecifier);
+                break;
+
+            case AtomicTypeSpecifier:
+                dispatch(static_cast<const AtomicTypeSpecifierSyntax*>(node), &DerivedT::visitAtomicTypeSpecifier);
+                break;
+
+            case TypeDeclarationAsSpecifier:
+                dispatch(static_cast<const TypeDeclarationAsSpecifierSyntax*>(node), &DerivedT::visitTypeDeclarationAsSpecifier);
+                break;
+
+            case TypedefName:
+                dispatch(static_cast<const TypedefNameSyntax*>(node), &DerivedT::visitTypedefName);
+                break;
+
+            case ConstQualifier:
+            case RestrictQualifier:
+            case VolatileQualifier:
+            case AtomicQualifier:
+                dispatch(static_cast<const TypeQualifierSyntax*>(node), &DerivedT::visitTypeQualifier);
+                break;
+
+            case InlineSpecifier:
+            case NoReturnSpecifier:
+                dispatch(static_cast<const FunctionSpecifierSyntax*>(node), &DerivedT::visitFunctionSpecifier);
+                break;
+
+            case AlignmentSpecifier:
+                dispatch(static_cast<const AlignmentSpecifierSyntax*>(node), &DerivedT::visitAlignmentSpecifier);
+                break;
+
+            case ExtGNU_Typeof:
+                dispatch(static_cast<const ExtGNU_TypeofSyntax*>(node), &DerivedT::visitExtGNU_Typeof);
+                break;
+
+            case ExtGNU_AttributeSpecifier:
+                dispatch(static_cast<const ExtGNU_AttributeSpecifierSyntax*>(node), &DerivedT::visitExtGNU_AttributeSpecifier);
+                break;
+
+            case ExtGNU_Attribute:
+                dispatch(static_cast<const ExtGNU_AttributeSyntax*>(node), &DerivedT::visitExtGNU_Attribute);
+                break;
+
+            case ExtGNU_AsmLabel:
+                dispatch(static_cast<const ExtGNU_AsmLabelSyntax*>(node), &DerivedT::visitExtGNU_AsmLabel);
+                break;
+
+            case ExtPSY_QuantifiedTypeSpecifier:
+                dispatch(static_cast<const ExtPSY_QuantifiedTypeSpecifierSyntax*>(node), &DerivedT::visitExtPSY_QuantifiedTypeSpecifier);
+                break;
+
+            case ArrayDeclarator:
+            case FunctionDeclarator:
+                dispatch(static_cast<const ArrayOrFunctionDeclaratorSyntax*>(node), &DerivedT::visitArrayOrFunctionDeclarator);
+                break;
+
+            case PointerDeclarator:
+                dispatch(static_cast<const PointerDeclaratorSyntax*>(node), &DerivedT::visitPointerDeclarator);
+                break;
+
+            case ParenthesizedDeclarator:
+                dispatch(static_cast<const ParenthesizedDeclaratorSyntax*>(node), &DerivedT::visitParenthesizedDeclarator);
+                break;
+
+            case IdentifierDeclarator:
+                dispatch(static_cast<const IdentifierDeclaratorSyntax*>(node), &DerivedT::visitIdentifierDeclarator);
+                break;
+
+            case AbstractDeclarator:
+                dispatch(static_cast<const AbstractDeclaratorSyntax*>(node), &DerivedT::visitAbstractDeclarator);
+                break;
+
+            case SubscriptSuffix:
+                dispatch(static_cast<const SubscriptSuffixSyntax*>(node), &DerivedT::visitSubscriptSuffix);
+                break;
+
+            case ParameterSuffix:
+                dispatch(static_cast<const ParameterSuffixSyntax*>(node), &DerivedT::visitParameterSuffix);
+                break;
+
+            case BitfieldDeclarator:
+                dispatch(static_cast<const BitfieldDeclaratorSyntax*>(node), &DerivedT::visitBitfieldDeclarator);
+                break;
+
+            case ExpressionInitializer:
+                dispatch(static_cast<const ExpressionInitializerSyntax*>(node), &DerivedT::visitExpressionInitializer);
+                break;
+
+            case BraceEnclosedInitializer:
+                dispatch(static_cast<const BraceEnclosedInitializerSyntax*>(node), &DerivedT::visitBraceEnclosedInitializer);
+                break;
+
+            case DesignatedInitializer:
+                dispatch(static_cast<const DesignatedInitializerSyntax*>(node), &DerivedT::visitDesignatedInitializer);
+                break;
+
+            case FieldDesignator:
+                dispatch(static_cast<const FieldDesignatorSyntax*>(node), &DerivedT::visitFieldDesignator);
+                break;
+
+            case ArrayDesignator:
+                dispatch(static_cast<const ArrayDesignatorSyntax*>(node), &DerivedT::visitArrayDesignator);
+                break;
+
+            case OffsetOfDesignator:
+                dispatch(static_cast<const OffsetOfDesignatorSyntax*>(node), &DerivedT::visitOffsetOfDesignator);
+                break;
+
+            case IdentifierName:
+                dispatch(static_cast<const IdentifierNameSyntax*>(node), &DerivedT::visitIdentifierName);
+                break;
+
+            case PredefinedName:
+                dispatch(static_cast<const PredefinedNameSyntax*>(node), &DerivedT::visitPredefinedName);
+                break;
+
+            case IntegerConstantExpression:
+            case FloatingConstantExpression:
+            case ImaginaryIntegerConstantExpression:
+            case ImaginaryFloatingConstantExpression:
+            case CharacterConstantExpression:
+            case BooleanConstantExpression:
+            case NULL_ConstantExpression:
+                dispatch(static_cast<const ConstantExpressionSyntax*>(node), &DerivedT::visitConstantExpression);
+                break;
+
+            case StringLiteralExpression:
+                dispatch(static_cast<const StringLiteralExpressionSyntax*>(node), &DerivedT::visitStringLiteralExpression);
+                break;
+
+            case ParenthesizedExpression:
+                dispatch(static_cast<const ParenthesizedExpressionSyntax*>(node), &DerivedT::visitParenthesizedExpression);
+                break;
+
+            case GenericSelectionExpression:
+                dispatch(static_cast<const GenericSelectionExpressionSyntax*>(node), &DerivedT::visitGenericSelectionExpression);
+                break;
+
+            case TypedGenericAssociation:
+            case DefaultGenericAssociation:
+                dispatch(static_cast<const GenericAssociationSyntax*>(node), &DerivedT::visitGenericAssociation);
+                break;
+
+            case ExtGNU_EnclosedCompoundStatementExpression:
+                dispatch(static_cast<const ExtGNU_EnclosedCompoundStatementExpressionSyntax*>(node), &DerivedT::visitExtGNU_EnclosedCompoundStatementExpression);
+                break;
+
+            case ExtGNU_ComplexValuedExpression:
+            case ExtGNU_RealExpression:
+            case ExtGNU_ImagExpression:
+                dispatch(static_cast<const ExtGNU_ComplexValuedExpressionSyntax*>(node), &DerivedT::visitExtGNU_ComplexValuedExpression);
+                break;
+
+            case PreIncrementExpression:
+            case PreDecrementExpression:
+            case UnaryPlusExpression:
+            case UnaryMinusExpression:
+            case BitwiseNotExpression:
+            case LogicalNotExpression:
+            case AddressOfExpression:
+            case PointerIndirectionExpression:
+                dispatch(static_cast<const PrefixUnaryExpressionSyntax*>(node), &DerivedT::visitPrefixUnaryExpression);
+                break;
+
+            case PostIncrementExpression:
+            case PostDecrementExpression:
+                dispatch(static_cast<const PostfixUnaryExpressionSyntax*>(node), &DerivedT::visitPostfixUnaryExpression);
+                break;
+
+            case DirectMemberAccessExpression:
+            case IndirectMemberAccessExpression:
+                dispatch(static_cast<const MemberAccessExpressionSyntax*>(node), &DerivedT::visitMemberAccessExpression);
+                break;
+
+            case ElementAccessExpression:
+                dispatch(static_cast<const ArraySubscriptExpressionSyntax*>(node), &DerivedT::visitArraySubscriptExpression);
+                break;
+
+            case SizeofExpression:
+            case AlignofExpression:
+                dispatch(static_cast<const TypeTraitExpressionSyntax*>(node), &DerivedT::visitTypeTraitExpression);
+                break;
+
+            case CastExpression:
+                dispatch(static_cast<const CastExpressionSyntax*>(node), &DerivedT::visitCastExpression);
+                break;
+
+            case CallExpression:
+                dispatch(static_cast<const CallExpressionSyntax*>(node), &DerivedT::visitCallExpression);
+                break;
+
+            case VAArgumentExpression:
+                dispatch(static_cast<const VAArgumentExpressionSyntax*>(node), &DerivedT::visitVAArgumentExpression);
+                break;
+
+            case OffsetOfExpression:
+                dispatch(static_cast<const OffsetOfExpressionSyntax*>(node), &DerivedT::visitOffsetOfExpression);
+                break;
+
+            case CompoundLiteralExpression:
+                dispatch(static_cast<const CompoundLiteralExpressionSyntax*>(node), &DerivedT::visitCompoundLiteralExpression);
+                break;
+
+            case MultiplyExpression:
+            case DivideExpression:
+            case ModuleExpression:
+            case AddExpression:
+            case SubstractExpression:
+            case LeftShiftExpression:
+            case RightShiftExpression:
+            case LessThanExpression:
+            case LessThanOrEqualExpression:
+            case GreaterThanExpression:
+            case GreaterThanOrEqualExpression:
+            case EqualsExpression:
+            case NotEqualsExpression:
+            case BitwiseANDExpression:
+            case BitwiseXORExpression:
+            case BitwiseORExpression:
+            case LogicalANDExpression:
+            case LogicalORExpression:
+                dispatch(static_cast<const BinaryExpressionSyntax*>(node), &DerivedT::visitBinaryExpression);
+                break;
+
+            case ConditionalExpression:
+                dispatch(static_cast<const ConditionalExpressionSyntax*>(node), &DerivedT::visitConditionalExpression);
+                break;
+
+            case BasicAssignmentExpression:
+            case MultiplyAssignmentExpression:
+            case DivideAssignmentExpression:
+            case ModuloAssignmentExpression:
+            case AddAssignmentExpression:
+            case SubtractAssignmentExpression:
+            case LeftShiftAssignmentExpression:
+            case RightShiftAssignmentExpression:
+            case AndAssignmentExpression:
+            case ExclusiveOrAssignmentExpression:
+            case OrAssignmentExpression:
+                dispatch(static_cast<const AssignmentExpressionSyntax*>(node), &DerivedT::visitAssignmentExpression);
+                break;
+
+            case SequencingExpression:
+                dispatch(static_cast<const SequencingExpressionSyntax*>(node), &DerivedT::visitSequencingExpression);
+                break;
+
+            case ExtGNU_ChooseExpression:
+                dispatch(static_cast<const ExtGNU_ChooseExpressionSyntax*>(node), &DerivedT::visitExtGNU_ChooseExpression);
+                break;
+
+            case CompoundStatement:
+                dispatch(static_cast<const CompoundStatementSyntax*>(node), &DerivedT::visitCompoundStatement);
+                break;
+
+            case DeclarationStatement:
+                dispatch(static_cast<const DeclarationStatementSyntax*>(node), &DerivedT::visitDeclarationStatement);
+                break;
+
+            case ExpressionStatement:
+                dispatch(static_cast<const ExpressionStatementSyntax*>(node), &DerivedT::visitExpressionStatement);
+                break;
+
+            case IdentifierLabelStatement:
+            case DefaultLabelStatement:
+            case CaseLabelStatement:
+                dispatch(static_cast<const LabeledStatementSyntax*>(node), &DerivedT::visitLabeledStatement);
+                break;
+
+            case IfStatement:
+                dispatch(static_cast<const IfStatementSyntax*>(node), &DerivedT::visitIfStatement);
+                break;
+
+            case SwitchStatement:
+                dispatch(static_cast<const SwitchStatementSyntax*>(node), &DerivedT::visitSwitchStatement);
+                break;
+
+            case WhileStatement:
+                dispatch(static_cast<const WhileStatementSyntax*>(node), &DerivedT::visitWhileStatement);
+                break;
+
+            case DoStatement:
+                dispatch(static_cast<const DoStatementSyntax*>(node), &DerivedT::visitDoStatement);
+                break;
+
+            case ForStatement:
+                dispatch(static_cast<const ForStatementSyntax*>(node), &DerivedT::visitForStatement);
+                break;
+
+            case GotoStatement:
+                dispatch(static_cast<const GotoStatementSyntax*>(node), &DerivedT::visitGotoStatement);
+                break;
+
+            case ContinueStatement:
+                dispatch(static_cast<const ContinueStatementSyntax*>(node), &DerivedT::visitContinueStatement);
+                break;
+
+            case BreakStatement:
+                dispatch(static_cast<const BreakStatementSyntax*>(node), &DerivedT::visitBreakStatement);
+                break;
+
+            case ReturnStatement:
+                dispatch(static_cast<const ReturnStatementSyntax*>(node), &DerivedT::visitReturnStatement);
+                break;
+
+            case ExtGNU_AsmStatement:
+                dispatch(static_cast<const ExtGNU_AsmStatementSyntax*>(node), &DerivedT::visitExtGNU_AsmStatement);
+                break;
+
+            case ExtGNU_AsmVolatileQualifier:
+            case ExtGNU_AsmInlineQualifier:
+            case ExtGNU_AsmGotoQualifier:
+                dispatch(static_cast<const ExtGNU_AsmQualifierSyntax*>(node), &DerivedT::visitExtGNU_AsmQualifier);
+                break;
+
+            case ExtGNU_AsmInputOperand:
+            case ExtGNU_AsmOutputOperand:
+                dispatch(static_cast<const ExtGNU_AsmOperandSyntax*>(node), &DerivedT::visitExtGNU_AsmOperand);
+                break;
+
+            case TypeName:
+                dispatch(static_cast<const TypeNameSyntax*>(node), &DerivedT::visitTypeName);
+                break;
+
+            case ExpressionAsTypeReference:
+                dispatch(static_cast<const ExpressionAsTypeReferenceSyntax*>(node), &DerivedT::visitExpressionAsTypeReference);
+                break;
+
+            case TypeNameAsTypeReference:
+                dispatch(static_cast<const TypeNameAsTypeReferenceSyntax*>(node), &DerivedT::visitTypeNameAsTypeReference);
+                break;
+
+            case AmbiguousTypeNameOrExpressionAsTypeReference:
+                dispatch(static_cast<const AmbiguousTypeNameOrExpressionAsTypeReferenceSyntax*>(node), &DerivedT::visitAmbiguousTypeNameOrExpressionAsTypeReference);
+                break;
+
+            case AmbiguousCastOrBinaryExpression:
+                dispatch(static_cast<const AmbiguousCastOrBinaryExpressionSyntax*>(node), &DerivedT::visitAmbiguousCastOrBinaryExpression);
+                break;
+
+            case AmbiguousCallOrVariableDeclaration:
+            case AmbiguousMultiplicationOrPointerDeclaration:
+                dispatch(static_cast<const AmbiguousExpressionOrDeclarationStatementSyntax*>(node), &DerivedT::visitAmbiguousExpressionOrDeclarationStatement);
+                break;
+
+            default:
+                PSY_ESCAPE_VIA_BREAK;
+        }
+    }
+};
+
+} // C
+} // psy
+
+#endif
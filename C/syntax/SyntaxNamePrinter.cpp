@@ -22,37 +22,35 @@
 
 #include "SyntaxNode.h"
 
-#include <algorithm>
 #include <iostream>
-#include <unordered_map>
 
 using namespace psy;
 using namespace C;
 
 namespace {
 
-int CUR_LEVEL;
-
-std::string formatSnippet(std::string& snippet)
+/*
+ * Append the text of the snippet, with newlines and tabs as spaces and
+ * without consecutive spaces, up to a maximum length.
+ */
+void appendSnippet(std::string& buf, const char* begin, const char* end)
 {
-    std::replace_if(snippet.begin(), snippet.end(),
-                 [] (char c) { return c == '\n' || c == '\t'; },
-                 ' ');
-
-    while (true) {
-        auto pos = snippet.find("  ");
-        if (pos == std::string::npos)
-            break;
-        snippet = snippet.replace(pos, 2, " ");
-    }
+    static const std::size_t MAX_LEN = 30;
 
-    static const auto MAX_LEN = 30;
-    if (snippet.length() > MAX_LEN) {
-        snippet = snippet.substr(0, MAX_LEN);
-        snippet += "...";
+    std::size_t len = 0;
+    char prev = '\0';
+    for (auto it = begin; it != end; ++it) {
+        auto c = (*it == '\n' || *it == '\t') ? ' ' : *it;
+        if (c == ' ' && prev == ' ')
+            continue;
+        if (len == MAX_LEN) {
+            buf += "...";
+            return;
+        }
+        buf.push_back(c);
+        prev = c;
+        ++len;
     }
-
-    return snippet;
 }
 
 } // anonymous
@@ -62,73 +60,122 @@ void SyntaxNamePrinter::print(const SyntaxNode* node, Style style)
     print(node, style, std::cout);
 }
 
+/**
+ * The nodes are collected (in a single traversal) and then written, each in
+ * a line, into a buffer that is flushed into \p os at once. Whether a node
+ * has a later sibling, which is needed for the decoration of the lines of
+ * its descendants, is computed in a backward pass over the collected nodes.
+ */
 void SyntaxNamePrinter::print(const SyntaxNode* node, Style style, std::ostream& os)
 {
-    CUR_LEVEL = 0;
+    dump_.clear();
+    openEntries_.clear();
+    openEntriesWithTokens_ = 0;
+    lastTk_ = SyntaxToken::invalid();
 
     nonterminal(node);
 
-    auto source = node->syntaxTree()->text().rawText();
-
-    os << std::endl;
-    for (auto i = 0U; i < dump_.size(); ++i) {
-        auto node = std::get<0>(dump_[i]);
-        auto nodeLevel = std::get<1>(dump_[i]);
+    buf_.clear();
+    buf_.reserve(dump_.size() * 64);
+    buf_.push_back('\n');
 
-        if (style == Style::Plain) {
-            os << std::string(nodeLevel * 4, ' ');
-            os << to_string(node->kind()) << std::endl;
-            continue;
+    if (style == Style::Plain) {
+        for (const auto& entry : dump_) {
+            buf_.append(entry.level_ * 4, ' ');
+            buf_ += to_string(entry.node_->kind());
+            buf_.push_back('\n');
         }
+    }
+    else if (!dump_.empty()) {
+        writeDecorations(node->syntaxTree()->text().rawText());
+    }
+
+    os.write(buf_.data(), buf_.size());
+    os.flush();
+}
+
+void SyntaxNamePrinter::writeDecorations(const std::string& source)
+{
+    /*
+     * Going backwards, siblingAtLevel[L] tells whether the next node, among
+     * those at level L or above, is at level L.
+     */
+    std::vector<bool> siblingAtLevel;
+    for (auto i = dump_.size(); i > 0; --i) {
+        auto& entry = dump_[i - 1];
+        entry.hasLaterSibling_ = entry.level_ < siblingAtLevel.size()
+                && siblingAtLevel[entry.level_];
+        siblingAtLevel.resize(entry.level_ + 1);
+        siblingAtLevel[entry.level_] = true;
+    }
 
-        auto levelCnt = 0;
-        while (nodeLevel > levelCnt) {
-            if (nodeLevel == levelCnt + 1) {
-                os << '|';
-                os << std::string(2, '-');
-            }
-            else {
-                int nextLevelBelow;
-                for (auto j = i + 1; j < dump_.size(); ++j) {
-                    nextLevelBelow = std::get<1>(dump_[j]);
-                    if (nextLevelBelow <= levelCnt + 1)
-                        break;
-                }
-                if (nextLevelBelow == levelCnt + 1)
-                    os << '|';
-                else
-                    os << ' ';
-                os << std::string(2, ' ');
-            }
-            ++levelCnt;
+    std::vector<bool> ancestorHasLaterSibling;
+    for (const auto& entry : dump_) {
+        ancestorHasLaterSibling.resize(entry.level_ + 1);
+        ancestorHasLaterSibling[entry.level_] = entry.hasLaterSibling_;
+
+        for (auto level = 1U; level < entry.level_; ++level) {
+            buf_.push_back(ancestorHasLaterSibling[level] ? '|' : ' ');
+            buf_.append(2, ' ');
         }
+        if (entry.level_)
+            buf_ += "|--";
 
-        os << to_string(node->kind()) << " ";
+        buf_ += to_string(entry.node_->kind());
+        buf_.push_back(' ');
 
-        if (node->kind() == TranslationUnit) {
-            os << std::endl;
+        if (entry.node_->kind() == TranslationUnit) {
+            buf_.push_back('\n');
             continue;
         }
 
-        os << " <";
-        auto firstTk = node->firstToken();
-        auto lastTk = node->lastToken();
-        if (firstTk.isValid())
-            os << firstTk.location().lineSpan().span().start();
-        os << "..";
-        if (lastTk.isValid())
-            os << lastTk.location().lineSpan().span().end();
-        os << "> ";
-
-        if (firstTk.isValid() && lastTk.isValid()) {
-            auto firstTkStart = source.c_str() + firstTk.span().start();
-            auto lastTkEnd = source.c_str() + lastTk.span().end();
-            std::string snippet(firstTkStart, lastTkEnd - firstTkStart);
-            os << " `" << formatSnippet(snippet) << "`";
+        buf_ += " <";
+        if (entry.hasTokens_) {
+            buf_ += std::to_string(entry.firstLineno_);
+            buf_.push_back(':');
+            buf_ += std::to_string(entry.firstColumn_);
+        }
+        buf_ += "..";
+        if (entry.hasTokens_) {
+            buf_ += std::to_string(entry.lastLineno_);
+            buf_.push_back(':');
+            buf_ += std::to_string(entry.lastColumn_);
         }
+        buf_ += "> ";
+
+        if (entry.hasTokens_
+                && entry.firstCharStart_ <= entry.lastCharEnd_
+                && entry.lastCharEnd_ <= source.size()) {
+            buf_ += " `";
+            appendSnippet(buf_,
+                          source.c_str() + entry.firstCharStart_,
+                          source.c_str() + entry.lastCharEnd_);
+            buf_.push_back('`');
+        }
+
+        buf_.push_back('\n');
+    }
+}
+
+void SyntaxNamePrinter::terminal(const SyntaxToken& tk, const SyntaxNode*)
+{
+    if (!tk.isValid())
+        return;
 
-        os << std::endl;
+    /*
+     * The open entries without tokens are the innermost ones: this is the
+     * first token of each of them.
+     */
+    for (auto i = openEntriesWithTokens_; i < openEntries_.size(); ++i) {
+        auto& entry = dump_[openEntries_[i]];
+        entry.hasTokens_ = true;
+        entry.firstLineno_ = tk.lineno_;
+        entry.firstColumn_ = tk.column_;
+        entry.firstCharStart_ = tk.charStart();
     }
+    openEntriesWithTokens_ = openEntries_.size();
+
+    lastTk_ = tk;
 }
 
 void SyntaxNamePrinter::nonterminal(const SyntaxNode* node)
@@ -136,10 +183,23 @@ void SyntaxNamePrinter::nonterminal(const SyntaxNode* node)
     if (!node)
         return;
 
-    dump_.push_back(std::make_tuple(node, CUR_LEVEL));
+    auto idx = dump_.size();
+    Entry entry {};
+    entry.node_ = node;
+    entry.level_ = static_cast<unsigned int>(openEntries_.size());
+    dump_.push_back(entry);
 
-    ++CUR_LEVEL;
+    openEntries_.push_back(idx);
     visit(node);
-    --CUR_LEVEL;
-}
+    openEntries_.pop_back();
 
+    if (openEntriesWithTokens_ > openEntries_.size())
+        openEntriesWithTokens_ = openEntries_.size();
+
+    auto& visited = dump_[idx];
+    if (visited.hasTokens_) {
+        visited.lastLineno_ = lastTk_.lineno_;
+        visited.lastColumn_ = lastTk_.column_ + lastTk_.byteSize_ - 1;
+        visited.lastCharEnd_ = lastTk_.charEnd();
+    }
+}
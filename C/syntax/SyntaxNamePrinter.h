@@ -26,7 +26,7 @@
 #include "SyntaxDumper.h"
 
 #include <ostream>
-#include <tuple>
+#include <string>
 #include <vector>
 
 namespace psy {
@@ -47,9 +47,34 @@ public:
     void print(const SyntaxNode* node, Style style, std::ostream& os);
 
 private:
+    virtual void terminal(const SyntaxToken& tk, const SyntaxNode*) override;
     virtual void nonterminal(const SyntaxNode* node) override;
 
-    std::vector<std::tuple<const SyntaxNode*, int>> dump_;
+    void writeDecorations(const std::string& source);
+
+    /*
+     * A node is dumped along with the range of its (valid) tokens, which is
+     * recorded while the node is visited.
+     */
+    struct Entry
+    {
+        const SyntaxNode* node_;
+        unsigned int level_;
+        bool hasLaterSibling_;
+        bool hasTokens_;
+        unsigned int firstLineno_;
+        unsigned int firstColumn_;
+        unsigned int firstCharStart_;
+        unsigned int lastLineno_;
+        unsigned int lastColumn_;
+        unsigned int lastCharEnd_;
+    };
+
+    std::vector<Entry> dump_;
+    std::vector<std::size_t> openEntries_;
+    std::size_t openEntriesWithTokens_;
+    SyntaxToken lastTk_ = SyntaxToken::invalid();
+    std::string buf_;
 };
 
 } // C
@@ -32,6 +32,7 @@ using namespace C;
 SyntaxNode::SyntaxNode(SyntaxTree* tree, SyntaxKind kind)
     : tree_(tree)
     , kind_(kind)
+    , ordinal_(tree ? tree->freshNodeOrdinal() : 0)
 {}
 
 SyntaxNode::~SyntaxNode()
@@ -34,6 +34,8 @@
 #include "infra/Managed.h"
 #include "parser/LexedTokens.h"
 
+#include "../common/infra/InternalAccess.h"
+
 #include <iostream>
 #include <memory>
 #include <variant>
@@ -54,7 +56,7 @@ namespace C {
 class PSY_C_API SyntaxNode : public Managed
 {
 public:
-    virtual ~SyntaxNode();
+    ~SyntaxNode();
 
     /**
      * The SyntaxTree to which \c this SyntaxNode belongs to.
@@ -110,241 +112,253 @@ public:
     //--------------//
     // Declarations //
     //--------------//
-    virtual TranslationUnitSyntax* asTranslationUnit() { return nullptr; }
-    virtual const TranslationUnitSyntax* asTranslationUnit() const { return nullptr; }
-    virtual DeclarationSyntax* asDeclaration() { return nullptr; }
-    virtual const DeclarationSyntax* asDeclaration() const { return nullptr; }
-    virtual IncompleteDeclarationSyntax* asIncompleteDeclaration() { return nullptr; }
-    virtual const IncompleteDeclarationSyntax* asIncompleteDeclaration() const { return nullptr; }
-    virtual NamedDeclarationSyntax* asNamedDeclaration() { return nullptr; }
-    virtual const NamedDeclarationSyntax* asNamedDeclaration() const { return nullptr; }
-    virtual TypeDeclarationSyntax* asTypeDeclaration() { return nullptr; }
-    virtual const TypeDeclarationSyntax* asTypeDeclaration() const { return nullptr; }
-    virtual TagDeclarationSyntax* asTagDeclaration() { return nullptr; }
-    virtual const TagDeclarationSyntax* asTagDeclaration() const { return nullptr; }
-    virtual StructOrUnionDeclarationSyntax* asStructOrUnionDeclaration() { return nullptr; }
-    virtual const StructOrUnionDeclarationSyntax* asStructOrUnionDeclaration() const { return nullptr; }
-    virtual EnumDeclarationSyntax* asEnumDeclaration() { return nullptr; }
-    virtual const EnumDeclarationSyntax* asEnumDeclaration() const { return nullptr; }
-    virtual EnumeratorDeclarationSyntax* asEnumeratorDeclaration() { return nullptr; }
-    virtual const EnumeratorDeclarationSyntax* asEnumeratorDeclaration() const { return nullptr; }
-    virtual ValueDeclarationSyntax* asValueDeclaration() { return nullptr; }
-    virtual const ValueDeclarationSyntax* asValueDeclaration() const { return nullptr; }
-    virtual DeclaratorDeclarationSyntax* asDeclaratorDeclaration() { return nullptr; }
-    virtual const DeclaratorDeclarationSyntax* asDeclaratorDeclaration() const { return nullptr; }
-    virtual VariableAndOrFunctionDeclarationSyntax* asVariableAndOrFunctionDeclaration() { return nullptr; }
-    virtual const VariableAndOrFunctionDeclarationSyntax* asVariableAndOrFunctionDeclaration() const { return nullptr; }
-    virtual ParameterDeclarationSyntax* asParameterDeclaration() { return nullptr; }
-    virtual const ParameterDeclarationSyntax* asParameterDeclaration() const { return nullptr; }
-    virtual FieldDeclarationSyntax* asFieldDeclaration() { return nullptr; }
-    virtual const FieldDeclarationSyntax* asFieldDeclaration() const { return nullptr; }
-    virtual StaticAssertDeclarationSyntax* asStaticAssertDeclaration() { return nullptr; }
-    virtual const StaticAssertDeclarationSyntax* asStaticAssertDeclaration() const { return nullptr; }
-    virtual FunctionDefinitionSyntax* asFunctionDefinition() { return nullptr; }
-    virtual const FunctionDefinitionSyntax* asFunctionDefinition() const { return nullptr; }
-    virtual ExtPSY_TemplateDeclarationSyntax* asExtPSY_TemplateDeclaration() { return nullptr; }
-    virtual const ExtPSY_TemplateDeclarationSyntax* asExtPSY_TemplateDeclaration() const { return nullptr; }
-    virtual ExtGNU_AsmStatementDeclarationSyntax* asExtGNU_AsmStatementDeclaration() { return nullptr; }
-    virtual const ExtGNU_AsmStatementDeclarationSyntax* asExtGNU_AsmStatementDeclaration() const { return nullptr; }
-    virtual ExtKR_ParameterDeclarationSyntax* asExtKR_ParameterDeclaration() { return nullptr; }
-    virtual const ExtKR_ParameterDeclarationSyntax* asExtKR_ParameterDeclaration() const { return nullptr; }
+    TranslationUnitSyntax* asTranslationUnit();
+    const TranslationUnitSyntax* asTranslationUnit() const;
+    DeclarationSyntax* asDeclaration();
+    const DeclarationSyntax* asDeclaration() const;
+    IncompleteDeclarationSyntax* asIncompleteDeclaration();
+    const IncompleteDeclarationSyntax* asIncompleteDeclaration() const;
+    NamedDeclarationSyntax* asNamedDeclaration();
+    const NamedDeclarationSyntax* asNamedDeclaration() const;
+    TypeDeclarationSyntax* asTypeDeclaration();
+    const TypeDeclarationSyntax* asTypeDeclaration() const;
+    TagDeclarationSyntax* asTagDeclaration();
+    const TagDeclarationSyntax* asTagDeclaration() const;
+    StructOrUnionDeclarationSyntax* asStructOrUnionDeclaration();
+    const StructOrUnionDeclarationSyntax* asStructOrUnionDeclaration() const;
+    EnumDeclarationSyntax* asEnumDeclaration();
+    const EnumDeclarationSyntax* asEnumDeclaration() const;
+    EnumeratorDeclarationSyntax* asEnumeratorDeclaration();
+    const EnumeratorDeclarationSyntax* asEnumeratorDeclaration() const;
+    ValueDeclarationSyntax* asValueDeclaration();
+    const ValueDeclarationSyntax* asValueDeclaration() const;
+    DeclaratorDeclarationSyntax* asDeclaratorDeclaration();
+    const DeclaratorDeclarationSyntax* asDeclaratorDeclaration() const;
+    VariableAndOrFunctionDeclarationSyntax* asVariableAndOrFunctionDeclaration();
+    const VariableAndOrFunctionDeclarationSyntax* asVariableAndOrFunctionDeclaration() const;
+    ParameterDeclarationSyntax* asParameterDeclaration();
+    const ParameterDeclarationSyntax* asParameterDeclaration() const;
+    FieldDeclarationSyntax* asFieldDeclaration();
+    const FieldDeclarationSyntax* asFieldDeclaration() const;
+    StaticAssertDeclarationSyntax* asStaticAssertDeclaration();
+    const StaticAssertDeclarationSyntax* asStaticAssertDeclaration() const;
+    FunctionDefinitionSyntax* asFunctionDefinition();
+    const FunctionDefinitionSyntax* asFunctionDefinition() const;
+    ExtPSY_TemplateDeclarationSyntax* asExtPSY_TemplateDeclaration();
+    const ExtPSY_TemplateDeclarationSyntax* asExtPSY_TemplateDeclaration() const;
+    ExtGNU_AsmStatementDeclarationSyntax* asExtGNU_AsmStatementDeclaration();
+    const ExtGNU_AsmStatementDeclarationSyntax* asExtGNU_AsmStatementDeclaration() const;
+    ExtKR_ParameterDeclarationSyntax* asExtKR_ParameterDeclaration();
+    const ExtKR_ParameterDeclarationSyntax* asExtKR_ParameterDeclaration() const;
 
     /* Specifiers */
-    virtual SpecifierSyntax* asSpecifier() { return nullptr; }
-    virtual const SpecifierSyntax* asSpecifier() const { return nullptr; }
-    virtual TrivialSpecifierSyntax* asTrivialSpecifier() { return nullptr; }
-    virtual const TrivialSpecifierSyntax* asTrivialSpecifier() const { return nullptr; }
-    virtual StorageClassSyntax* asStorageClass() { return nullptr; }
-    virtual const StorageClassSyntax* asStorageClass() const { return nullptr; }
-    virtual BuiltinTypeSpecifierSyntax* asBuiltinTypeSpecifier() { return nullptr; }
-    virtual const BuiltinTypeSpecifierSyntax* asBuiltinTypeSpecifier() const { return nullptr; }
-    virtual TagTypeSpecifierSyntax* asTagTypeSpecifier() { return nullptr; }
-    virtual const TagTypeSpecifierSyntax* asTagTypeSpecifier() const { return nullptr; }
-    virtual TypeDeclarationAsSpecifierSyntax* asTypeDeclarationAsSpecifier() { return nullptr; }
-    virtual AtomicTypeSpecifierSyntax* asAtomicTypeSpecifier() { return nullptr; }
-    virtual const AtomicTypeSpecifierSyntax* asAtomicTypeSpecifier() const { return nullptr; }
-    virtual const TypeDeclarationAsSpecifierSyntax* asTypeDeclarationAsSpecifier() const { return nullptr; }
-    virtual TypeQualifierSyntax* asTypeQualifier() { return nullptr; }
-    virtual const TypeQualifierSyntax* asTypeQualifier() const { return nullptr; }
-    virtual FunctionSpecifierSyntax* asFunctionSpecifier() { return nullptr; }
-    virtual const FunctionSpecifierSyntax* asFunctionSpecifier() const { return nullptr; }
-    virtual AlignmentSpecifierSyntax* asAlignmentSpecifier() { return nullptr; }
-    virtual const AlignmentSpecifierSyntax* asAlignmentSpecifier() const { return nullptr; }
-    virtual TypedefNameSyntax* asTypedefName() { return nullptr; }
-    virtual const TypedefNameSyntax* asTypedefName() const { return nullptr; }
-    virtual ExtGNU_AttributeSpecifierSyntax* asExtGNU_AttributeSpecifier() { return nullptr; }
-    virtual const ExtGNU_AttributeSpecifierSyntax* asExtGNU_AttributeSpecifier() const { return nullptr; }
-    virtual ExtGNU_AttributeSyntax* asExtGNU_Attribute() { return nullptr; }
-    virtual const ExtGNU_AttributeSyntax* asExtGNU_Attribute() const { return nullptr; }
-    virtual ExtGNU_AsmLabelSyntax* asExtGNU_AsmLabel() { return nullptr; }
-    virtual const ExtGNU_AsmLabelSyntax* asExtGNU_AsmLabel() const { return nullptr; }
-    virtual ExtGNU_TypeofSyntax* asExtGNU_Typeof() { return nullptr; }
-    virtual const ExtGNU_TypeofSyntax* asExtGNU_Typeof() const { return nullptr; }
-    virtual ExtPSY_QuantifiedTypeSpecifierSyntax* asExtPSY_QuantifiedTypeSpecifier() { return nullptr; }
-    virtual const ExtPSY_QuantifiedTypeSpecifierSyntax* asExtPSY_QuantifiedTypeSpecifier() const { return nullptr; }
+    SpecifierSyntax* asSpecifier();
+    const SpecifierSyntax* asSpecifier() const;
+    TrivialSpecifierSyntax* asTrivialSpecifier();
+    const TrivialSpecifierSyntax* asTrivialSpecifier() const;
+    StorageClassSyntax* asStorageClass();
+    const StorageClassSyntax* asStorageClass() const;
+    BuiltinTypeSpecifierSyntax* asBuiltinTypeSpecifier();
+    const BuiltinTypeSpecifierSyntax* asBuiltinTypeSpecifier() const;
+    TagTypeSpecifierSyntax* asTagTypeSpecifier();
+    const TagTypeSpecifierSyntax* asTagTypeSpecifier() const;
+    TypeDeclarationAsSpecifierSyntax* asTypeDeclarationAsSpecifier();
+    AtomicTypeSpecifierSyntax* asAtomicTypeSpecifier();
+    const AtomicTypeSpecifierSyntax* asAtomicTypeSpecifier() const;
+    const TypeDeclarationAsSpecifierSyntax* asTypeDeclarationAsSpecifier() const;
+    TypeQualifierSyntax* asTypeQualifier();
+    const TypeQualifierSyntax* asTypeQualifier() const;
+    FunctionSpecifierSyntax* asFunctionSpecifier();
+    const FunctionSpecifierSyntax* asFunctionSpecifier() const;
+    AlignmentSpecifierSyntax* asAlignmentSpecifier();
+    const AlignmentSpecifierSyntax* asAlignmentSpecifier() const;
+    TypedefNameSyntax* asTypedefName();
+    const TypedefNameSyntax* asTypedefName() const;
+    ExtGNU_AttributeSpecifierSyntax* asExtGNU_AttributeSpecifier();
+    const ExtGNU_AttributeSpecifierSyntax* asExtGNU_AttributeSpecifier() const;
+    ExtGNU_AttributeSyntax* asExtGNU_Attribute();
+    const ExtGNU_AttributeSyntax* asExtGNU_Attribute() const;
+    ExtGNU_AsmLabelSyntax* asExtGNU_AsmLabel();
+    const ExtGNU_AsmLabelSyntax* asExtGNU_AsmLabel() const;
+    ExtGNU_TypeofSyntax* asExtGNU_Typeof();
+    const ExtGNU_TypeofSyntax* asExtGNU_Typeof() const;
+    ExtPSY_QuantifiedTypeSpecifierSyntax* asExtPSY_QuantifiedTypeSpecifier();
+    const ExtPSY_QuantifiedTypeSpecifierSyntax* asExtPSY_QuantifiedTypeSpecifier() const;
 
     /* Declarators */
-    virtual DeclaratorSyntax* asDeclarator() { return nullptr; }
-    virtual const DeclaratorSyntax* asDeclarator() const { return nullptr; }
-    virtual PointerDeclaratorSyntax* asPointerDeclarator() { return nullptr; }
-    virtual const PointerDeclaratorSyntax* asPointerDeclarator() const { return nullptr; }
-    virtual IdentifierDeclaratorSyntax* asIdentifierDeclarator() { return nullptr; }
-    virtual const IdentifierDeclaratorSyntax* asIdentifierDeclarator() const { return nullptr; }
-    virtual AbstractDeclaratorSyntax* asAbstractDeclarator() { return nullptr; }
-    virtual const AbstractDeclaratorSyntax* asAbstractDeclarator() const { return nullptr; }
-    virtual ParenthesizedDeclaratorSyntax* asParenthesizedDeclarator() { return nullptr; }
-    virtual const ParenthesizedDeclaratorSyntax* asParenthesizedDeclarator() const { return nullptr; }
-    virtual ArrayOrFunctionDeclaratorSyntax* asArrayOrFunctionDeclarator() { return nullptr; }
-    virtual const ArrayOrFunctionDeclaratorSyntax* asArrayOrFunctionDeclarator() const { return nullptr; }
-    virtual DeclaratorSuffixSyntax* asDeclaratorSuffix() { return nullptr; }
-    virtual const DeclaratorSuffixSyntax* asDeclaratorSuffix() const { return nullptr; }
-    virtual SubscriptSuffixSyntax* asSubscriptSuffix() { return nullptr; }
-    virtual const SubscriptSuffixSyntax* asSubscriptSuffix() const { return nullptr; }
-    virtual ParameterSuffixSyntax* asParameterSuffix() { return nullptr; }
-    virtual const ParameterSuffixSyntax* asParameterSuffix() const { return nullptr; }
-    virtual BitfieldDeclaratorSyntax* asBitfieldDeclarator() { return  nullptr; }
-    virtual const BitfieldDeclaratorSyntax* asBitfieldDeclarator() const { return  nullptr; }
+    DeclaratorSyntax* asDeclarator();
+    const DeclaratorSyntax* asDeclarator() const;
+    PointerDeclaratorSyntax* asPointerDeclarator();
+    const PointerDeclaratorSyntax* asPointerDeclarator() const;
+    IdentifierDeclaratorSyntax* asIdentifierDeclarator();
+    const IdentifierDeclaratorSyntax* asIdentifierDeclarator() const;
+    AbstractDeclaratorSyntax* asAbstractDeclarator();
+    const AbstractDeclaratorSyntax* asAbstractDeclarator() const;
+    ParenthesizedDeclaratorSyntax* asParenthesizedDeclarator();
+    const ParenthesizedDeclaratorSyntax* asParenthesizedDeclarator() const;
+    ArrayOrFunctionDeclaratorSyntax* asArrayOrFunctionDeclarator();
+    const ArrayOrFunctionDeclaratorSyntax* asArrayOrFunctionDeclarator() const;
+    DeclaratorSuffixSyntax* asDeclaratorSuffix();
+    const DeclaratorSuffixSyntax* asDeclaratorSuffix() const;
+    SubscriptSuffixSyntax* asSubscriptSuffix();
+    const SubscriptSuffixSyntax* asSubscriptSuffix() const;
+    ParameterSuffixSyntax* asParameterSuffix();
+    const ParameterSuffixSyntax* asParameterSuffix() const;
+    BitfieldDeclaratorSyntax* asBitfieldDeclarator();
+    const BitfieldDeclaratorSyntax* asBitfieldDeclarator() const;
 
     /* Initializers */
-    virtual InitializerSyntax* asInitializer() { return nullptr; }
-    virtual const InitializerSyntax* asInitializer() const { return nullptr; }
-    virtual ExpressionInitializerSyntax* asExpressionInitializer() { return nullptr; }
-    virtual const ExpressionInitializerSyntax* asExpressionInitializer() const { return nullptr; }
-    virtual BraceEnclosedInitializerSyntax* asBraceEnclosedInitializer() { return nullptr; }
-    virtual const BraceEnclosedInitializerSyntax* asBraceEnclosedInitializer() const { return nullptr; }
-    virtual DesignatedInitializerSyntax* asDesignatedInitializer() { return nullptr; }
-    virtual const DesignatedInitializerSyntax* asDesignatedInitializer() const { return nullptr; }
-    virtual DesignatorSyntax* asDesignator() { return nullptr; }
-    virtual const DesignatorSyntax* asDesignator() const { return nullptr; }
-    virtual ArrayDesignatorSyntax* asArrayDesignator() { return nullptr; }
-    virtual const ArrayDesignatorSyntax* asArrayDesignator() const { return nullptr; }
-    virtual FieldDesignatorSyntax* asFieldDesignator() { return nullptr; }
-    virtual const FieldDesignatorSyntax* asFieldDesignator() const { return nullptr; }
-
-    virtual OffsetOfDesignatorSyntax* asOffsetOfDesignator() { return nullptr; }
-    virtual const OffsetOfDesignatorSyntax* asOffsetOfDesignator() const { return nullptr; }
+    InitializerSyntax* asInitializer();
+    const InitializerSyntax* asInitializer() const;
+    ExpressionInitializerSyntax* asExpressionInitializer();
+    const ExpressionInitializerSyntax* asExpressionInitializer() const;
+    BraceEnclosedInitializerSyntax* asBraceEnclosedInitializer();
+    const BraceEnclosedInitializerSyntax* asBraceEnclosedInitializer() const;
+    DesignatedInitializerSyntax* asDesignatedInitializer();
+    const DesignatedInitializerSyntax* asDesignatedInitializer() const;
+    DesignatorSyntax* asDesignator();
+    const DesignatorSyntax* asDesignator() const;
+    ArrayDesignatorSyntax* asArrayDesignator();
+    const ArrayDesignatorSyntax* asArrayDesignator() const;
+    FieldDesignatorSyntax* asFieldDesignator();
+    const FieldDesignatorSyntax* asFieldDesignator() const;
+
+    OffsetOfDesignatorSyntax* asOffsetOfDesignator();
+    const OffsetOfDesignatorSyntax* asOffsetOfDesignator() const;
 
     //-------------//
     // Expressions //
     //-------------//
-    virtual ExpressionSyntax* asExpression() { return nullptr; }
-    virtual const ExpressionSyntax* asExpression() const { return nullptr; }
-    virtual ConstantExpressionSyntax* asConstantExpression() { return nullptr; }
-    virtual const ConstantExpressionSyntax* asConstantExpression() const { return nullptr; }
-    virtual StringLiteralExpressionSyntax* asStringLiteralExpression() { return nullptr; }
-    virtual const StringLiteralExpressionSyntax* asStringLiteralExpression() const { return nullptr; }
-    virtual ParenthesizedExpressionSyntax* asParenthesizedExpression() { return nullptr; }
-    virtual const ParenthesizedExpressionSyntax* asParenthesizedExpression() const { return nullptr; }
-    virtual GenericSelectionExpressionSyntax* asGenericSelectionExpression() { return nullptr; }
-    virtual const GenericSelectionExpressionSyntax* asGenericSelectionExpression() const { return nullptr; }
-    virtual GenericAssociationSyntax* asGenericAssociation() { return nullptr; }
-    virtual const GenericAssociationSyntax* asGenericAssociation() const { return nullptr; }
-    virtual ExtGNU_EnclosedCompoundStatementExpressionSyntax* asExtGNU_EnclosedCompoundStatementExpression() { return nullptr; }
-    virtual const ExtGNU_EnclosedCompoundStatementExpressionSyntax* asExtGNU_EnclosedCompoundStatementExpression() const { return nullptr; }
-    virtual ExtGNU_ComplexValuedExpressionSyntax* asExtGNU_ComplexValuedExpression() { return nullptr; }
-    virtual const ExtGNU_ComplexValuedExpressionSyntax* asExtGNU_ComplexValuedExpression() const { return nullptr; }
+    ExpressionSyntax* asExpression();
+    const ExpressionSyntax* asExpression() const;
+    ConstantExpressionSyntax* asConstantExpression();
+    const ConstantExpressionSyntax* asConstantExpression() const;
+    StringLiteralExpressionSyntax* asStringLiteralExpression();
+    const StringLiteralExpressionSyntax* asStringLiteralExpression() const;
+    ParenthesizedExpressionSyntax* asParenthesizedExpression();
+    const ParenthesizedExpressionSyntax* asParenthesizedExpression() const;
+    GenericSelectionExpressionSyntax* asGenericSelectionExpression();
+    const GenericSelectionExpressionSyntax* asGenericSelectionExpression() const;
+    GenericAssociationSyntax* asGenericAssociation();
+    const GenericAssociationSyntax* asGenericAssociation() const;
+    ExtGNU_EnclosedCompoundStatementExpressionSyntax* asExtGNU_EnclosedCompoundStatementExpression();
+    const ExtGNU_EnclosedCompoundStatementExpressionSyntax* asExtGNU_EnclosedCompoundStatementExpression() const;
+    ExtGNU_ComplexValuedExpressionSyntax* asExtGNU_ComplexValuedExpression();
+    const ExtGNU_ComplexValuedExpressionSyntax* asExtGNU_ComplexValuedExpression() const;
 
     /* Names */
-    virtual NameSyntax* asName() { return nullptr; }
-    virtual const NameSyntax* asName() const { return nullptr; }
-    virtual IdentifierNameSyntax* asIdentifierName() { return nullptr; }
-    virtual const IdentifierNameSyntax* asIdentifierName() const { return nullptr; }
-    virtual PredefinedNameSyntax* asPredefinedName() { return nullptr; }
-    virtual const PredefinedNameSyntax* asPredefinedName() const { return nullptr; }
+    NameSyntax* asName();
+    const NameSyntax* asName() const;
+    IdentifierNameSyntax* asIdentifierName();
+    const IdentifierNameSyntax* asIdentifierName() const;
+    PredefinedNameSyntax* asPredefinedName();
+    const PredefinedNameSyntax* asPredefinedName() const;
 
     /* Operations */
-    virtual UnaryExpressionSyntax* asUnaryExpression() { return nullptr; }
-    virtual const UnaryExpressionSyntax* asUnaryExpression() const { return nullptr; }
-    virtual PostfixUnaryExpressionSyntax* asPostfixUnaryExpression() { return nullptr; }
-    virtual const PostfixUnaryExpressionSyntax* asPostfixUnaryExpression() const { return nullptr; }
-    virtual PrefixUnaryExpressionSyntax* asPrefixUnaryExpression() { return nullptr; }
-    virtual const PrefixUnaryExpressionSyntax* asPrefixUnaryExpression() const { return nullptr; }
-    virtual MemberAccessExpressionSyntax* asMemberAccessExpression() { return nullptr; }
-    virtual const MemberAccessExpressionSyntax* asMemberAccessExpression() const { return nullptr; }
-    virtual ArraySubscriptExpressionSyntax* asArraySubscriptExpression() { return nullptr; }
-    virtual const ArraySubscriptExpressionSyntax* asArraySubscriptExpression() const { return nullptr; }
-    virtual TypeTraitExpressionSyntax* asTypeTraitExpression() { return nullptr; }
-    virtual const TypeTraitExpressionSyntax* asTypeTraitExpression() const { return nullptr; }
-    virtual CallExpressionSyntax* asCallExpression() { return nullptr; }
-    virtual const CallExpressionSyntax* asCallExpression() const { return nullptr; }
-    virtual CompoundLiteralExpressionSyntax* asCompoundLiteralExpression() { return nullptr; }
-    virtual const CompoundLiteralExpressionSyntax* asCompoundLiteralExpression() const { return nullptr; }
-    virtual CastExpressionSyntax* asCastExpression() { return nullptr; }
-    virtual const CastExpressionSyntax* asCastExpression() const { return nullptr; }
-    virtual VAArgumentExpressionSyntax* asVAArgumentExpression() { return nullptr; }
-    virtual const VAArgumentExpressionSyntax* asVAArgumentExpression() const { return nullptr; }
-    virtual OffsetOfExpressionSyntax* asOffsetOfExpression() { return nullptr; }
-    virtual const OffsetOfExpressionSyntax* asOffsetOfExpression() const { return nullptr; }
-    virtual BinaryExpressionSyntax* asBinaryExpression() { return nullptr; }
-    virtual const BinaryExpressionSyntax* asBinaryExpression() const { return nullptr; }
-    virtual ConditionalExpressionSyntax* asConditionalExpression() { return nullptr; }
-    virtual const ConditionalExpressionSyntax* asConditionalExpression() const { return nullptr; }
-    virtual AssignmentExpressionSyntax* asAssignmentExpression() { return nullptr; }
-    virtual const AssignmentExpressionSyntax* asAssignmentExpression() const { return nullptr; }
-    virtual SequencingExpressionSyntax* asSequencingExpression() { return nullptr; }
-    virtual const SequencingExpressionSyntax* asSequencingExpression() const { return nullptr; }
-    virtual ExtGNU_ChooseExpressionSyntax* asExtGNU_ChooseExpression() { return nullptr; }
-    virtual const ExtGNU_ChooseExpressionSyntax* asExtGNU_ChooseExpression() const { return nullptr; }
+    UnaryExpressionSyntax* asUnaryExpression();
+    const UnaryExpressionSyntax* asUnaryExpression() const;
+    PostfixUnaryExpressionSyntax* asPostfixUnaryExpression();
+    const PostfixUnaryExpressionSyntax* asPostfixUnaryExpression() const;
+    PrefixUnaryExpressionSyntax* asPrefixUnaryExpression();
+    const PrefixUnaryExpressionSyntax* asPrefixUnaryExpression() const;
+    MemberAccessExpressionSyntax* asMemberAccessExpression();
+    const MemberAccessExpressionSyntax* asMemberAccessExpression() const;
+    ArraySubscriptExpressionSyntax* asArraySubscriptExpression();
+    const ArraySubscriptExpressionSyntax* asArraySubscriptExpression() const;
+    TypeTraitExpressionSyntax* asTypeTraitExpression();
+    const TypeTraitExpressionSyntax* asTypeTraitExpression() const;
+    CallExpressionSyntax* asCallExpression();
+    const CallExpressionSyntax* asCallExpression() const;
+    CompoundLiteralExpressionSyntax* asCompoundLiteralExpression();
+    const CompoundLiteralExpressionSyntax* asCompoundLiteralExpression() const;
+    CastExpressionSyntax* asCastExpression();
+    const CastExpressionSyntax* asCastExpression() const;
+    VAArgumentExpressionSyntax* asVAArgumentExpression();
+    const VAArgumentExpressionSyntax* asVAArgumentExpression() const;
+    OffsetOfExpressionSyntax* asOffsetOfExpression();
+    const OffsetOfExpressionSyntax* asOffsetOfExpression() const;
+    BinaryExpressionSyntax* asBinaryExpression();
+    const BinaryExpressionSyntax* asBinaryExpression() const;
+    ConditionalExpressionSyntax* asConditionalExpression();
+    const ConditionalExpressionSyntax* asConditionalExpression() const;
+    AssignmentExpressionSyntax* asAssignmentExpression();
+    const AssignmentExpressionSyntax* asAssignmentExpression() const;
+    SequencingExpressionSyntax* asSequencingExpression();
+    const SequencingExpressionSyntax* asSequencingExpression() const;
+    ExtGNU_ChooseExpressionSyntax* asExtGNU_ChooseExpression();
+    const ExtGNU_ChooseExpressionSyntax* asExtGNU_ChooseExpression() const;
 
     //------------//
     // Statements //
     //------------//
-    virtual StatementSyntax* asStatement() { return nullptr; }
-    virtual const StatementSyntax* asStatement() const { return nullptr; }
-    virtual CompoundStatementSyntax* asCompoundStatement() { return nullptr; }
-    virtual const CompoundStatementSyntax* asCompoundStatement() const { return nullptr; }
-    virtual DeclarationStatementSyntax* asDeclarationStatement() { return nullptr; }
-    virtual const DeclarationStatementSyntax* asDeclarationStatement() const { return nullptr; }
-    virtual ExpressionStatementSyntax* asExpressionStatement() { return nullptr; }
-    virtual const ExpressionStatementSyntax* asExpressionStatement() const { return nullptr; }
-    virtual LabeledStatementSyntax* asLabeledStatement() { return nullptr; }
-    virtual const LabeledStatementSyntax* asLabeledStatement() const { return nullptr; }
-    virtual IfStatementSyntax* asIfStatement() { return nullptr; }
-    virtual const IfStatementSyntax* asIfStatement() const { return nullptr; }
-    virtual SwitchStatementSyntax* asSwitchStatement() { return nullptr; }
-    virtual const SwitchStatementSyntax* asSwitchStatement() const { return nullptr; }
-    virtual WhileStatementSyntax* asWhileStatement() { return nullptr; }
-    virtual const WhileStatementSyntax* asWhileStatement() const { return nullptr; }
-    virtual DoStatementSyntax* asDoStatement() { return nullptr; }
-    virtual const DoStatementSyntax* asDoStatement() const { return nullptr; }
-    virtual ForStatementSyntax* asForStatement() { return nullptr; }
-    virtual const ForStatementSyntax* asForStatement() const { return nullptr; }
-    virtual GotoStatementSyntax* asGotoStatement() { return nullptr; }
-    virtual const GotoStatementSyntax* asGotoStatement() const { return nullptr; }
-    virtual ContinueStatementSyntax* asContinueStatement() { return nullptr; }
-    virtual const ContinueStatementSyntax* asContinueStatement() const { return nullptr; }
-    virtual BreakStatementSyntax* asBreakStatement() { return nullptr; }
-    virtual const BreakStatementSyntax* asBreakStatement() const { return nullptr; }
-    virtual ReturnStatementSyntax* asReturnStatement() { return nullptr; }
-    virtual const ReturnStatementSyntax* asReturnStatement() const { return nullptr; }
-    virtual ExtGNU_AsmStatementSyntax* asExtGNU_AsmStatement() { return nullptr; }
-    virtual const ExtGNU_AsmStatementSyntax* asExtGNU_AsmStatement() const { return nullptr; }
-    virtual ExtGNU_AsmQualifierSyntax* asExtGNU_AsmQualifier() { return nullptr; }
-    virtual const ExtGNU_AsmQualifierSyntax* asExtGNU_AsmQualifier() const { return nullptr; }
-    virtual ExtGNU_AsmOperandSyntax* asExtGNU_AsmOperand() { return nullptr; }
-    virtual const ExtGNU_AsmOperandSyntax* asExtGNU_AsmOperand() const { return nullptr; }
+    StatementSyntax* asStatement();
+    const StatementSyntax* asStatement() const;
+    CompoundStatementSyntax* asCompoundStatement();
+    const CompoundStatementSyntax* asCompoundStatement() const;
+    DeclarationStatementSyntax* asDeclarationStatement();
+    const DeclarationStatementSyntax* asDeclarationStatement() const;
+    ExpressionStatementSyntax* asExpressionStatement();
+    const ExpressionStatementSyntax* asExpressionStatement() const;
+    LabeledStatementSyntax* asLabeledStatement();
+    const LabeledStatementSyntax* asLabeledStatement() const;
+    IfStatementSyntax* asIfStatement();
+    const IfStatementSyntax* asIfStatement() const;
+    SwitchStatementSyntax* asSwitchStatement();
+    const SwitchStatementSyntax* asSwitchStatement() const;
+    WhileStatementSyntax* asWhileStatement();
+    const WhileStatementSyntax* asWhileStatement() const;
+    DoStatementSyntax* asDoStatement();
+    const DoStatementSyntax* asDoStatement() const;
+    ForStatementSyntax* asForStatement();
+    const ForStatementSyntax* asForStatement() const;
+    GotoStatementSyntax* asGotoStatement();
+    const GotoStatementSyntax* asGotoStatement() const;
+    ContinueStatementSyntax* asContinueStatement();
+    const ContinueStatementSyntax* asContinueStatement() const;
+    BreakStatementSyntax* asBreakStatement();
+    const BreakStatementSyntax* asBreakStatement() const;
+    ReturnStatementSyntax* asReturnStatement();
+    const ReturnStatementSyntax* asReturnStatement() const;
+    ExtGNU_AsmStatementSyntax* asExtGNU_AsmStatement();
+    const ExtGNU_AsmStatementSyntax* asExtGNU_AsmStatement() const;
+    ExtGNU_AsmQualifierSyntax* asExtGNU_AsmQualifier();
+    const ExtGNU_AsmQualifierSyntax* asExtGNU_AsmQualifier() const;
+    ExtGNU_AsmOperandSyntax* asExtGNU_AsmOperand();
+    const ExtGNU_AsmOperandSyntax* asExtGNU_AsmOperand() const;
 
     //--------//
     // Common //
     //--------//
-    virtual TypeNameSyntax* asTypeName() { return nullptr; }
-    virtual const TypeNameSyntax* asTypeName() const { return nullptr; }
-    virtual TypeReferenceSyntax* asTypeReference() { return nullptr; }
-    virtual const TypeReferenceSyntax* asTypeReference() const { return nullptr; }
-    virtual ExpressionAsTypeReferenceSyntax* asExpressionAsTypeReference() { return nullptr; }
-    virtual const ExpressionAsTypeReferenceSyntax* asExpressionAsTypeReference() const { return nullptr; }
-    virtual TypeNameAsTypeReferenceSyntax* asTypeNameAsTypeReference() { return nullptr; }
-    virtual const TypeNameAsTypeReferenceSyntax* asTypeNameAsTypeReference() const { return nullptr; }
+    TypeNameSyntax* asTypeName();
+    const TypeNameSyntax* asTypeName() const;
+    TypeReferenceSyntax* asTypeReference();
+    const TypeReferenceSyntax* asTypeReference() const;
+    ExpressionAsTypeReferenceSyntax* asExpressionAsTypeReference();
+    const ExpressionAsTypeReferenceSyntax* asExpressionAsTypeReference() const;
+    TypeNameAsTypeReferenceSyntax* asTypeNameAsTypeReference();
+    const TypeNameAsTypeReferenceSyntax* asTypeNameAsTypeReference() const;
 
     //-------------//
     // Ambiguities //
     //-------------//
-    virtual AmbiguousTypeNameOrExpressionAsTypeReferenceSyntax* asAmbiguousTypeNameOrExpressionAsTypeReference() { return nullptr; }
-    virtual const AmbiguousTypeNameOrExpressionAsTypeReferenceSyntax* asAmbiguousTypeNameOrExpressionAsTypeReference() const { return nullptr; }
-    virtual AmbiguousCastOrBinaryExpressionSyntax* asAmbiguousCastOrBinaryExpression() { return nullptr; }
-    virtual const AmbiguousCastOrBinaryExpressionSyntax* asAmbiguousCastOrBinaryExpression() const { return nullptr; }
-    virtual AmbiguousExpressionOrDeclarationStatementSyntax* asAmbiguousExpressionOrDeclarationStatement() { return nullptr; }
-    virtual const AmbiguousExpressionOrDeclarationStatementSyntax* asAmbiguousExpressionOrDeclarationStatement() const { return nullptr; }
+    AmbiguousTypeNameOrExpressionAsTypeReferenceSyntax* asAmbiguousTypeNameOrExpressionAsTypeReference();
+    const AmbiguousTypeNameOrExpressionAsTypeReferenceSyntax* asAmbiguousTypeNameOrExpressionAsTypeReference() const;
+    AmbiguousCastOrBinaryExpressionSyntax* asAmbiguousCastOrBinaryExpression();
+    const AmbiguousCastOrBinaryExpressionSyntax* asAmbiguousCastOrBinaryExpression() const;
+    AmbiguousExpressionOrDeclarationStatementSyntax* asAmbiguousExpressionOrDeclarationStatement();
+    const AmbiguousExpressionOrDeclarationStatementSyntax* asAmbiguousExpressionOrDeclarationStatement() const;
+
+PSY_INTERNAL_AND_RESTRICTED:
+    PSY_GRANT_ACCESS(SyntaxTree);
+    PSY_GRANT_ACCESS(SemanticModel);
+    PSY_GRANT_ACCESS(CompositeSyntaxVisitor);
+    template <class> friend class StaticSyntaxVisitor;
+
+    /*
+     * A dense ordinal, assigned at creation and unique within the
+     * SyntaxTree, for indexing per-node side tables.
+     */
+    unsigned int ordinal() const { return ordinal_; }
 
 protected:
     SyntaxNode(SyntaxTree* tree, SyntaxKind kind = Error);
@@ -357,11 +371,40 @@ protected:
     SyntaxToken findValidToken(const std::vector<SyntaxHolder>& syntaxHolders) const;
     void visitChildren(SyntaxVisitor* visitor) const;
 
+    /*
+     * The (non-virtual) counterpart of `visitChildren', for a
+     * StaticSyntaxVisitor: every AST node class enumerates its own
+     * children, after those of its base, through `traverse'.
+     */
+    template <class VisitorT> void traverseChildren(VisitorT*) const {}
+
+    template <class VisitorT, class... ChildrenT>
+    static void traverse(VisitorT* visitor, ChildrenT... children)
+    {
+        (traverseChild(visitor, children), ...);
+    }
+
+    template <class VisitorT>
+    static void traverseChild(VisitorT* visitor, const SyntaxNode* node)
+    {
+        visitor->visit(node);
+    }
+
+    template <class VisitorT, class PtrT, class DerivedListT>
+    static void traverseChild(VisitorT* visitor, const CoreSyntaxNodeList<PtrT, DerivedListT>* it)
+    {
+        visitor->visit(it);
+    }
+
+    template <class VisitorT>
+    static void traverseChild(VisitorT*, LexedTokens::IndexType) {}
+
     virtual std::vector<SyntaxHolder> childNodesAndTokens() const { return {}; }
     virtual SyntaxVisitor::Action dispatchVisit(SyntaxVisitor* visitor) const = 0;
 
     SyntaxTree* tree_;
     SyntaxKind kind_;
+    unsigned int ordinal_;
 };
 
 /**
@@ -31,9 +31,7 @@
     friend class Parser; \
     friend class Disambiguator; \
     friend class Binder; \
-    public: \
-        virtual NODE##Syntax* as##NODE() override { return this; } \
-        virtual const NODE##Syntax* as##NODE() const override { return this; }
+    public:
 
 /*
  * There are 2 coarse variations of AST nodes:
@@ -91,23 +89,32 @@
  * The children, either nodes or tokens, of an AST node.
  */
 #define AST_CHILD_LST1(NAME1) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_1(NAME1))
+    CHILD_NODES_AND_TOKENS(CHILD_NAME_1(NAME1)) \
+    TRAVERSE_CHILDREN(NAME1)
 #define AST_CHILD_LST2(NAME1, NAME2) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_2(NAME1, NAME2))
+    CHILD_NODES_AND_TOKENS(CHILD_NAME_2(NAME1, NAME2)) \
+    TRAVERSE_CHILDREN(NAME1, NAME2)
 #define AST_CHILD_LST3(NAME1, NAME2, NAME3) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_3(NAME1, NAME2, NAME3))
+    CHILD_NODES_AND_TOKENS(CHILD_NAME_3(NAME1, NAME2, NAME3)) \
+    TRAVERSE_CHILDREN(NAME1, NAME2, NAME3)
 #define AST_CHILD_LST4(NAME1, NAME2, NAME3, NAME4) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_4(NAME1, NAME2, NAME3, NAME4))
+    CHILD_NODES_AND_TOKENS(CHILD_NAME_4(NAME1, NAME2, NAME3, NAME4)) \
+    TRAVERSE_CHILDREN(NAME1, NAME2, NAME3, NAME4)
 #define AST_CHILD_LST5(NAME1, NAME2, NAME3, NAME4, NAME5) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_5(NAME1, NAME2, NAME3, NAME4, NAME5))
+    CHILD_NODES_AND_TOKENS(CHILD_NAME_5(NAME1, NAME2, NAME3, NAME4, NAME5)) \
+    TRAVERSE_CHILDREN(NAME1, NAME2, NAME3, NAME4, NAME5)
 #define AST_CHILD_LST6(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_6(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6))
+    CHILD_NODES_AND_TOKENS(CHILD_NAME_6(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6)) \
+    TRAVERSE_CHILDREN(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6)
 #define AST_CHILD_LST7(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_7(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7))
+    CHILD_NODES_AND_TOKENS(CHILD_NAME_7(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7)) \
+    TRAVERSE_CHILDREN(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7)
 #define AST_CHILD_LST8(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_8(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8))
+    CHILD_NODES_AND_TOKENS(CHILD_NAME_8(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8)) \
+    TRAVERSE_CHILDREN(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8)
 #define AST_CHILD_LST9(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_9(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9))
+    CHILD_NODES_AND_TOKENS(CHILD_NAME_9(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9)) \
+    TRAVERSE_CHILDREN(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9)
 
 #define CHILD_NAME_1(NAME1) \
     SyntaxHolder(NAME1)
@@ -155,6 +162,16 @@
             { auto self = { CHILDREN_SYNTAX }; \
               return merge(BaseSyntax::childNodesAndTokens(), self); }
 
+/*
+ * The default implementation of the function through which a
+ * `StaticSyntaxVisitor' traverses the children of the `this' node.
+ */
+#define TRAVERSE_CHILDREN(...) \
+    public: \
+        template <class VisitorT> void traverseChildren(VisitorT* visitor) const \
+            { BaseSyntax::traverseChildren(visitor); \
+              traverse(visitor, __VA_ARGS__); }
+
 using namespace psy;
 using namespace C;
 
@@ -304,6 +321,147 @@ class PSY_C_API TypeReferenceSyntax : public SyntaxNode
 #include "SyntaxNodes_Expressions.h"
 #include "SyntaxNodes_Statements.h"
 
+namespace psy {
+namespace C {
+
+/*
+ * The casts of a SyntaxNode are based on its SyntaxKind (not on virtual
+ * functions): each one checks whether the kind of the node is among the
+ * kinds of the target class (or of one of its subclasses).
+ */
+#define KIND_IS(KIND) (kind_ == KIND)
+#define KIND_WITHIN(FIRST_KIND, LAST_KIND) (kind_ >= FIRST_KIND && kind_ <= LAST_KIND)
+#define AST_CAST(NODE, KINDS) \
+    inline NODE##Syntax* SyntaxNode::as##NODE() \
+        { return (KINDS) ? static_cast<NODE##Syntax*>(this) : nullptr; } \
+    inline const NODE##Syntax* SyntaxNode::as##NODE() const \
+        { return (KINDS) ? static_cast<const NODE##Syntax*>(this) : nullptr; }
+
+AST_CAST(TranslationUnit, KIND_IS(TranslationUnit))
+AST_CAST(Declaration, KIND_WITHIN(IncompleteDeclaration, ExtKR_ParameterDeclaration))
+AST_CAST(IncompleteDeclaration, KIND_IS(IncompleteDeclaration))
+AST_CAST(NamedDeclaration, KIND_WITHIN(StructDeclaration, EnumDeclaration))
+AST_CAST(TypeDeclaration, KIND_WITHIN(StructDeclaration, EnumDeclaration))
+AST_CAST(TagDeclaration, KIND_WITHIN(StructDeclaration, EnumDeclaration))
+AST_CAST(StructOrUnionDeclaration, KIND_WITHIN(StructDeclaration, UnionDeclaration))
+AST_CAST(EnumDeclaration, KIND_IS(EnumDeclaration))
+AST_CAST(EnumeratorDeclaration, KIND_IS(EnumeratorDeclaration))
+AST_CAST(ValueDeclaration, KIND_WITHIN(EnumeratorDeclaration, ParameterDeclaration) \
+                           || KIND_IS(ExtKR_ParameterDeclaration))
+AST_CAST(DeclaratorDeclaration, KIND_WITHIN(VariableAndOrFunctionDeclaration, ParameterDeclaration) \
+                                || KIND_IS(ExtKR_ParameterDeclaration))
+AST_CAST(VariableAndOrFunctionDeclaration, KIND_IS(VariableAndOrFunctionDeclaration))
+AST_CAST(ParameterDeclaration, KIND_IS(ParameterDeclaration))
+AST_CAST(FieldDeclaration, KIND_IS(FieldDeclaration))
+AST_CAST(StaticAssertDeclaration, KIND_IS(StaticAssertDeclaration))
+AST_CAST(FunctionDefinition, KIND_IS(FunctionDefinition))
+AST_CAST(ExtPSY_TemplateDeclaration, KIND_IS(ExtPSY_TemplateDeclaration))
+AST_CAST(ExtGNU_AsmStatementDeclaration, KIND_IS(ExtGNU_AsmStatementDeclaration))
+AST_CAST(ExtKR_ParameterDeclaration, KIND_IS(ExtKR_ParameterDeclaration))
+AST_CAST(Specifier, KIND_WITHIN(TypedefStorageClass, ExtGNU_AttributeSpecifier) \
+                    || KIND_IS(ExtGNU_AsmLabel) \
+                    || KIND_WITHIN(ExtGNU_AsmVolatileQualifier, ExtGNU_AsmGotoQualifier))
+AST_CAST(TrivialSpecifier, KIND_WITHIN(TypedefStorageClass, BuiltinTypeSpecifier) \
+                           || KIND_WITHIN(InlineSpecifier, NoReturnSpecifier) \
+                           || KIND_WITHIN(ExtGNU_AsmVolatileQualifier, ExtGNU_AsmGotoQualifier))
+AST_CAST(StorageClass, KIND_WITHIN(TypedefStorageClass, ThreadLocalStorageClass))
+AST_CAST(BuiltinTypeSpecifier, KIND_IS(BuiltinTypeSpecifier))
+AST_CAST(TagTypeSpecifier, KIND_WITHIN(StructTypeSpecifier, EnumTypeSpecifier))
+AST_CAST(TypeDeclarationAsSpecifier, KIND_IS(TypeDeclarationAsSpecifier))
+AST_CAST(AtomicTypeSpecifier, KIND_IS(AtomicTypeSpecifier))
+AST_CAST(TypeQualifier, KIND_WITHIN(ConstQualifier, AtomicQualifier))
+AST_CAST(FunctionSpecifier, KIND_WITHIN(InlineSpecifier, NoReturnSpecifier))
+AST_CAST(AlignmentSpecifier, KIND_IS(AlignmentSpecifier))
+AST_CAST(TypedefName, KIND_IS(TypedefName))
+AST_CAST(ExtGNU_AttributeSpecifier, KIND_IS(ExtGNU_AttributeSpecifier))
+AST_CAST(ExtGNU_Attribute, KIND_IS(ExtGNU_Attribute))
+AST_CAST(ExtGNU_AsmLabel, KIND_IS(ExtGNU_AsmLabel))
+AST_CAST(ExtGNU_Typeof, KIND_IS(ExtGNU_Typeof))
+AST_CAST(ExtPSY_QuantifiedTypeSpecifier, KIND_IS(ExtPSY_QuantifiedTypeSpecifier))
+AST_CAST(Declarator, KIND_WITHIN(PointerDeclarator, BitfieldDeclarator))
+AST_CAST(PointerDeclarator, KIND_IS(PointerDeclarator))
+AST_CAST(IdentifierDeclarator, KIND_IS(IdentifierDeclarator))
+AST_CAST(AbstractDeclarator, KIND_IS(AbstractDeclarator))
+AST_CAST(ParenthesizedDeclarator, KIND_IS(ParenthesizedDeclarator))
+AST_CAST(ArrayOrFunctionDeclarator, KIND_WITHIN(ArrayDeclarator, FunctionDeclarator))
+AST_CAST(DeclaratorSuffix, KIND_WITHIN(SubscriptSuffix, ParameterSuffix))
+AST_CAST(SubscriptSuffix, KIND_IS(SubscriptSuffix))
+AST_CAST(ParameterSuffix, KIND_IS(ParameterSuffix))
+AST_CAST(BitfieldDeclarator, KIND_IS(BitfieldDeclarator))
+AST_CAST(Initializer, KIND_WITHIN(ExpressionInitializer, DesignatedInitializer))
+AST_CAST(ExpressionInitializer, KIND_IS(ExpressionInitializer))
+AST_CAST(BraceEnclosedInitializer, KIND_IS(BraceEnclosedInitializer))
+AST_CAST(DesignatedInitializer, KIND_IS(DesignatedInitializer))
+AST_CAST(Designator, KIND_WITHIN(FieldDesignator, OffsetOfDesignator))
+AST_CAST(ArrayDesignator, KIND_IS(ArrayDesignator))
+AST_CAST(FieldDesignator, KIND_IS(FieldDesignator))
+AST_CAST(OffsetOfDesignator, KIND_IS(OffsetOfDesignator))
+AST_CAST(Expression, KIND_WITHIN(IntegerConstantExpression, GenericSelectionExpression) \
+                     || KIND_WITHIN(ExtGNU_EnclosedCompoundStatementExpression, SequencingExpression) \
+                     || KIND_IS(AmbiguousCastOrBinaryExpression))
+AST_CAST(ConstantExpression, KIND_WITHIN(IntegerConstantExpression, NULL_ConstantExpression))
+AST_CAST(StringLiteralExpression, KIND_IS(StringLiteralExpression))
+AST_CAST(ParenthesizedExpression, KIND_IS(ParenthesizedExpression))
+AST_CAST(GenericSelectionExpression, KIND_IS(GenericSelectionExpression))
+AST_CAST(GenericAssociation, KIND_WITHIN(TypedGenericAssociation, DefaultGenericAssociation))
+AST_CAST(ExtGNU_EnclosedCompoundStatementExpression, KIND_IS(ExtGNU_EnclosedCompoundStatementExpression))
+AST_CAST(ExtGNU_ComplexValuedExpression, KIND_WITHIN(ExtGNU_ComplexValuedExpression, ExtGNU_ImagExpression))
+AST_CAST(Name, KIND_WITHIN(IdentifierName, PredefinedName))
+AST_CAST(IdentifierName, KIND_IS(IdentifierName))
+AST_CAST(PredefinedName, KIND_IS(PredefinedName))
+AST_CAST(UnaryExpression, KIND_WITHIN(PostIncrementExpression, LogicalNotExpression) \
+                          || KIND_WITHIN(AddressOfExpression, PointerIndirectionExpression))
+AST_CAST(PostfixUnaryExpression, KIND_WITHIN(PostIncrementExpression, PostDecrementExpression))
+AST_CAST(PrefixUnaryExpression, KIND_WITHIN(PreIncrementExpression, LogicalNotExpression) \
+                                || KIND_WITHIN(AddressOfExpression, PointerIndirectionExpression))
+AST_CAST(MemberAccessExpression, KIND_WITHIN(DirectMemberAccessExpression, IndirectMemberAccessExpression))
+AST_CAST(ArraySubscriptExpression, KIND_IS(ElementAccessExpression))
+AST_CAST(TypeTraitExpression, KIND_WITHIN(SizeofExpression, AlignofExpression))
+AST_CAST(CallExpression, KIND_IS(CallExpression))
+AST_CAST(CompoundLiteralExpression, KIND_IS(CompoundLiteralExpression))
+AST_CAST(CastExpression, KIND_IS(CastExpression))
+AST_CAST(VAArgumentExpression, KIND_IS(VAArgumentExpression))
+AST_CAST(OffsetOfExpression, KIND_IS(OffsetOfExpression))
+AST_CAST(BinaryExpression, KIND_WITHIN(MultiplyExpression, LogicalORExpression))
+AST_CAST(ConditionalExpression, KIND_IS(ConditionalExpression))
+AST_CAST(AssignmentExpression, KIND_WITHIN(BasicAssignmentExpression, OrAssignmentExpression))
+AST_CAST(SequencingExpression, KIND_IS(SequencingExpression))
+AST_CAST(ExtGNU_ChooseExpression, KIND_IS(ExtGNU_ChooseExpression))
+AST_CAST(Statement, KIND_WITHIN(CompoundStatement, CaseLabelStatement) \
+                    || KIND_WITHIN(IfStatement, ExtGNU_AsmStatement) \
+                    || KIND_WITHIN(AmbiguousCallOrVariableDeclaration, AmbiguousMultiplicationOrPointerDeclaration))
+AST_CAST(CompoundStatement, KIND_IS(CompoundStatement))
+AST_CAST(DeclarationStatement, KIND_IS(DeclarationStatement))
+AST_CAST(ExpressionStatement, KIND_IS(ExpressionStatement))
+AST_CAST(LabeledStatement, KIND_WITHIN(IdentifierLabelStatement, CaseLabelStatement))
+AST_CAST(IfStatement, KIND_IS(IfStatement))
+AST_CAST(SwitchStatement, KIND_IS(SwitchStatement))
+AST_CAST(WhileStatement, KIND_IS(WhileStatement))
+AST_CAST(DoStatement, KIND_IS(DoStatement))
+AST_CAST(ForStatement, KIND_IS(ForStatement))
+AST_CAST(GotoStatement, KIND_IS(GotoStatement))
+AST_CAST(ContinueStatement, KIND_IS(ContinueStatement))
+AST_CAST(BreakStatement, KIND_IS(BreakStatement))
+AST_CAST(ReturnStatement, KIND_IS(ReturnStatement))
+AST_CAST(ExtGNU_AsmStatement, KIND_IS(ExtGNU_AsmStatement))
+AST_CAST(ExtGNU_AsmQualifier, KIND_WITHIN(ExtGNU_AsmVolatileQualifier, ExtGNU_AsmGotoQualifier))
+AST_CAST(ExtGNU_AsmOperand, KIND_WITHIN(ExtGNU_AsmInputOperand, ExtGNU_AsmOutputOperand))
+AST_CAST(TypeName, KIND_IS(TypeName))
+AST_CAST(TypeReference, KIND_WITHIN(ExpressionAsTypeReference, TypeNameAsTypeReference) \
+                        || KIND_IS(AmbiguousTypeNameOrExpressionAsTypeReference))
+AST_CAST(ExpressionAsTypeReference, KIND_IS(ExpressionAsTypeReference))
+AST_CAST(TypeNameAsTypeReference, KIND_IS(TypeNameAsTypeReference))
+AST_CAST(AmbiguousTypeNameOrExpressionAsTypeReference, KIND_IS(AmbiguousTypeNameOrExpressionAsTypeReference))
+AST_CAST(AmbiguousCastOrBinaryExpression, KIND_IS(AmbiguousCastOrBinaryExpression))
+AST_CAST(AmbiguousExpressionOrDeclarationStatement, KIND_WITHIN(AmbiguousCallOrVariableDeclaration, AmbiguousMultiplicationOrPointerDeclaration))
+
+#undef KIND_IS
+#undef KIND_WITHIN
+#undef AST_CAST
+
+} // C
+} // psy
+
 #undef AST__COMMON__
 #undef AST_G_NODE__COMMON__
 #undef AST_NODE__COMMON__
@@ -206,6 +206,8 @@ PSY_INTERNAL_AND_RESTRICTED:
     PSY_GRANT_ACCESS(SyntaxNode);
     PSY_GRANT_ACCESS(Lexer);
     PSY_GRANT_ACCESS(Parser);
+    PSY_GRANT_ACCESS(Unparser);
+    PSY_GRANT_ACCESS(SyntaxNamePrinter);
 
     SyntaxToken(SyntaxTree* tree);
 
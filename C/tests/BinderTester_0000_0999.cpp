@@ -554,10 +554,30 @@ void BinderTester::case0111()
 
 void BinderTester::case0112()
 {
+    bind("void x ( ) { int y ; } double z ( ) { }",
+         Expectation()
+         .binding(DeclSummary()
+                  .Value("y", ValueKind::Variable, ScopeKind::Block)
+                  .TySpec.basis("int", NamedTypeKind::Builtin, BuiltinTypeKind::Int))
+         .binding(DeclSummary()
+                  .Function("z", ScopeKind::File)
+                  .TySpec.basis("double", NamedTypeKind::Builtin, BuiltinTypeKind::Double)
+                  .TySpec.deriv(TypeKind::Function)));
 }
 
 void BinderTester::case0113()
 {
+    bind("int x ( ) { double y , z ; } int w ;",
+         Expectation()
+         .binding(DeclSummary()
+                  .Value("y", ValueKind::Variable, ScopeKind::Block)
+                  .TySpec.basis("double", NamedTypeKind::Builtin, BuiltinTypeKind::Double))
+         .binding(DeclSummary()
+                  .Value("z", ValueKind::Variable, ScopeKind::Block)
+                  .TySpec.basis("double", NamedTypeKind::Builtin, BuiltinTypeKind::Double))
+         .binding(DeclSummary()
+                  .Value("w", ValueKind::Variable, ScopeKind::File)
+                  .TySpec.basis("int", NamedTypeKind::Builtin, BuiltinTypeKind::Int)));
 }
 
 void BinderTester::case0114()
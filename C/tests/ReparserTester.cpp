@@ -45,6 +45,11 @@ void ReparserTester::reparse_withGuidelineImposition(std::string text, Expectati
     (static_cast<InternalsTestSuite*>(suite_)->reparse_withGuidelineImposition(text, X));
 }
 
+void ReparserTester::parse_withTypedefNameTracking(std::string text, Expectation X)
+{
+    (static_cast<InternalsTestSuite*>(suite_)->parse_withTypedefNameTracking(text, X));
+}
+
 static std::vector<SyntaxKind> body(std::vector<SyntaxKind>&& v)
 {
     std::vector<SyntaxKind> w = { TranslationUnit,
@@ -148,11 +153,151 @@ int _ ( )
                                          IdentifierName })));
 }
 
-void ReparserTester::case0005(){}
-void ReparserTester::case0006(){}
-void ReparserTester::case0007(){}
-void ReparserTester::case0008(){}
-void ReparserTester::case0009(){}
+void ReparserTester::case0005()
+{
+    auto s = R"(
+int _ ( )
+{
+    x + 1 ;
+    return ( x ) * y ;
+}
+)";
+
+    reparse_withSyntaxCorrelation(
+                s,
+                Expectation().AST(body({ ExpressionStatement,
+                                         AddExpression,
+                                         IdentifierName,
+                                         IntegerConstantExpression,
+                                         ReturnStatement,
+                                         MultiplyExpression,
+                                         ParenthesizedExpression,
+                                         IdentifierName,
+                                         IdentifierName })));
+}
+
+void ReparserTester::case0006()
+{
+    auto s = R"(
+int _ ( )
+{
+    if ( a ) b ;
+    x z ;
+    x * y ;
+}
+)";
+
+    reparse_withSyntaxCorrelation(
+                s,
+                Expectation().AST(body({ IfStatement,
+                                         IdentifierName,
+                                         ExpressionStatement,
+                                         IdentifierName,
+                                         DeclarationStatement,
+                                         VariableAndOrFunctionDeclaration,
+                                         TypedefName,
+                                         IdentifierDeclarator,
+                                         DeclarationStatement,
+                                         VariableAndOrFunctionDeclaration,
+                                         TypedefName,
+                                         PointerDeclarator,
+                                         IdentifierDeclarator })));
+}
+
+void ReparserTester::case0007()
+{
+    auto s = R"(
+x w ;
+int _ ( )
+{
+    x * y ;
+}
+)";
+
+    reparse_withSyntaxCorrelation(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    PointerDeclarator,
+                                    IdentifierDeclarator }));
+}
+
+void ReparserTester::case0008()
+{
+    auto s = R"(
+int f ( )
+{
+    x + y ;
+}
+int _ ( )
+{
+    x z ;
+    x * y ;
+}
+)";
+
+    reparse_withSyntaxCorrelation(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    ExpressionStatement,
+                                    AddExpression,
+                                    IdentifierName,
+                                    IdentifierName,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    IdentifierDeclarator,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    PointerDeclarator,
+                                    IdentifierDeclarator }));
+}
+void ReparserTester::case0009()
+{
+    auto s = R"(
+int _ ( )
+{
+    x * y ;
+}
+x w ;
+)";
+
+    // The type name is catalogued (in the file level) after the function.
+    reparse_withSyntaxCorrelation(
+                s,
+                Expectation().ambiguity(R"(
+int _ ( )
+{
+    x * y ;
+    x * y ;
+}
+x w ;
+)"));
+}
 void ReparserTester::case0010(){}
 void ReparserTester::case0011(){}
 void ReparserTester::case0012(){}
@@ -244,11 +389,169 @@ void ReparserTester::case0097(){}
 void ReparserTester::case0098(){}
 void ReparserTester::case0099(){}
 
-void ReparserTester::case0100(){}
-void ReparserTester::case0101(){}
-void ReparserTester::case0102(){}
-void ReparserTester::case0103(){}
-void ReparserTester::case0104(){}
+void ReparserTester::case0100()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    x * y ;
+}
+)";
+
+    reparse_withTypeSynonymVerification(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    PointerDeclarator,
+                                    IdentifierDeclarator }));
+}
+
+void ReparserTester::case0101()
+{
+    auto s = R"(
+int x ;
+int _ ( )
+{
+    x * y ;
+}
+)";
+
+    reparse_withTypeSynonymVerification(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    ExpressionStatement,
+                                    MultiplyExpression,
+                                    IdentifierName,
+                                    IdentifierName }));
+}
+
+void ReparserTester::case0102()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    int x ;
+    x * y ;
+}
+)";
+
+    reparse_withTypeSynonymVerification(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    ExpressionStatement,
+                                    MultiplyExpression,
+                                    IdentifierName,
+                                    IdentifierName }));
+}
+
+void ReparserTester::case0103()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    {
+        int x ;
+    }
+    x * y ;
+}
+)";
+
+    reparse_withTypeSynonymVerification(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    PointerDeclarator,
+                                    IdentifierDeclarator }));
+}
+
+void ReparserTester::case0104()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    for ( x * y = 0 ; ; ) ;
+}
+)";
+
+    reparse_withTypeSynonymVerification(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    ForStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    PointerDeclarator,
+                                    IdentifierDeclarator,
+                                    ExpressionInitializer,
+                                    IntegerConstantExpression,
+                                    ExpressionStatement }));
+}
 void ReparserTester::case0105(){}
 void ReparserTester::case0106(){}
 void ReparserTester::case0107(){}
@@ -264,8 +567,72 @@ void ReparserTester::case0116(){}
 void ReparserTester::case0117(){}
 void ReparserTester::case0118(){}
 void ReparserTester::case0119(){}
-void ReparserTester::case0120(){}
-void ReparserTester::case0121(){}
+void ReparserTester::case0120()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    x ( y ) ;
+}
+)";
+
+    reparse_withTypeSynonymVerification(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    ParenthesizedDeclarator,
+                                    IdentifierDeclarator }));
+}
+
+void ReparserTester::case0121()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    x * y ;
+    x ( y ) ;
+}
+)";
+
+    reparse_withTypeSynonymVerification(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    PointerDeclarator,
+                                    IdentifierDeclarator,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    ParenthesizedDeclarator,
+                                    IdentifierDeclarator }));
+}
+
 void ReparserTester::case0122(){}
 void ReparserTester::case0123(){}
 void ReparserTester::case0124(){}
@@ -284,8 +651,71 @@ void ReparserTester::case0136(){}
 void ReparserTester::case0137(){}
 void ReparserTester::case0138(){}
 void ReparserTester::case0139(){}
-void ReparserTester::case0140(){}
-void ReparserTester::case0141(){}
+void ReparserTester::case0140()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    return ( x ) * y ;
+}
+)";
+
+    reparse_withTypeSynonymVerification(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    ReturnStatement,
+                                    CastExpression,
+                                    TypeName,
+                                    TypedefName,
+                                    AbstractDeclarator,
+                                    PointerIndirectionExpression,
+                                    IdentifierName }));
+}
+
+void ReparserTester::case0141()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( int x )
+{
+    return ( x ) * y ;
+}
+)";
+
+    reparse_withTypeSynonymVerification(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    ParameterDeclaration,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    CompoundStatement,
+                                    ReturnStatement,
+                                    MultiplyExpression,
+                                    ParenthesizedExpression,
+                                    IdentifierName,
+                                    IdentifierName }));
+}
+
 void ReparserTester::case0142(){}
 void ReparserTester::case0143(){}
 void ReparserTester::case0144(){}
@@ -304,8 +734,64 @@ void ReparserTester::case0156(){}
 void ReparserTester::case0157(){}
 void ReparserTester::case0158(){}
 void ReparserTester::case0159(){}
-void ReparserTester::case0160(){}
-void ReparserTester::case0161(){}
+void ReparserTester::case0160()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    return sizeof ( x ) ;
+}
+)";
+
+    reparse_withTypeSynonymVerification(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    ReturnStatement,
+                                    SizeofExpression,
+                                    TypeNameAsTypeReference,
+                                    TypeName,
+                                    TypedefName }));
+}
+
+void ReparserTester::case0161()
+{
+    auto s = R"(
+int _ ( int x )
+{
+    return sizeof ( x ) ;
+}
+)";
+
+    reparse_withTypeSynonymVerification(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    ParameterDeclaration,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    CompoundStatement,
+                                    ReturnStatement,
+                                    SizeofExpression,
+                                    ExpressionAsTypeReference,
+                                    ParenthesizedExpression,
+                                    IdentifierName }));
+}
+
 void ReparserTester::case0162(){}
 void ReparserTester::case0163(){}
 void ReparserTester::case0164(){}
@@ -345,12 +831,207 @@ void ReparserTester::case0197(){}
 void ReparserTester::case0198(){}
 void ReparserTester::case0199(){}
 
-void ReparserTester::case0200(){}
-void ReparserTester::case0201(){}
-void ReparserTester::case0202(){}
-void ReparserTester::case0203(){}
-void ReparserTester::case0204(){}
-void ReparserTester::case0205(){}
+void ReparserTester::case0200()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    x * y ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    PointerDeclarator,
+                                    IdentifierDeclarator }));
+}
+
+void ReparserTester::case0201()
+{
+    auto s = R"(
+int x ;
+int _ ( )
+{
+    x * y ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    ExpressionStatement,
+                                    MultiplyExpression,
+                                    IdentifierName,
+                                    IdentifierName }));
+}
+
+void ReparserTester::case0202()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    int x ;
+    x * y ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    ExpressionStatement,
+                                    MultiplyExpression,
+                                    IdentifierName,
+                                    IdentifierName }));
+}
+
+void ReparserTester::case0203()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    {
+        int x ;
+    }
+    x * y ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    PointerDeclarator,
+                                    IdentifierDeclarator }));
+}
+
+void ReparserTester::case0204()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    for ( int x ; ; ) ;
+    x * y ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    ForStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    ExpressionStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    PointerDeclarator,
+                                    IdentifierDeclarator }));
+}
+
+void ReparserTester::case0205()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    enum { x } ;
+    x * y ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    EnumDeclaration,
+                                    EnumTypeSpecifier,
+                                    EnumeratorDeclaration,
+                                    ExpressionStatement,
+                                    MultiplyExpression,
+                                    IdentifierName,
+                                    IdentifierName }));
+}
+
 void ReparserTester::case0206(){}
 void ReparserTester::case0207(){}
 void ReparserTester::case0208(){}
@@ -365,8 +1046,72 @@ void ReparserTester::case0216(){}
 void ReparserTester::case0217(){}
 void ReparserTester::case0218(){}
 void ReparserTester::case0219(){}
-void ReparserTester::case0220(){}
-void ReparserTester::case0221(){}
+void ReparserTester::case0220()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    x ( y ) ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    ParenthesizedDeclarator,
+                                    IdentifierDeclarator }));
+}
+
+void ReparserTester::case0221()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    x * y ;
+    x ( y ) ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    PointerDeclarator,
+                                    IdentifierDeclarator,
+                                    DeclarationStatement,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefName,
+                                    ParenthesizedDeclarator,
+                                    IdentifierDeclarator }));
+}
+
 void ReparserTester::case0222(){}
 void ReparserTester::case0223(){}
 void ReparserTester::case0224(){}
@@ -385,8 +1130,71 @@ void ReparserTester::case0236(){}
 void ReparserTester::case0237(){}
 void ReparserTester::case0238(){}
 void ReparserTester::case0239(){}
-void ReparserTester::case0240(){}
-void ReparserTester::case0241(){}
+void ReparserTester::case0240()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    return ( x ) * y ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    ReturnStatement,
+                                    CastExpression,
+                                    TypeName,
+                                    TypedefName,
+                                    AbstractDeclarator,
+                                    PointerIndirectionExpression,
+                                    IdentifierName }));
+}
+
+void ReparserTester::case0241()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( int x )
+{
+    return ( x ) * y ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    ParameterDeclaration,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    CompoundStatement,
+                                    ReturnStatement,
+                                    MultiplyExpression,
+                                    ParenthesizedExpression,
+                                    IdentifierName,
+                                    IdentifierName }));
+}
+
 void ReparserTester::case0242(){}
 void ReparserTester::case0243(){}
 void ReparserTester::case0244(){}
@@ -405,8 +1213,65 @@ void ReparserTester::case0256(){}
 void ReparserTester::case0257(){}
 void ReparserTester::case0258(){}
 void ReparserTester::case0259(){}
-void ReparserTester::case0260(){}
-void ReparserTester::case0261(){}
+void ReparserTester::case0260()
+{
+    auto s = R"(
+typedef int x ;
+int _ ( )
+{
+    return sizeof ( x ) ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    VariableAndOrFunctionDeclaration,
+                                    TypedefStorageClass,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    CompoundStatement,
+                                    ReturnStatement,
+                                    SizeofExpression,
+                                    TypeNameAsTypeReference,
+                                    TypeName,
+                                    TypedefName,
+                                    AbstractDeclarator }));
+}
+
+void ReparserTester::case0261()
+{
+    auto s = R"(
+int _ ( int x )
+{
+    return sizeof ( x ) ;
+}
+)";
+
+    parse_withTypedefNameTracking(
+                s,
+                Expectation().AST({ TranslationUnit,
+                                    FunctionDefinition,
+                                    BuiltinTypeSpecifier,
+                                    FunctionDeclarator,
+                                    IdentifierDeclarator,
+                                    ParameterSuffix,
+                                    ParameterDeclaration,
+                                    BuiltinTypeSpecifier,
+                                    IdentifierDeclarator,
+                                    CompoundStatement,
+                                    ReturnStatement,
+                                    SizeofExpression,
+                                    ExpressionAsTypeReference,
+                                    ParenthesizedExpression,
+                                    IdentifierName }));
+}
+
 void ReparserTester::case0262(){}
 void ReparserTester::case0263(){}
 void ReparserTester::case0264(){}
@@ -45,6 +45,7 @@ public:
     void reparse_withSyntaxCorrelation(std::string text, Expectation X = Expectation());
     void reparse_withTypeSynonymVerification(std::string text, Expectation X = Expectation());
     void reparse_withGuidelineImposition(std::string text, Expectation X = Expectation());
+    void parse_withTypedefNameTracking(std::string text, Expectation X = Expectation());
 
     using TestFunction = std::pair<std::function<void(ReparserTester*)>, const char*>;
 
@@ -55,6 +56,18 @@ public:
             + 0040-0059 -> cast x binary expression
             + 0060-0069 -> type name x expression (as type reference)
 
+        Type Synonyms Verification
+            + 0100-0119 -> multiplication x pointer declaration
+            + 0120-0139 -> call x variable declaration
+            + 0140-0159 -> cast x binary expression
+            + 0160-0169 -> type name x expression (as type reference)
+
+        Type Synonyms Verification (while parsing)
+            + 0200-0219 -> multiplication x pointer declaration
+            + 0220-0239 -> call x variable declaration
+            + 0240-0259 -> cast x binary expression
+            + 0260-0269 -> type name x expression (as type reference)
+
      */
 
     void case0001();
@@ -22,7 +22,14 @@
 
 #include "TestSuite_API.h"
 
+#include "C/binder/NameSpace.h"
+#include "C/binder/Scope.h"
+#include "C/compilation/Assembly.h"
 #include "C/symbols/Symbol_ALL.h"
+#include "C/syntax/SyntaxLexeme_ALL.h"
+#include "C/syntax/SyntaxUtilities.h"
+
+#include <thread>
 
 using namespace psy;
 using namespace C;
@@ -74,6 +81,39 @@ SemanticModelTester::declAndSemaModel(const std::string& s)
     return std::make_tuple(decl, semaModel);
 }
 
+std::tuple<const ExpressionSyntax*, const SemanticModel*>
+SemanticModelTester::exprAndSemaModel(const std::string& s)
+{
+    tree_ = SyntaxTree::parseText(SourceText(s),
+                                  TextPreprocessingState::Preprocessed,
+                                  TextCompleteness::Fragment,
+                                  ParseOptions(),
+                                  "<test>");
+
+    auto TU = tree_->translationUnitRoot();
+    PSY_EXPECT_TRUE(TU);
+
+    // The expression of the last statement of the last function definition.
+    const FunctionDefinitionSyntax* funcDef = nullptr;
+    for (auto declIt = TU->declarations(); declIt; declIt = declIt->next) {
+        if (declIt->value->asFunctionDefinition())
+            funcDef = declIt->value->asFunctionDefinition();
+    }
+    PSY_EXPECT_TRUE(funcDef);
+
+    const StatementSyntax* stmt = nullptr;
+    for (auto stmtIt = funcDef->body()->asCompoundStatement()->statements(); stmtIt; stmtIt = stmtIt->next)
+        stmt = stmtIt->value;
+    PSY_EXPECT_TRUE(stmt && stmt->asExpressionStatement());
+
+    compilation_ = Compilation::create(tree_->filePath());
+    compilation_->addSyntaxTrees({ tree_.get() });
+    auto semaModel = compilation_->semanticModel(tree_.get());
+    PSY_EXPECT_TRUE(semaModel);
+
+    return std::make_tuple(stmt->asExpressionStatement()->expression(), semaModel);
+}
+
 void SemanticModelTester::testSemanticModel()
 {
     return run<SemanticModelTester>(tests_);
@@ -310,7 +350,48 @@ void SemanticModelTester::case0151()
 {
 }
 
-void SemanticModelTester::case0152(){}
+void SemanticModelTester::case0152()
+{
+    tree_ = SyntaxTree::parseText(SourceText("void x ( int y ) { int z ; } "
+                                             "void w ( ) { double v ; }"),
+                                  TextPreprocessingState::Preprocessed,
+                                  TextCompleteness::Fragment,
+                                  ParseOptions(),
+                                  "<test>");
+
+    compilation_ = Compilation::create(tree_->filePath());
+    compilation_->setTreatmentOfFunctionBodies(
+                Compilation::TreatmentOfFunctionBodies::BindOnDemand);
+    compilation_->addSyntaxTrees({ tree_.get() });
+    auto semaModel = compilation_->semanticModel(tree_.get());
+    PSY_EXPECT_TRUE(semaModel);
+
+    auto assembly = static_cast<const Compilation*>(compilation_.get())->assembly();
+    PSY_EXPECT_TRUE(assembly->searchForSymbols("z", NameSpaceKind::Ordinary, SymbolKind::Value).empty());
+    PSY_EXPECT_TRUE(assembly->searchForSymbols("v", NameSpaceKind::Ordinary, SymbolKind::Value).empty());
+
+    auto funcDef = tree_->translationUnitRoot()->declarations()->value->asFunctionDefinition();
+    const FunctionSymbol* funcSym = semaModel->declaredSymbol(funcDef);
+    PSY_EXPECT_TRUE(funcSym);
+    auto symCnt = assembly->symbolCount();
+
+    auto stmt = funcDef->body()->asCompoundStatement()->statements()->value;
+    auto varAndOrFunDecl = stmt->asDeclarationStatement()->declaration()
+            ->asVariableAndOrFunctionDeclaration();
+    auto syms = semaModel->declaredSymbols(varAndOrFunDecl);
+    PSY_EXPECT_EQ_INT(syms.size(), 1u);
+    PSY_EXPECT_EQ_ENU(syms[0]->kind(), SymbolKind::Value, SymbolKind);
+    PSY_EXPECT_EQ_STR(syms[0]->asValue()->name()->text(), "z");
+    PSY_EXPECT_TRUE(syms[0]->scope()->outerScope() == funcSym->scope());
+    PSY_EXPECT_TRUE(assembly->symbolCount() > symCnt);
+
+    // Bound only once.
+    symCnt = assembly->symbolCount();
+    PSY_EXPECT_EQ_PTR(semaModel->declaredSymbols(varAndOrFunDecl)[0], syms[0]);
+    PSY_EXPECT_EQ_INT(assembly->symbolCount(), symCnt);
+    PSY_EXPECT_EQ_INT(assembly->searchForSymbols("z", NameSpaceKind::Ordinary, SymbolKind::Value).size(), 1u);
+    PSY_EXPECT_TRUE(assembly->searchForSymbols("v", NameSpaceKind::Ordinary, SymbolKind::Value).empty());
+}
 void SemanticModelTester::case0153(){}
 void SemanticModelTester::case0154(){}
 void SemanticModelTester::case0155(){}
@@ -942,3 +1023,831 @@ void SemanticModelTester::case0506(){}
 void SemanticModelTester::case0507(){}
 void SemanticModelTester::case0508(){}
 void SemanticModelTester::case0509(){}
+
+void SemanticModelTester::case0600()
+{
+    auto [varAndOrFunDecl, semaModel] =
+            declAndSemaModel<VariableAndOrFunctionDeclarationSyntax>("int x ; double y ;");
+
+    auto identDecltor = varAndOrFunDecl->declarators()->value->asIdentifierDeclarator();
+    const Symbol* sym = semaModel->declaredSymbol(identDecltor);
+    PSY_EXPECT_TRUE(sym);
+
+    const Scope* scope = sym->scope();
+    PSY_EXPECT_TRUE(scope);
+    PSY_EXPECT_EQ_ENU(scope->kind(), ScopeKind::File, ScopeKind);
+    PSY_EXPECT_TRUE(scope->outerScope() == nullptr);
+    PSY_EXPECT_TRUE(sym->nameSpace());
+    PSY_EXPECT_EQ_ENU(sym->nameSpace()->kind(), NameSpaceKind::Ordinary, NameSpaceKind);
+    PSY_EXPECT_EQ_PTR(scope->nameSpace(NameSpaceKind::Ordinary), sym->nameSpace());
+    PSY_EXPECT_EQ_INT(scope->nameSpace(NameSpaceKind::Ordinary)->size(), 2u);
+
+    auto ident = identDecltor->identifierToken().valueLexeme()->asIdentifier();
+    PSY_EXPECT_EQ_PTR(scope->searchForSymbol(ident, NameSpaceKind::Ordinary), sym);
+    PSY_EXPECT_TRUE(scope->searchForSymbol(ident, NameSpaceKind::Tags) == nullptr);
+
+    auto varAndOrFunDecl1 = tree_->translationUnitRoot()->declarations()->next->value
+            ->asVariableAndOrFunctionDeclaration();
+    auto identDecltor1 = varAndOrFunDecl1->declarators()->value->asIdentifierDeclarator();
+    auto ident1 = identDecltor1->identifierToken().valueLexeme()->asIdentifier();
+    const Symbol* sym1 = semaModel->declaredSymbol(identDecltor1);
+    PSY_EXPECT_TRUE(sym1);
+    PSY_EXPECT_EQ_PTR(scope->searchForSymbol(ident1, NameSpaceKind::Ordinary), sym1);
+}
+
+void SemanticModelTester::case0601()
+{
+    auto [tyDecl, semaModel] =
+            declAndSemaModel<StructOrUnionDeclarationSyntax>("struct x { int y ; } ;");
+
+    const NamedTypeSymbol* namedTySym = semaModel->declaredSymbol(tyDecl);
+    PSY_EXPECT_TRUE(namedTySym);
+
+    const Scope* scope = namedTySym->scope();
+    PSY_EXPECT_TRUE(scope);
+    auto tagIdent = tyDecl->typeSpecifier()->tagToken().valueLexeme()->asIdentifier();
+    PSY_EXPECT_EQ_PTR(scope->searchForSymbol(tagIdent, NameSpaceKind::Tags), namedTySym);
+    PSY_EXPECT_TRUE(scope->searchForSymbol(tagIdent, NameSpaceKind::Ordinary) == nullptr);
+
+    auto fldDecl = tyDecl->typeSpecifier()->declarations()->value->asFieldDeclaration();
+    auto identDecltor = fldDecl->declarators()->value->asIdentifierDeclarator();
+    auto fldIdent = identDecltor->identifierToken().valueLexeme()->asIdentifier();
+    PSY_EXPECT_TRUE(scope->searchForSymbol(fldIdent, NameSpaceKind::Ordinary) == nullptr);
+}
+
+void SemanticModelTester::case0602()
+{
+    auto [funcDef, semaModel] =
+            declAndSemaModel<FunctionDefinitionSyntax>("void x ( int y ) { }");
+
+    const FunctionSymbol* funcSym = semaModel->declaredSymbol(funcDef);
+    PSY_EXPECT_TRUE(funcSym);
+
+    auto arrOrFunDecltor = funcDef->declarator()->asArrayOrFunctionDeclarator();
+    auto parmDecl0 = arrOrFunDecltor->suffix()->asParameterSuffix()->parameters()->value;
+    const ParameterSymbol* parmSym = semaModel->declaredSymbol(parmDecl0);
+    PSY_EXPECT_TRUE(parmSym);
+
+    const Scope* scope = parmSym->scope();
+    PSY_EXPECT_TRUE(scope);
+    PSY_EXPECT_EQ_ENU(scope->kind(), ScopeKind::Block, ScopeKind);
+    PSY_EXPECT_TRUE(scope->outerScope());
+    PSY_EXPECT_EQ_PTR(scope->outerScope(), funcSym->scope());
+
+    auto parmIdent = parmDecl0->declarator()->asIdentifierDeclarator()
+            ->identifierToken().valueLexeme()->asIdentifier();
+    PSY_EXPECT_EQ_PTR(scope->searchForSymbol(parmIdent, NameSpaceKind::Ordinary), parmSym);
+    PSY_EXPECT_TRUE(funcSym->scope()->searchForSymbol(parmIdent, NameSpaceKind::Ordinary) == nullptr);
+
+    auto funcIdent = arrOrFunDecltor->innerDeclarator()->asIdentifierDeclarator()
+            ->identifierToken().valueLexeme()->asIdentifier();
+    PSY_EXPECT_EQ_PTR(scope->searchForSymbol(funcIdent, NameSpaceKind::Ordinary), funcSym);
+}
+
+void SemanticModelTester::case0603()
+{
+    auto [tyDecl, semaModel] =
+            declAndSemaModel<EnumDeclarationSyntax>("enum x { y } ;");
+
+    const NamedTypeSymbol* namedTySym = semaModel->declaredSymbol(tyDecl);
+    PSY_EXPECT_TRUE(namedTySym);
+
+    auto enumtrDecl0 = tyDecl->typeSpecifier()->declarations()->value->asEnumeratorDeclaration();
+    const EnumeratorSymbol* enumtrSym = semaModel->declaredSymbol(enumtrDecl0);
+    PSY_EXPECT_TRUE(enumtrSym);
+
+    const Scope* scope = namedTySym->scope();
+    PSY_EXPECT_TRUE(scope);
+    auto enumtrIdent = enumtrDecl0->identifierToken().valueLexeme()->asIdentifier();
+    PSY_EXPECT_EQ_PTR(scope->searchForSymbol(enumtrIdent, NameSpaceKind::Ordinary), enumtrSym);
+}
+
+void SemanticModelTester::case0604()
+{
+    auto [funcDef, semaModel] =
+            declAndSemaModel<FunctionDefinitionSyntax>("void x ( ) { int x ; }");
+
+    const FunctionSymbol* funcSym = semaModel->declaredSymbol(funcDef);
+    PSY_EXPECT_TRUE(funcSym);
+
+    auto stmt = funcDef->body()->asCompoundStatement()->statements()->value;
+    auto varAndOrFunDecl = stmt->asDeclarationStatement()->declaration()
+            ->asVariableAndOrFunctionDeclaration();
+    auto identDecltor = varAndOrFunDecl->declarators()->value->asIdentifierDeclarator();
+    const Symbol* varSym = semaModel->declaredSymbol(identDecltor);
+    PSY_EXPECT_TRUE(varSym);
+    PSY_EXPECT_TRUE(varSym->scope() != funcSym->scope());
+
+    auto ident = identDecltor->identifierToken().valueLexeme()->asIdentifier();
+    PSY_EXPECT_EQ_PTR(varSym->scope()->searchForSymbol(ident, NameSpaceKind::Ordinary), varSym);
+    PSY_EXPECT_EQ_PTR(funcSym->scope()->searchForSymbol(ident, NameSpaceKind::Ordinary), funcSym);
+}
+
+void SemanticModelTester::case0605(){}
+void SemanticModelTester::case0606(){}
+void SemanticModelTester::case0607(){}
+void SemanticModelTester::case0608(){}
+void SemanticModelTester::case0609(){}
+
+void SemanticModelTester::case0650()
+{
+    auto [varAndOrFunDecl, semaModel] =
+            declAndSemaModel<VariableAndOrFunctionDeclarationSyntax>("int x ; double y ;");
+
+    auto identDecltor = varAndOrFunDecl->declarators()->value->asIdentifierDeclarator();
+    const Symbol* sym = semaModel->declaredSymbol(identDecltor);
+    PSY_EXPECT_TRUE(sym);
+
+    const Assembly* assembly = semaModel->compilation()->assembly();
+    PSY_EXPECT_EQ_PTR(sym->owningAssembly(), assembly);
+    PSY_EXPECT_TRUE(assembly->symbolCount() > 1);
+    PSY_EXPECT_EQ_PTR(assembly->symbolAt(assembly->symbolCount()), (const Symbol*)nullptr);
+
+    const auto& xSyms = assembly->searchForSymbols("x", NameSpaceKind::Ordinary, SymbolKind::Value);
+    PSY_EXPECT_EQ_INT(xSyms.size(), 1u);
+    PSY_EXPECT_EQ_PTR(xSyms[0], sym);
+
+    PSY_EXPECT_TRUE(assembly->searchForSymbols("x", NameSpaceKind::Tags, SymbolKind::Value).empty());
+    PSY_EXPECT_TRUE(assembly->searchForSymbols("x", NameSpaceKind::Ordinary, SymbolKind::Function).empty());
+    PSY_EXPECT_TRUE(assembly->searchForSymbols("z", NameSpaceKind::Ordinary, SymbolKind::Value).empty());
+    PSY_EXPECT_EQ_INT(assembly->searchForSymbols("y", NameSpaceKind::Ordinary, SymbolKind::Value).size(), 1u);
+}
+
+void SemanticModelTester::case0651()
+{
+    auto [tyDecl, semaModel] =
+            declAndSemaModel<StructOrUnionDeclarationSyntax>("struct x { int x ; } ;");
+
+    const NamedTypeSymbol* namedTySym = semaModel->declaredSymbol(tyDecl);
+    PSY_EXPECT_TRUE(namedTySym);
+
+    const Assembly* assembly = semaModel->compilation()->assembly();
+    const auto& tagSyms = assembly->searchForSymbols("x", NameSpaceKind::Tags, SymbolKind::Type);
+    PSY_EXPECT_EQ_INT(tagSyms.size(), 1u);
+    PSY_EXPECT_EQ_PTR(tagSyms[0], namedTySym);
+
+    const auto& fldSyms = assembly->searchForSymbols("x", NameSpaceKind::Members, SymbolKind::Value);
+    PSY_EXPECT_EQ_INT(fldSyms.size(), 1u);
+    PSY_EXPECT_TRUE(fldSyms[0]->asValue());
+    PSY_EXPECT_TRUE(fldSyms[0]->asValue()->asField());
+    PSY_EXPECT_EQ_PTR(fldSyms[0]->owningAssembly(), assembly);
+
+    PSY_EXPECT_TRUE(assembly->searchForSymbols("x", NameSpaceKind::Ordinary, SymbolKind::Value).empty());
+}
+
+void SemanticModelTester::case0652()
+{
+    auto [funcDef, semaModel] =
+            declAndSemaModel<FunctionDefinitionSyntax>("void x ( int y ) { { int y ; } }");
+
+    const FunctionSymbol* funcSym = semaModel->declaredSymbol(funcDef);
+    PSY_EXPECT_TRUE(funcSym);
+
+    const Assembly* assembly = semaModel->compilation()->assembly();
+    const auto& funcSyms = assembly->searchForSymbols("x", NameSpaceKind::Ordinary, SymbolKind::Function);
+    PSY_EXPECT_EQ_INT(funcSyms.size(), 1u);
+    PSY_EXPECT_EQ_PTR(funcSyms[0], funcSym);
+
+    // The parameter and the local variable.
+    const auto& ySyms = assembly->searchForSymbols("y", NameSpaceKind::Ordinary, SymbolKind::Value);
+    PSY_EXPECT_EQ_INT(ySyms.size(), 2u);
+    PSY_EXPECT_TRUE(ySyms[0] != ySyms[1]);
+}
+
+void SemanticModelTester::case0653()
+{
+    std::vector<std::unique_ptr<SyntaxTree>> trees;
+    for (auto src : { "int x ; struct s { int f ; } ;",
+                      "void x ( int p ) { }",
+                      "enum e { x } ;",
+                      "double y , * x ;" }) {
+        trees.push_back(SyntaxTree::parseText(SourceText(src),
+                                              TextPreprocessingState::Preprocessed,
+                                              TextCompleteness::Fragment,
+                                              ParseOptions(),
+                                              "<test>"));
+    }
+
+    auto serial = Compilation::create("serial");
+    auto parallel = Compilation::create("parallel");
+    for (const auto& tree : trees) {
+        serial->addSyntaxTree(tree.get());
+        parallel->addSyntaxTree(tree.get());
+    }
+    for (const auto& tree : trees)
+        PSY_EXPECT_TRUE(serial->semanticModel(tree.get()));
+    parallel->computeAllSemanticModels(3);
+
+    auto serialAssembly = static_cast<const Compilation*>(serial.get())->assembly();
+    auto parallelAssembly = static_cast<const Compilation*>(parallel.get())->assembly();
+    PSY_EXPECT_EQ_INT(parallelAssembly->symbolCount(), serialAssembly->symbolCount());
+    for (auto i = 0u; i < serialAssembly->symbolCount(); ++i) {
+        PSY_EXPECT_EQ_STR(to_string(*parallelAssembly->symbolAt(i)),
+                          to_string(*serialAssembly->symbolAt(i)));
+        PSY_EXPECT_EQ_PTR(parallelAssembly->symbolAt(i)->owningAssembly(), parallelAssembly);
+    }
+
+    const auto& xSyms = parallelAssembly->searchForSymbols("x", NameSpaceKind::Ordinary, SymbolKind::Value);
+    PSY_EXPECT_EQ_INT(xSyms.size(), 3u);
+    PSY_EXPECT_EQ_INT(parallel->syntaxTrees().size(), trees.size());
+    PSY_EXPECT_EQ_PTR(parallel->syntaxTrees()[1], trees[1].get());
+
+    for (const auto& tree : trees) {
+        auto semaModel = parallel->semanticModel(tree.get());
+        PSY_EXPECT_TRUE(semaModel);
+        PSY_EXPECT_EQ_PTR(semaModel->syntaxTree(), tree.get());
+    }
+}
+void SemanticModelTester::case0654(){}
+void SemanticModelTester::case0655(){}
+void SemanticModelTester::case0656(){}
+void SemanticModelTester::case0657(){}
+void SemanticModelTester::case0658(){}
+void SemanticModelTester::case0659(){}
+
+namespace {
+
+std::unique_ptr<SyntaxTree> parseFragment(const std::string& src)
+{
+    return SyntaxTree::parseText(SourceText(src),
+                                 TextPreprocessingState::Preprocessed,
+                                 TextCompleteness::Fragment,
+                                 ParseOptions(),
+                                 "<test>");
+}
+
+const DeclarationSyntax* externalDeclarationAt(const SyntaxTree* tree, unsigned int idx)
+{
+    auto declIt = tree->translationUnitRoot()->declarations();
+    while (idx--)
+        declIt = declIt->next;
+    return declIt->value;
+}
+
+const IdentifierDeclaratorSyntax* firstDeclaratorOf(const DeclarationSyntax* decl)
+{
+    if (auto funcDef = decl->asFunctionDefinition())
+        return SyntaxUtilities::innermostDeclaratorOrSelf(funcDef->declarator())->asIdentifierDeclarator();
+    return decl->asVariableAndOrFunctionDeclaration()->declarators()->value->asIdentifierDeclarator();
+}
+
+} // anonymous
+
+void SemanticModelTester::case0660()
+{
+    auto oldTree = parseFragment("int x ; double y ; void z ( int w ) { }");
+    auto newTree = parseFragment("int x ; float y ; void z ( int w ) { }");
+    auto compilation = Compilation::create("replace");
+    compilation->addSyntaxTree(oldTree.get());
+    auto oldSemaModel = compilation->semanticModel(oldTree.get());
+
+    auto xSym = oldSemaModel->declaredSymbol(firstDeclaratorOf(externalDeclarationAt(oldTree.get(), 0)));
+    auto ySym = oldSemaModel->declaredSymbol(firstDeclaratorOf(externalDeclarationAt(oldTree.get(), 1)));
+    auto zSym = oldSemaModel->declaredSymbol(firstDeclaratorOf(externalDeclarationAt(oldTree.get(), 2)));
+    PSY_EXPECT_TRUE(xSym && ySym && zSym);
+    const Assembly* assembly = static_cast<const Compilation*>(compilation.get())->assembly();
+    auto symCnt = assembly->symbolCount();
+
+    compilation->replaceSyntaxTree(oldTree.get(), newTree.get());
+    oldTree.reset();
+
+    PSY_EXPECT_EQ_INT(compilation->syntaxTrees().size(), 1u);
+    PSY_EXPECT_EQ_PTR(compilation->syntaxTrees()[0], newTree.get());
+    auto semaModel = compilation->semanticModel(newTree.get());
+    PSY_EXPECT_EQ_PTR(semaModel->syntaxTree(), newTree.get());
+
+    // The unchanged declarations keep their symbols.
+    auto xDecltor = firstDeclaratorOf(externalDeclarationAt(newTree.get(), 0));
+    auto zDecltor = firstDeclaratorOf(externalDeclarationAt(newTree.get(), 2));
+    PSY_EXPECT_EQ_PTR(semaModel->declaredSymbol(xDecltor), xSym);
+    PSY_EXPECT_EQ_PTR(semaModel->declaredSymbol(zDecltor), zSym);
+
+    // The changed one is bound anew, and the stale symbol is evicted.
+    auto yDecltor = firstDeclaratorOf(externalDeclarationAt(newTree.get(), 1));
+    auto newYSym = semaModel->declaredSymbol(yDecltor);
+    PSY_EXPECT_TRUE(newYSym);
+    PSY_EXPECT_TRUE(newYSym != ySym);
+    PSY_EXPECT_TRUE(ySym->owningAssembly() == nullptr);
+
+    PSY_EXPECT_EQ_INT(assembly->symbolCount(), symCnt);
+    const auto& ySyms = assembly->searchForSymbols("y", NameSpaceKind::Ordinary, SymbolKind::Value);
+    PSY_EXPECT_EQ_INT(ySyms.size(), 1u);
+    PSY_EXPECT_EQ_PTR(ySyms[0], newYSym);
+
+    // The file scope is keyed by the identifiers of the new tree.
+    const Scope* scope = xSym->scope();
+    auto xIdent = xDecltor->identifierToken().valueLexeme()->asIdentifier();
+    auto yIdent = yDecltor->identifierToken().valueLexeme()->asIdentifier();
+    PSY_EXPECT_EQ_PTR(scope->searchForSymbol(xIdent, NameSpaceKind::Ordinary), xSym);
+    PSY_EXPECT_EQ_PTR(scope->searchForSymbol(yIdent, NameSpaceKind::Ordinary), newYSym);
+    PSY_EXPECT_EQ_PTR(newYSym->scope(), scope);
+}
+
+void SemanticModelTester::case0661()
+{
+    auto oldTree = parseFragment("int x ; void y ( ) { int z ; } double w ;");
+    auto newTree = parseFragment("double w ; void y ( ) { int z ; }");
+    auto compilation = Compilation::create("replace");
+    compilation->addSyntaxTree(oldTree.get());
+    compilation->semanticModel(oldTree.get());
+    const Assembly* assembly = static_cast<const Compilation*>(compilation.get())->assembly();
+    auto symCnt = assembly->symbolCount();
+
+    // A declaration is removed and another one is moved.
+    compilation->replaceSyntaxTree(oldTree.get(), newTree.get());
+    oldTree.reset();
+
+    auto semaModel = compilation->semanticModel(newTree.get());
+    PSY_EXPECT_TRUE(assembly->searchForSymbols("x", NameSpaceKind::Ordinary, SymbolKind::Value).empty());
+    PSY_EXPECT_EQ_INT(assembly->searchForSymbols("w", NameSpaceKind::Ordinary, SymbolKind::Value).size(), 1u);
+    PSY_EXPECT_EQ_INT(assembly->searchForSymbols("z", NameSpaceKind::Ordinary, SymbolKind::Value).size(), 1u);
+    PSY_EXPECT_TRUE(assembly->symbolCount() < symCnt);
+
+    auto funcDef = externalDeclarationAt(newTree.get(), 1)->asFunctionDefinition();
+    auto funcSym = semaModel->declaredSymbol(funcDef);
+    PSY_EXPECT_TRUE(funcSym);
+    PSY_EXPECT_EQ_PTR(assembly->searchForSymbols("y", NameSpaceKind::Ordinary, SymbolKind::Function)[0],
+                      funcSym);
+
+    // The local variable is found, from its (carried over) block scope,
+    // through the identifier of the new tree.
+    auto body = funcDef->body()->asCompoundStatement();
+    auto varDecl = body->statements()->value->asDeclarationStatement()->declaration()
+            ->asVariableAndOrFunctionDeclaration();
+    auto zDecltor = varDecl->declarators()->value->asIdentifierDeclarator();
+    auto zSym = semaModel->declaredSymbol(zDecltor);
+    PSY_EXPECT_TRUE(zSym);
+    auto zIdent = zDecltor->identifierToken().valueLexeme()->asIdentifier();
+    PSY_EXPECT_EQ_PTR(zSym->scope()->searchForSymbol(zIdent, NameSpaceKind::Ordinary), zSym);
+    PSY_EXPECT_EQ_PTR(zSym->scope()->outerScope(), funcSym->scope());
+
+    auto wSym = semaModel->declaredSymbol(firstDeclaratorOf(externalDeclarationAt(newTree.get(), 0)));
+    PSY_EXPECT_EQ_PTR(wSym->scope(), funcSym->scope());
+}
+
+void SemanticModelTester::case0662()
+{
+    auto oldTree = parseFragment("int x ( int y ) { int z ; return y ; } int w ;");
+    auto newTree = parseFragment("int x ( int y ) { int z ; return y ; } int v ;");
+    auto compilation = Compilation::create("replace");
+    compilation->setTreatmentOfFunctionBodies(Compilation::TreatmentOfFunctionBodies::BindOnDemand);
+    compilation->addSyntaxTree(oldTree.get());
+    compilation->semanticModel(oldTree.get());
+    const Assembly* assembly = static_cast<const Compilation*>(compilation.get())->assembly();
+    PSY_EXPECT_TRUE(assembly->searchForSymbols("z", NameSpaceKind::Ordinary, SymbolKind::Value).empty());
+
+    compilation->replaceSyntaxTree(oldTree.get(), newTree.get());
+    oldTree.reset();
+
+    // The (still deferred) body of the carried over function is bound on demand.
+    auto semaModel = compilation->semanticModel(newTree.get());
+    auto funcDef = externalDeclarationAt(newTree.get(), 0)->asFunctionDefinition();
+    auto varDecl = funcDef->body()->asCompoundStatement()->statements()->value
+            ->asDeclarationStatement()->declaration()->asVariableAndOrFunctionDeclaration();
+    auto zSym = semaModel->declaredSymbol(varDecl->declarators()->value);
+    PSY_EXPECT_TRUE(zSym);
+    PSY_EXPECT_EQ_PTR(zSym->owningAssembly(), assembly);
+    PSY_EXPECT_TRUE(assembly->searchForSymbols("w", NameSpaceKind::Ordinary, SymbolKind::Value).empty());
+    PSY_EXPECT_EQ_INT(assembly->searchForSymbols("v", NameSpaceKind::Ordinary, SymbolKind::Value).size(), 1u);
+}
+
+void SemanticModelTester::case0663(){}
+void SemanticModelTester::case0664(){}
+void SemanticModelTester::case0665(){}
+void SemanticModelTester::case0666(){}
+void SemanticModelTester::case0667(){}
+void SemanticModelTester::case0668(){}
+void SemanticModelTester::case0669(){}
+
+void SemanticModelTester::case0670()
+{
+    auto [varAndOrFunDecl, semaModel] =
+            declAndSemaModel<VariableAndOrFunctionDeclarationSyntax>("int * x , * y , z ;");
+
+    auto syms = semaModel->declaredSymbols(varAndOrFunDecl);
+    PSY_EXPECT_EQ_INT(syms.size(), 3u);
+
+    auto xTySym = syms[0]->asValue()->type();
+    auto yTySym = syms[1]->asValue()->type();
+    auto zTySym = syms[2]->asValue()->type();
+    PSY_EXPECT_EQ_ENU(xTySym->typeKind(), TypeKind::Pointer, TypeKind);
+    PSY_EXPECT_EQ_PTR(xTySym, yTySym);
+    PSY_EXPECT_EQ_PTR(xTySym->asPointerType()->referencedType(), zTySym);
+}
+
+void SemanticModelTester::case0671()
+{
+    auto [funcDecl, semaModel] =
+            declAndSemaModel<VariableAndOrFunctionDeclarationSyntax>(
+                "void f ( int * p , const int * q ) ; int * a ; const int * b ; int * const c ;");
+
+    const Assembly* assembly = semaModel->compilation()->assembly();
+    auto typeOf = [assembly] (const char* name) {
+        const auto& syms = assembly->searchForSymbols(name, NameSpaceKind::Ordinary, SymbolKind::Value);
+        PSY_EXPECT_EQ_INT(syms.size(), 1u);
+        return syms[0]->asValue()->type();
+    };
+
+    const auto& fSyms = assembly->searchForSymbols("f", NameSpaceKind::Ordinary, SymbolKind::Function);
+    PSY_EXPECT_EQ_INT(fSyms.size(), 1u);
+    auto funcTySym = fSyms[0]->asFunction()->type()->asFunctionType();
+    PSY_EXPECT_TRUE(funcTySym);
+    PSY_EXPECT_EQ_INT(funcTySym->parameterTypes().size(), 2u);
+
+    PSY_EXPECT_EQ_PTR(funcTySym->parameterTypes()[0], typeOf("p"));
+    PSY_EXPECT_EQ_PTR(funcTySym->parameterTypes()[1], typeOf("q"));
+    PSY_EXPECT_EQ_PTR(typeOf("p"), typeOf("a"));
+    PSY_EXPECT_EQ_PTR(typeOf("q"), typeOf("b"));
+
+    // Qualifiers are part of a type's identity.
+    PSY_EXPECT_TRUE(typeOf("a") != typeOf("b"));
+    PSY_EXPECT_TRUE(typeOf("a") != typeOf("c"));
+    PSY_EXPECT_TRUE(typeOf("c")->isConstQualified());
+    PSY_EXPECT_EQ_PTR(typeOf("a")->asPointerType()->referencedType(),
+                      typeOf("c")->asPointerType()->referencedType());
+}
+
+void SemanticModelTester::case0672()
+{
+    std::vector<std::unique_ptr<SyntaxTree>> trees;
+    for (auto src : { "double * x ; struct s * y ;",
+                      "double * z ; struct s * w ; union s * v ;" }) {
+        trees.push_back(SyntaxTree::parseText(SourceText(src),
+                                              TextPreprocessingState::Preprocessed,
+                                              TextCompleteness::Fragment,
+                                              ParseOptions(),
+                                              "<test>"));
+    }
+
+    auto compilation = Compilation::create("types");
+    for (const auto& tree : trees)
+        compilation->addSyntaxTree(tree.get());
+    compilation->computeAllSemanticModels(2);
+
+    const Assembly* assembly = static_cast<const Compilation*>(compilation.get())->assembly();
+    auto typeOf = [assembly] (const char* name) {
+        const auto& syms = assembly->searchForSymbols(name, NameSpaceKind::Ordinary, SymbolKind::Value);
+        PSY_EXPECT_EQ_INT(syms.size(), 1u);
+        return syms[0]->asValue()->type();
+    };
+
+    PSY_EXPECT_EQ_PTR(typeOf("x"), typeOf("z"));
+    // A tag type is that of the scope in which its tag is declared.
+    PSY_EXPECT_TRUE(typeOf("y") != typeOf("w"));
+    PSY_EXPECT_TRUE(typeOf("w") != typeOf("v"));
+    PSY_EXPECT_EQ_PTR(typeOf("x")->owningAssembly(), assembly);
+}
+
+void SemanticModelTester::case0673(){}
+void SemanticModelTester::case0674(){}
+void SemanticModelTester::case0675(){}
+void SemanticModelTester::case0676(){}
+void SemanticModelTester::case0677(){}
+void SemanticModelTester::case0678(){}
+void SemanticModelTester::case0679(){}
+
+namespace {
+
+void expectBuiltinType(const TypeSymbol* tySym, BuiltinTypeKind builtTyK)
+{
+    PSY_EXPECT_TRUE(tySym);
+    PSY_EXPECT_EQ_ENU(tySym->typeKind(), TypeKind::Named, TypeKind);
+    PSY_EXPECT_EQ_ENU(tySym->asNamedType()->namedTypeKind(), NamedTypeKind::Builtin, NamedTypeKind);
+    PSY_EXPECT_EQ_ENU(tySym->asNamedType()->builtinTypeKind(), builtTyK, BuiltinTypeKind);
+}
+
+} // anonymous
+
+void SemanticModelTester::case0700()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("void f ( ) { char c ; short s ; c + s ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Int);
+}
+
+void SemanticModelTester::case0701()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("void f ( ) { unsigned u ; long l ; u + l ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Long);
+}
+
+void SemanticModelTester::case0702()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("void f ( ) { long unsigned u ; int i ; u * i ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Long_U);
+}
+
+void SemanticModelTester::case0703()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("void f ( ) { long l ; float x ; l / x ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Float);
+}
+
+void SemanticModelTester::case0704()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("void f ( ) { int * p ; p + 1 ; }");
+
+    auto tySym = semaModel->typeOf(expr);
+    PSY_EXPECT_TRUE(tySym);
+    PSY_EXPECT_EQ_ENU(tySym->typeKind(), TypeKind::Pointer, TypeKind);
+    expectBuiltinType(tySym->asPointerType()->referencedType(), BuiltinTypeKind::Int);
+
+    auto addExpr = expr->asBinaryExpression();
+    PSY_EXPECT_EQ_PTR(semaModel->typeOf(addExpr->left()), tySym);
+    expectBuiltinType(semaModel->typeOf(addExpr->right()), BuiltinTypeKind::Int);
+}
+
+void SemanticModelTester::case0705()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("void f ( ) { double a [ 4 ] ; double * p ; p - a ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Long);
+
+    auto subExpr = expr->asBinaryExpression();
+    auto tySym = semaModel->typeOf(subExpr->right());
+    PSY_EXPECT_TRUE(tySym);
+    PSY_EXPECT_EQ_ENU(tySym->typeKind(), TypeKind::Array, TypeKind);
+}
+
+void SemanticModelTester::case0706()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("void f ( ) { short a [ 4 ] ; a [ 1 ] ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Short);
+}
+
+void SemanticModelTester::case0707()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("struct s { int x ; double y ; } ; void f ( ) { struct s v ; v . y ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Double);
+}
+
+void SemanticModelTester::case0708()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("struct s { int x ; double y ; } ; void f ( struct s * p ) { p -> x ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Int);
+}
+
+void SemanticModelTester::case0709()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("double g ( int ) ; void f ( ) { g ( 1 ) ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Double);
+}
+
+void SemanticModelTester::case0710()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("struct s { int x ; } ; void f ( ) { struct s v ; v + 1 ; }");
+
+    PSY_EXPECT_EQ_PTR(semaModel->typeOf(expr), nullptr);
+
+    auto diags = semaModel->syntaxTree()->diagnostics();
+    PSY_EXPECT_EQ_INT(diags.size(), 1u);
+    PSY_EXPECT_EQ_STR(diags[0].descriptor().id(), "TypeChecker-001");
+}
+
+void SemanticModelTester::case0711()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("int g ( int , int ) ; void f ( ) { g ( 1 ) ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Int);
+
+    auto diags = semaModel->syntaxTree()->diagnostics();
+    PSY_EXPECT_EQ_INT(diags.size(), 1u);
+    PSY_EXPECT_EQ_STR(diags[0].descriptor().id(), "TypeChecker-005");
+}
+
+void SemanticModelTester::case0712()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("void f ( ) { 1UL ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Long_U);
+}
+
+void SemanticModelTester::case0713()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("typedef long T ; void f ( ) { T t ; int i ; t + i ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Long);
+}
+
+void SemanticModelTester::case0714()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("int x ; void f ( ) { double x ; x ; }");
+
+    // The local declaration hides that of the file scope.
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Double);
+}
+
+void SemanticModelTester::case0715()
+{
+    auto tree = parseFragment("int f ( ) { long x ; x ; }");
+    auto compilation = Compilation::create("on-demand");
+    compilation->setTreatmentOfFunctionBodies(Compilation::TreatmentOfFunctionBodies::BindOnDemand);
+    compilation->addSyntaxTree(tree.get());
+    auto semaModel = compilation->semanticModel(tree.get());
+
+    auto funcDef = externalDeclarationAt(tree.get(), 0)->asFunctionDefinition();
+    auto stmts = funcDef->body()->asCompoundStatement()->statements();
+    auto expr = stmts->next->value->asExpressionStatement()->expression();
+
+    // The body is bound (and type checked) on demand; the type is computed once.
+    auto tySym = semaModel->typeOf(expr);
+    expectBuiltinType(tySym, BuiltinTypeKind::Long);
+    PSY_EXPECT_EQ_PTR(semaModel->typeOf(expr), tySym);
+
+    auto xSym = semaModel->declaredSymbol(
+                stmts->value->asDeclarationStatement()->declaration()
+                    ->asVariableAndOrFunctionDeclaration()->declarators()->value);
+    PSY_EXPECT_TRUE(xSym);
+    PSY_EXPECT_EQ_PTR(xSym->asValue()->type(), tySym);
+}
+
+void SemanticModelTester::case0716()
+{
+    auto oldTree = parseFragment("int y ; void f ( ) { y ; }");
+    auto newTree = parseFragment("double y ; void f ( ) { y ; }");
+    auto compilation = Compilation::create("replace");
+    compilation->addSyntaxTree(oldTree.get());
+    compilation->semanticModel(oldTree.get());
+
+    compilation->replaceSyntaxTree(oldTree.get(), newTree.get());
+    oldTree.reset();
+
+    // The function is carried over, but the type of its expression is that of the new `y'.
+    auto semaModel = compilation->semanticModel(newTree.get());
+    auto funcDef = externalDeclarationAt(newTree.get(), 1)->asFunctionDefinition();
+    auto expr = funcDef->body()->asCompoundStatement()->statements()->value
+            ->asExpressionStatement()->expression();
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Double);
+}
+
+void SemanticModelTester::case0717()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("void f ( ) { const int * p ; * p ; }");
+
+    auto tySym = semaModel->typeOf(expr);
+    expectBuiltinType(tySym, BuiltinTypeKind::Int);
+    PSY_EXPECT_TRUE(tySym->isConstQualified());
+}
+
+void SemanticModelTester::case0718()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("void f ( ) { int i ; ( unsigned char ) i << 2 ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Int);
+
+    auto shiftExpr = expr->asBinaryExpression();
+    expectBuiltinType(semaModel->typeOf(shiftExpr->left()), BuiltinTypeKind::Char_U);
+}
+
+void SemanticModelTester::case0719()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("struct s { int x ; } ; "
+                             "void f ( ) { struct s { double x ; } v ; } "
+                             "void g ( ) { struct s v ; v . x ; }");
+
+    // The structure of the block scope is another type than that of the file scope.
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Int);
+}
+
+void SemanticModelTester::case0720()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("struct s { int x ; } ; "
+                             "void f ( ) { struct s { double x ; } v ; v . x ; }");
+
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Double);
+}
+
+void SemanticModelTester::case0721()
+{
+    auto [expr, semaModel] =
+            exprAndSemaModel("typedef int T ; T * p ; void f ( ) { int * q ; 1 ? p : q ; }");
+
+    // A synonym is the type that it designates.
+    auto condExpr = expr->asConditionalExpression();
+    PSY_EXPECT_EQ_PTR(semaModel->typeOf(condExpr->whenTrue()),
+                      semaModel->typeOf(condExpr->whenFalse()));
+
+    auto tySym = semaModel->typeOf(expr);
+    PSY_EXPECT_TRUE(tySym && tySym->asPointerType());
+    expectBuiltinType(tySym->asPointerType()->referencedType(), BuiltinTypeKind::Int);
+}
+
+void SemanticModelTester::case0722()
+{
+    auto oldTree = parseFragment("struct s { int x ; } ; void f ( ) { struct s v ; v . x ; }");
+    auto newTree = parseFragment("struct s { double x ; } ; void f ( ) { struct s v ; v . x ; }");
+    auto compilation = Compilation::create("replace");
+    compilation->addSyntaxTree(oldTree.get());
+    compilation->semanticModel(oldTree.get());
+
+    compilation->replaceSyntaxTree(oldTree.get(), newTree.get());
+    oldTree.reset();
+
+    // The members are those of the definition that replaces the previous one.
+    auto semaModel = compilation->semanticModel(newTree.get());
+    auto funcDef = externalDeclarationAt(newTree.get(), 1)->asFunctionDefinition();
+    auto expr = funcDef->body()->asCompoundStatement()->statements()->next->value
+            ->asExpressionStatement()->expression();
+    expectBuiltinType(semaModel->typeOf(expr), BuiltinTypeKind::Double);
+}
+
+void SemanticModelTester::case0723()
+{
+    auto tree = parseFragment("int f ( ) { long x ; x ; } "
+                              "int g ( ) { double x ; x ; } "
+                              "int h ( ) { char x ; x ; }");
+    auto compilation = Compilation::create("on-demand");
+    compilation->setTreatmentOfFunctionBodies(Compilation::TreatmentOfFunctionBodies::BindOnDemand);
+    compilation->addSyntaxTree(tree.get());
+    auto semaModel = compilation->semanticModel(tree.get());
+
+    auto exprAt = [&tree] (unsigned int idx) {
+        auto funcDef = externalDeclarationAt(tree.get(), idx)->asFunctionDefinition();
+        auto stmts = funcDef->body()->asCompoundStatement()->statements();
+        return stmts->next->value->asExpressionStatement()->expression();
+    };
+
+    // The bodies are bound on demand by concurrent queries.
+    const TypeSymbol* tySyms[4][3] = {};
+    std::vector<std::thread> threads;
+    for (auto i = 0u; i < 4; ++i) {
+        threads.emplace_back([&, i] () {
+            for (auto j = 0u; j < 3; ++j)
+                tySyms[i][(i + j) % 3] = semaModel->typeOf(exprAt((i + j) % 3));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto i = 0u; i < 4; ++i) {
+        expectBuiltinType(tySyms[i][0], BuiltinTypeKind::Long);
+        expectBuiltinType(tySyms[i][1], BuiltinTypeKind::Double);
+        expectBuiltinType(tySyms[i][2], BuiltinTypeKind::Char);
+    }
+}
+
+void SemanticModelTester::case0724()
+{
+    auto tree = parseFragment("long g ; struct s { int x ; } ; void f ( ) { struct s v ; v . x ; g ; }");
+    auto compilation = Compilation::create("replace");
+    compilation->addSyntaxTree(tree.get());
+    compilation->semanticModel(tree.get());
+
+    // The arenas (and the evicted symbols in them) are released along the way.
+    for (auto i = 0u; i < 40; ++i) {
+        auto newTree = parseFragment(i % 2
+                ? "long g ; struct s { int x ; } ; void f ( ) { struct s v ; v . x ; g ; }"
+                : "char g ; struct s { int x ; } ; void f ( ) { struct s v ; v . x ; g ; }");
+        compilation->replaceSyntaxTree(tree.get(), newTree.get());
+        tree = std::move(newTree);
+
+        auto semaModel = compilation->semanticModel(tree.get());
+        auto funcDef = externalDeclarationAt(tree.get(), 2)->asFunctionDefinition();
+        auto stmts = funcDef->body()->asCompoundStatement()->statements();
+        expectBuiltinType(semaModel->typeOf(stmts->next->value->asExpressionStatement()->expression()),
+                          BuiltinTypeKind::Int);
+        expectBuiltinType(semaModel->typeOf(stmts->next->next->value->asExpressionStatement()->expression()),
+                          i % 2 ? BuiltinTypeKind::Long : BuiltinTypeKind::Char);
+    }
+}
+
+void SemanticModelTester::case0725()
+{
+    auto tree = parseFragment("typedef int T ; void f ( ) { T a ; { float T ; a + 1 ; } }");
+    auto compilation = Compilation::create("shadow");
+    compilation->addSyntaxTree(tree.get());
+    auto semaModel = compilation->semanticModel(tree.get());
+
+    // The synonym is that of the declaration, not the name shadowing it at the use.
+    auto funcDef = externalDeclarationAt(tree.get(), 1)->asFunctionDefinition();
+    auto stmts = funcDef->body()->asCompoundStatement()->statements();
+    auto blockStmts = stmts->next->value->asCompoundStatement()->statements();
+    expectBuiltinType(semaModel->typeOf(blockStmts->next->value->asExpressionStatement()->expression()),
+                      BuiltinTypeKind::Int);
+}
@@ -53,6 +53,7 @@ public:
 
     template <class DeclT>
     std::tuple<const DeclT*,const SemanticModel*> declAndSemaModel(const std::string& s);
+    std::tuple<const ExpressionSyntax*,const SemanticModel*> exprAndSemaModel(const std::string& s);
 
     void testSemanticModel();
 
@@ -69,6 +70,11 @@ public:
         + 0400-0449 -> enum
         + 0450-0499 -> enumerator
         + 0500-0509 -> library
+        + 0600-0649 -> scope/name space
+        + 0650-0659 -> assembly
+        + 0660-0669 -> replacement of syntax tree
+        + 0670-0679 -> type identity
+        + 0700-0749 -> type of expression
      */
 
     void case0001();
@@ -349,6 +355,76 @@ public:
     void case0508();
     void case0509();
 
+    void case0600();
+    void case0601();
+    void case0602();
+    void case0603();
+    void case0604();
+    void case0605();
+    void case0606();
+    void case0607();
+    void case0608();
+    void case0609();
+
+    void case0650();
+    void case0651();
+    void case0652();
+    void case0653();
+    void case0654();
+    void case0655();
+    void case0656();
+    void case0657();
+    void case0658();
+    void case0659();
+
+    void case0660();
+    void case0661();
+    void case0662();
+    void case0663();
+    void case0664();
+    void case0665();
+    void case0666();
+    void case0667();
+    void case0668();
+    void case0669();
+    void case0670();
+    void case0671();
+    void case0672();
+    void case0673();
+    void case0674();
+    void case0675();
+    void case0676();
+    void case0677();
+    void case0678();
+    void case0679();
+
+    void case0700();
+    void case0701();
+    void case0702();
+    void case0703();
+    void case0704();
+    void case0705();
+    void case0706();
+    void case0707();
+    void case0708();
+    void case0709();
+    void case0710();
+    void case0711();
+    void case0712();
+    void case0713();
+    void case0714();
+    void case0715();
+    void case0716();
+    void case0717();
+    void case0718();
+    void case0719();
+    void case0720();
+    void case0721();
+    void case0722();
+    void case0723();
+    void case0724();
+    void case0725();
+
     std::vector<TestFunction> tests_
     {
         TEST_SEMANTIC_MODEL(case0001),
@@ -628,6 +704,77 @@ public:
         TEST_SEMANTIC_MODEL(case0507),
         TEST_SEMANTIC_MODEL(case0508),
         TEST_SEMANTIC_MODEL(case0509),
+
+        TEST_SEMANTIC_MODEL(case0600),
+        TEST_SEMANTIC_MODEL(case0601),
+        TEST_SEMANTIC_MODEL(case0602),
+        TEST_SEMANTIC_MODEL(case0603),
+        TEST_SEMANTIC_MODEL(case0604),
+        TEST_SEMANTIC_MODEL(case0605),
+        TEST_SEMANTIC_MODEL(case0606),
+        TEST_SEMANTIC_MODEL(case0607),
+        TEST_SEMANTIC_MODEL(case0608),
+        TEST_SEMANTIC_MODEL(case0609),
+
+        TEST_SEMANTIC_MODEL(case0650),
+        TEST_SEMANTIC_MODEL(case0651),
+        TEST_SEMANTIC_MODEL(case0652),
+        TEST_SEMANTIC_MODEL(case0653),
+        TEST_SEMANTIC_MODEL(case0654),
+        TEST_SEMANTIC_MODEL(case0655),
+        TEST_SEMANTIC_MODEL(case0656),
+        TEST_SEMANTIC_MODEL(case0657),
+        TEST_SEMANTIC_MODEL(case0658),
+        TEST_SEMANTIC_MODEL(case0659),
+
+        TEST_SEMANTIC_MODEL(case0660),
+        TEST_SEMANTIC_MODEL(case0661),
+        TEST_SEMANTIC_MODEL(case0662),
+        TEST_SEMANTIC_MODEL(case0663),
+        TEST_SEMANTIC_MODEL(case0664),
+        TEST_SEMANTIC_MODEL(case0665),
+        TEST_SEMANTIC_MODEL(case0666),
+        TEST_SEMANTIC_MODEL(case0667),
+        TEST_SEMANTIC_MODEL(case0668),
+        TEST_SEMANTIC_MODEL(case0669),
+
+        TEST_SEMANTIC_MODEL(case0670),
+        TEST_SEMANTIC_MODEL(case0671),
+        TEST_SEMANTIC_MODEL(case0672),
+        TEST_SEMANTIC_MODEL(case0673),
+        TEST_SEMANTIC_MODEL(case0674),
+        TEST_SEMANTIC_MODEL(case0675),
+        TEST_SEMANTIC_MODEL(case0676),
+        TEST_SEMANTIC_MODEL(case0677),
+        TEST_SEMANTIC_MODEL(case0678),
+        TEST_SEMANTIC_MODEL(case0679),
+
+        TEST_SEMANTIC_MODEL(case0700),
+        TEST_SEMANTIC_MODEL(case0701),
+        TEST_SEMANTIC_MODEL(case0702),
+        TEST_SEMANTIC_MODEL(case0703),
+        TEST_SEMANTIC_MODEL(case0704),
+        TEST_SEMANTIC_MODEL(case0705),
+        TEST_SEMANTIC_MODEL(case0706),
+        TEST_SEMANTIC_MODEL(case0707),
+        TEST_SEMANTIC_MODEL(case0708),
+        TEST_SEMANTIC_MODEL(case0709),
+        TEST_SEMANTIC_MODEL(case0710),
+        TEST_SEMANTIC_MODEL(case0711),
+        TEST_SEMANTIC_MODEL(case0712),
+        TEST_SEMANTIC_MODEL(case0713),
+        TEST_SEMANTIC_MODEL(case0714),
+        TEST_SEMANTIC_MODEL(case0715),
+        TEST_SEMANTIC_MODEL(case0716),
+        TEST_SEMANTIC_MODEL(case0717),
+        TEST_SEMANTIC_MODEL(case0718),
+        TEST_SEMANTIC_MODEL(case0719),
+        TEST_SEMANTIC_MODEL(case0720),
+        TEST_SEMANTIC_MODEL(case0721),
+        TEST_SEMANTIC_MODEL(case0722),
+        TEST_SEMANTIC_MODEL(case0723),
+        TEST_SEMANTIC_MODEL(case0724),
+        TEST_SEMANTIC_MODEL(case0725),
     };
 };
 
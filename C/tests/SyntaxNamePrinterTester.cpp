@@ -0,0 +1,168 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "SyntaxNamePrinterTester.h"
+
+#include "SyntaxTree.h"
+#include "syntax/SyntaxNamePrinter.h"
+
+#include <sstream>
+#include <thread>
+
+using namespace psy;
+using namespace C;
+
+const std::string SyntaxNamePrinterTester::Name = "SYNTAX NAME PRINTER";
+
+void SyntaxNamePrinterTester::testSyntaxNamePrinter()
+{
+    return run<SyntaxNamePrinterTester>(tests_);
+}
+
+namespace {
+
+std::unique_ptr<SyntaxTree> parse(const std::string& src)
+{
+    return SyntaxTree::parseText(SourceText(src),
+                                 TextPreprocessingState::Preprocessed,
+                                 TextCompleteness::Fragment,
+                                 ParseOptions(),
+                                 "<test>");
+}
+
+std::string print(SyntaxTree* tree, SyntaxNamePrinter::Style style)
+{
+    std::ostringstream oss;
+    SyntaxNamePrinter printer(tree);
+    printer.print(tree->root(), style, oss);
+    return oss.str();
+}
+
+} // anonymous
+
+void SyntaxNamePrinterTester::case0001()
+{
+    std::vector<std::unique_ptr<SyntaxTree>> trees;
+    trees.push_back(parse("int x ;"));
+    trees.push_back(parse("struct s { int x ; struct { double y ; } z ; } ;"));
+    trees.push_back(parse("int f ( int a ) { if ( a ) { return a * 2 ; } return 0 ; }"));
+    trees.push_back(parse("void g ( ) { int * p ; p = 0 ; while ( p ) { p ++ ; } }"));
+
+    std::vector<std::string> expected;
+    for (const auto& tree : trees)
+        expected.push_back(print(tree.get(), SyntaxNamePrinter::Style::Decorated));
+
+    // Printers of different trees (e.g., of `cnip -j N -z') run concurrently.
+    std::vector<std::string> actual(trees.size() * 8);
+    std::vector<std::thread> threads;
+    for (auto i = 0U; i < actual.size(); ++i) {
+        threads.emplace_back([&, i] () {
+            actual[i] = print(trees[i % trees.size()].get(), SyntaxNamePrinter::Style::Decorated);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto i = 0U; i < actual.size(); ++i)
+        PSY_EXPECT_EQ_STR(actual[i], expected[i % trees.size()]);
+}
+
+void SyntaxNamePrinterTester::case0002()
+{
+    auto tree = parse("int f ( int a ) {\n"
+                      "    return a * 2\n"
+                      "        + f ( a ) ;\n"
+                      "}\n"
+                      "int very_long_name_of_a_variable = 1 + 2 ;\n");
+
+    /*
+     * The range of a node, and its snippet, end at the last token of the
+     * node (not at the first token of the node's last child).
+     */
+    auto expected =
+        "\n"
+        "TranslationUnit \n"
+        "|--FunctionDefinition  <1:0..4:55>  `int f ( int a ) { return a * 2...`\n"
+        "|  |--BuiltinTypeSpecifier  <1:0..1:2>  `int`\n"
+        "|  |--FunctionDeclarator  <1:4..1:14>  `f ( int a )`\n"
+        "|  |  |--IdentifierDeclarator  <1:4..1:4>  `f`\n"
+        "|  |  |--ParameterSuffix  <1:6..1:14>  `( int a )`\n"
+        "|  |     |--ParameterDeclaration  <1:8..1:12>  `int a`\n"
+        "|  |        |--BuiltinTypeSpecifier  <1:8..1:10>  `int`\n"
+        "|  |        |--IdentifierDeclarator  <1:12..1:12>  `a`\n"
+        "|  |--CompoundStatement  <1:16..4:55>  `{ return a * 2 + f ( a ) ; }`\n"
+        "|     |--ReturnStatement  <2:22..3:53>  `return a * 2 + f ( a ) ;`\n"
+        "|        |--AddExpression  <2:29..3:51>  `a * 2 + f ( a )`\n"
+        "|           |--MultipliyExpression  <2:29..2:33>  `a * 2`\n"
+        "|           |  |--IdentifierName  <2:29..2:29>  `a`\n"
+        "|           |  |--IntegerConstantExpression  <2:33..2:33>  `2`\n"
+        "|           |--CallExpression  <3:45..3:51>  `f ( a )`\n"
+        "|              |--IdentifierName  <3:45..3:45>  `f`\n"
+        "|              |--IdentifierName  <3:49..3:49>  `a`\n"
+        "|--VariableAndOrFunctionDeclaration  <5:57..5:98>  `int very_long_name_of_a_variab...`\n"
+        "   |--BuiltinTypeSpecifier  <5:57..5:59>  `int`\n"
+        "   |--IdentifierDeclarator  <5:61..5:96>  `very_long_name_of_a_variable =...`\n"
+        "      |--ExpressionInitializer  <5:92..5:96>  `1 + 2`\n"
+        "         |--AddExpression  <5:92..5:96>  `1 + 2`\n"
+        "            |--IntegerConstantExpression  <5:92..5:92>  `1`\n"
+        "            |--IntegerConstantExpression  <5:96..5:96>  `2`\n";
+
+    PSY_EXPECT_EQ_STR(print(tree.get(), SyntaxNamePrinter::Style::Decorated), std::string(expected));
+}
+
+void SyntaxNamePrinterTester::case0003()
+{
+    auto tree = parse("int f ( int a ) {\n"
+                      "    return a * 2\n"
+                      "        + f ( a ) ;\n"
+                      "}\n"
+                      "int very_long_name_of_a_variable = 1 + 2 ;\n");
+
+    auto expected =
+        "\n"
+        "TranslationUnit\n"
+        "    FunctionDefinition\n"
+        "        BuiltinTypeSpecifier\n"
+        "        FunctionDeclarator\n"
+        "            IdentifierDeclarator\n"
+        "            ParameterSuffix\n"
+        "                ParameterDeclaration\n"
+        "                    BuiltinTypeSpecifier\n"
+        "                    IdentifierDeclarator\n"
+        "        CompoundStatement\n"
+        "            ReturnStatement\n"
+        "                AddExpression\n"
+        "                    MultipliyExpression\n"
+        "                        IdentifierName\n"
+        "                        IntegerConstantExpression\n"
+        "                    CallExpression\n"
+        "                        IdentifierName\n"
+        "                        IdentifierName\n"
+        "    VariableAndOrFunctionDeclaration\n"
+        "        BuiltinTypeSpecifier\n"
+        "        IdentifierDeclarator\n"
+        "            ExpressionInitializer\n"
+        "                AddExpression\n"
+        "                    IntegerConstantExpression\n"
+        "                    IntegerConstantExpression\n";
+
+    PSY_EXPECT_EQ_STR(print(tree.get(), SyntaxNamePrinter::Style::Plain), std::string(expected));
+}
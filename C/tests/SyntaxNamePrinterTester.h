@@ -0,0 +1,63 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef PSYCHE_C_SYNTAX_NAME_PRINTER_TESTER_H__
+#define PSYCHE_C_SYNTAX_NAME_PRINTER_TESTER_H__
+
+#include "Fwds.h"
+#include "TestSuite_Internals.h"
+#include "tests/Tester.h"
+
+#define TEST_SYNTAX_NAME_PRINTER(Function) TestFunction { &SyntaxNamePrinterTester::Function, #Function }
+
+namespace psy {
+namespace C {
+
+class SyntaxNamePrinterTester final : public Tester
+{
+public:
+    SyntaxNamePrinterTester(TestSuite* suite)
+        : Tester(suite)
+    {}
+
+    static const std::string Name;
+    virtual std::string name() const override { return Name; }
+
+    void testSyntaxNamePrinter();
+
+    using TestFunction = std::pair<std::function<void(SyntaxNamePrinterTester*)>, const char*>;
+
+    void case0001();
+    void case0002();
+    void case0003();
+
+    std::vector<TestFunction> tests_
+    {
+        TEST_SYNTAX_NAME_PRINTER(case0001),
+        TEST_SYNTAX_NAME_PRINTER(case0002),
+        TEST_SYNTAX_NAME_PRINTER(case0003),
+    };
+};
+
+} // C
+} // psy
+
+#endif
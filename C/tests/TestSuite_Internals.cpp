@@ -26,13 +26,17 @@
 #include "symbols/Symbol.h"
 #include "parser/Unparser.h"
 #include "symbols/Symbol_ALL.h"
+#include "syntax/CompositeSyntaxVisitor.h"
+#include "syntax/ParallelSyntaxTraversal.h"
 #include "syntax/SyntaxLexeme_ALL.h"
 #include "syntax/SyntaxNamePrinter.h"
+#include "syntax/StaticSyntaxVisitor.h"
 #include "syntax/SyntaxNodes.h"
 
 #include "BinderTester.h"
 #include "ParserTester.h"
 #include "ReparserTester.h"
+#include "SyntaxNamePrinterTester.h"
 
 #include <algorithm>
 #include <cstring>
@@ -40,6 +44,7 @@
 #include <unordered_set>
 #include <string>
 #include <sstream>
+#include <stdexcept>
 
 //#define DUMP_AST
 #define DEBUG_DIAGNOSTICS
@@ -48,6 +53,199 @@
 using namespace psy;
 using namespace C;
 
+namespace {
+
+struct NodeCollector : SyntaxVisitor
+{
+    NodeCollector(const SyntaxTree* tree) : SyntaxVisitor(tree) {}
+
+    std::vector<const SyntaxNode*> nodes_;
+
+    bool preVisit(const SyntaxNode* node) override
+    {
+        nodes_.push_back(node);
+        return true;
+    }
+};
+
+struct StaticNodeCollector : StaticSyntaxVisitor<StaticNodeCollector>
+{
+    StaticNodeCollector(const SyntaxTree* tree) : StaticSyntaxVisitor(tree) {}
+
+    std::vector<const SyntaxNode*> nodes_;
+
+    bool preVisit(const SyntaxNode* node)
+    {
+        nodes_.push_back(node);
+        return true;
+    }
+};
+
+struct CompoundStatementSkipper : NodeCollector
+{
+    using NodeCollector::NodeCollector;
+
+    Action visitCompoundStatement(const CompoundStatementSyntax*) override
+    {
+        return Action::Skip;
+    }
+};
+
+struct IdentifierNameQuitter : NodeCollector
+{
+    using NodeCollector::NodeCollector;
+
+    Action visitIdentifierName(const IdentifierNameSyntax*) override
+    {
+        return Action::Quit;
+    }
+};
+
+bool fusedTraversalMatches(const SyntaxTree* tree, const std::vector<const SyntaxNode*>& nodes)
+{
+    NodeCollector collector(tree);
+    CompoundStatementSkipper skipper(tree);
+    IdentifierNameQuitter quitter(tree);
+    CompositeSyntaxVisitor composite;
+    composite.add(&collector);
+    composite.add(&skipper);
+    composite.add(&quitter);
+    composite.visit(tree->root());
+
+    CompoundStatementSkipper skipperAlone(tree);
+    skipperAlone.visit(tree->root());
+
+    auto quitIt = std::find_if(nodes.begin(),
+                               nodes.end(),
+                               [] (const SyntaxNode* node) {
+                                   return node->kind() == IdentifierName;
+                               });
+    std::vector<const SyntaxNode*> quitterNodes(
+                nodes.begin(),
+                quitIt == nodes.end() ? quitIt : quitIt + 1);
+
+    return collector.nodes_ == nodes
+            && skipper.nodes_ == skipperAlone.nodes_
+            && quitter.nodes_ == quitterNodes;
+}
+
+bool parallelTraversalMatches(const SyntaxTree* tree, const std::vector<const SyntaxNode*>& nodes)
+{
+    if (!tree->hasTranslationUnitRoot())
+        return true;
+
+    std::vector<const SyntaxNode*> nodesP { tree->root() };
+    ParallelSyntaxTraversal traversal(
+        [tree] () {
+            return std::unique_ptr<SyntaxVisitor>(new NodeCollector(tree));
+        },
+        [&nodesP] (const DeclarationSyntax*, SyntaxVisitor* visitor) {
+            auto collector = static_cast<NodeCollector*>(visitor);
+            nodesP.insert(nodesP.end(), collector->nodes_.begin(), collector->nodes_.end());
+        });
+    traversal.traverse(tree->translationUnitRoot(), 4);
+    if (nodesP != nodes)
+        return false;
+
+    // Again, by the (kept) threads of the first traversal.
+    nodesP.assign(1, tree->root());
+    traversal.traverse(tree->translationUnitRoot(), 4);
+    if (nodesP != nodes)
+        return false;
+
+    if (!tree->translationUnitRoot()->declarations())
+        return true;
+
+    // A failure within a worker reaches the caller.
+    ParallelSyntaxTraversal failingTraversal(
+        [] () -> std::unique_ptr<SyntaxVisitor> {
+            throw std::runtime_error("visitor");
+        },
+        [] (const DeclarationSyntax*, SyntaxVisitor*) {});
+    try {
+        failingTraversal.traverse(tree->translationUnitRoot(), 4);
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+bool kindBasedCastsMatch(const std::vector<const SyntaxNode*>& nodes)
+{
+#define CHECK_CAST(NODE) \
+    if (node->as##NODE() != dynamic_cast<const NODE##Syntax*>(node)) \
+        return false;
+
+    for (auto node : nodes) {
+        CHECK_CAST(TranslationUnit) CHECK_CAST(Declaration) CHECK_CAST(IncompleteDeclaration)
+        CHECK_CAST(NamedDeclaration) CHECK_CAST(TypeDeclaration) CHECK_CAST(TagDeclaration)
+        CHECK_CAST(StructOrUnionDeclaration) CHECK_CAST(EnumDeclaration)
+        CHECK_CAST(EnumeratorDeclaration) CHECK_CAST(ValueDeclaration)
+        CHECK_CAST(DeclaratorDeclaration) CHECK_CAST(VariableAndOrFunctionDeclaration)
+        CHECK_CAST(ParameterDeclaration) CHECK_CAST(FieldDeclaration)
+        CHECK_CAST(StaticAssertDeclaration) CHECK_CAST(FunctionDefinition)
+        CHECK_CAST(ExtPSY_TemplateDeclaration) CHECK_CAST(ExtGNU_AsmStatementDeclaration)
+        CHECK_CAST(ExtKR_ParameterDeclaration) CHECK_CAST(Specifier) CHECK_CAST(TrivialSpecifier)
+        CHECK_CAST(StorageClass) CHECK_CAST(BuiltinTypeSpecifier) CHECK_CAST(TagTypeSpecifier)
+        CHECK_CAST(TypeDeclarationAsSpecifier) CHECK_CAST(AtomicTypeSpecifier)
+        CHECK_CAST(TypeQualifier) CHECK_CAST(FunctionSpecifier) CHECK_CAST(AlignmentSpecifier)
+        CHECK_CAST(TypedefName) CHECK_CAST(ExtGNU_AttributeSpecifier) CHECK_CAST(ExtGNU_Attribute)
+        CHECK_CAST(ExtGNU_AsmLabel) CHECK_CAST(ExtGNU_Typeof)
+        CHECK_CAST(ExtPSY_QuantifiedTypeSpecifier) CHECK_CAST(Declarator) CHECK_CAST(PointerDeclarator)
+        CHECK_CAST(IdentifierDeclarator) CHECK_CAST(AbstractDeclarator)
+        CHECK_CAST(ParenthesizedDeclarator) CHECK_CAST(ArrayOrFunctionDeclarator)
+        CHECK_CAST(DeclaratorSuffix) CHECK_CAST(SubscriptSuffix) CHECK_CAST(ParameterSuffix)
+        CHECK_CAST(BitfieldDeclarator) CHECK_CAST(Initializer) CHECK_CAST(ExpressionInitializer)
+        CHECK_CAST(BraceEnclosedInitializer) CHECK_CAST(DesignatedInitializer) CHECK_CAST(Designator)
+        CHECK_CAST(ArrayDesignator) CHECK_CAST(FieldDesignator) CHECK_CAST(OffsetOfDesignator)
+        CHECK_CAST(Expression) CHECK_CAST(ConstantExpression) CHECK_CAST(StringLiteralExpression)
+        CHECK_CAST(ParenthesizedExpression) CHECK_CAST(GenericSelectionExpression)
+        CHECK_CAST(GenericAssociation) CHECK_CAST(ExtGNU_EnclosedCompoundStatementExpression)
+        CHECK_CAST(ExtGNU_ComplexValuedExpression) CHECK_CAST(Name) CHECK_CAST(IdentifierName)
+        CHECK_CAST(PredefinedName) CHECK_CAST(UnaryExpression) CHECK_CAST(PostfixUnaryExpression)
+        CHECK_CAST(PrefixUnaryExpression) CHECK_CAST(MemberAccessExpression)
+        CHECK_CAST(ArraySubscriptExpression) CHECK_CAST(TypeTraitExpression) CHECK_CAST(CallExpression)
+        CHECK_CAST(CompoundLiteralExpression) CHECK_CAST(CastExpression)
+        CHECK_CAST(VAArgumentExpression) CHECK_CAST(OffsetOfExpression) CHECK_CAST(BinaryExpression)
+        CHECK_CAST(ConditionalExpression) CHECK_CAST(AssignmentExpression)
+        CHECK_CAST(SequencingExpression) CHECK_CAST(ExtGNU_ChooseExpression) CHECK_CAST(Statement)
+        CHECK_CAST(CompoundStatement) CHECK_CAST(DeclarationStatement) CHECK_CAST(ExpressionStatement)
+        CHECK_CAST(LabeledStatement) CHECK_CAST(IfStatement) CHECK_CAST(SwitchStatement)
+        CHECK_CAST(WhileStatement) CHECK_CAST(DoStatement) CHECK_CAST(ForStatement)
+        CHECK_CAST(GotoStatement) CHECK_CAST(ContinueStatement) CHECK_CAST(BreakStatement)
+        CHECK_CAST(ReturnStatement) CHECK_CAST(ExtGNU_AsmStatement) CHECK_CAST(ExtGNU_AsmQualifier)
+        CHECK_CAST(ExtGNU_AsmOperand) CHECK_CAST(TypeName) CHECK_CAST(TypeReference)
+        CHECK_CAST(ExpressionAsTypeReference) CHECK_CAST(TypeNameAsTypeReference)
+        CHECK_CAST(AmbiguousTypeNameOrExpressionAsTypeReference)
+        CHECK_CAST(AmbiguousCastOrBinaryExpression)
+        CHECK_CAST(AmbiguousExpressionOrDeclarationStatement)
+    }
+
+#undef CHECK_CAST
+
+    return true;
+}
+
+bool indexedNodesMatch(const SyntaxTree* tree, std::vector<const SyntaxNode*> reached)
+{
+    std::vector<const SyntaxNode*> indexed;
+    for (auto k = static_cast<int>(STARTof_Node); k <= ENDof_Node; ++k) {
+        auto nodes = tree->nodesOfKind(static_cast<SyntaxKind>(k));
+        for (auto node : nodes) {
+            if (node->kind() != k)
+                return false;
+        }
+        indexed.insert(indexed.end(), nodes.begin(), nodes.end());
+    }
+
+    std::sort(reached.begin(), reached.end());
+    reached.erase(std::unique(reached.begin(), reached.end()), reached.end());
+    std::sort(indexed.begin(), indexed.end());
+    return reached == indexed;
+}
+
+} // anonymous
+
 InternalsTestSuite::InternalsTestSuite()
 {}
 
@@ -65,16 +263,22 @@ std::tuple<int, int> InternalsTestSuite::testAll()
     auto C = std::make_unique<BinderTester>(this);
     C->testBinder();
 
+    auto D = std::make_unique<SyntaxNamePrinterTester>(this);
+    D->testSyntaxNamePrinter();
+
     auto res = std::make_tuple(P->totalPassed()
                                     + B->totalPassed()
-                                    + C->totalPassed(),
+                                    + C->totalPassed()
+                                    + D->totalPassed(),
                                P->totalFailed()
                                     + B->totalFailed()
-                                    + C->totalFailed());
+                                    + C->totalFailed()
+                                    + D->totalFailed());
 
     testers_.emplace_back(P.release());
     testers_.emplace_back(B.release());
     testers_.emplace_back(C.release());
+    testers_.emplace_back(D.release());
 
     return res;
 }
@@ -194,6 +398,7 @@ void InternalsTestSuite::parse(std::string source,
 #endif
 
     ParseOptions parseOpts;
+    parseOpts.setIndexingOfNodesByKind(true);
     if (X.containsAmbiguity_)
             parseOpts.setTreatmentOfAmbiguities(ParseOptions::TreatmentOfAmbiguities::None);
 
@@ -212,6 +417,16 @@ void InternalsTestSuite::parse(std::string source,
     if (!checkErrorAndWarn(X))
         return;
 
+    NodeCollector collector(tree_.get());
+    collector.visit(tree_->root());
+    StaticNodeCollector staticCollector(tree_.get());
+    staticCollector.visit(tree_->root());
+    PSY_EXPECT_TRUE(collector.nodes_ == staticCollector.nodes_);
+    PSY_EXPECT_TRUE(indexedNodesMatch(tree_.get(), staticCollector.nodes_));
+    PSY_EXPECT_TRUE(fusedTraversalMatches(tree_.get(), collector.nodes_));
+    PSY_EXPECT_TRUE(parallelTraversalMatches(tree_.get(), collector.nodes_));
+    PSY_EXPECT_TRUE(kindBasedCastsMatch(collector.nodes_));
+
     std::ostringstream ossTree;
     SyntaxNamePrinter printer(tree_.get());
     printer.print(tree_->root(),
@@ -246,9 +461,16 @@ void InternalsTestSuite::parse(std::string source,
             PSY_EXPECT_EQ_STR(textP, X.ambiguityText_);
         }
     }
-    else
+    else {
         PSY_EXPECT_EQ_STR(textP, text);
 
+        if (X.numE_ == 0) {
+            std::string textExact;
+            unparser.unparse(tree_->root(), textExact, Unparser::Spacing::Original);
+            PSY_EXPECT_EQ_STR(textExact, source);
+        }
+    }
+
     if (X.syntaxKinds_.empty())
         return;
 
@@ -263,13 +485,15 @@ void InternalsTestSuite::parse(std::string source,
 
 void InternalsTestSuite::reparse(std::string source,
                                  Expectation X,
-                                 Reparser::DisambiguationStrategy strategy)
+                                 Reparser::DisambiguationStrategy strategy,
+                                 bool trackTypedefNames)
 {
     auto text = source;
 
     PSY_EXPECT_TRUE(strategy != Reparser::DisambiguationStrategy::UNSPECIFIED);
 
     ParseOptions parseOpts;
+    parseOpts.setIndexingOfNodesByKind(true);
     TextCompleteness textCompleness;
     switch (strategy) {
         case Reparser::DisambiguationStrategy::SyntaxCorrelation:
@@ -279,6 +503,7 @@ void InternalsTestSuite::reparse(std::string source,
 
         case Reparser::DisambiguationStrategy::TypeSynonymsVerification:
             parseOpts.setTreatmentOfAmbiguities(ParseOptions::TreatmentOfAmbiguities::DisambiguateAlgorithmically);
+            parseOpts.setTrackingOfTypedefNames(trackTypedefNames);
             textCompleness = TextCompleteness::Full;
             break;
 
@@ -300,6 +525,16 @@ void InternalsTestSuite::reparse(std::string source,
     if (!checkErrorAndWarn(X))
         return;
 
+    NodeCollector collector(tree_.get());
+    collector.visit(tree_->root());
+    StaticNodeCollector staticCollector(tree_.get());
+    staticCollector.visit(tree_->root());
+    PSY_EXPECT_TRUE(collector.nodes_ == staticCollector.nodes_);
+    PSY_EXPECT_TRUE(indexedNodesMatch(tree_.get(), staticCollector.nodes_));
+    PSY_EXPECT_TRUE(fusedTraversalMatches(tree_.get(), collector.nodes_));
+    PSY_EXPECT_TRUE(parallelTraversalMatches(tree_.get(), collector.nodes_));
+    PSY_EXPECT_TRUE(kindBasedCastsMatch(collector.nodes_));
+
     std::ostringstream ossTree;
     SyntaxNamePrinter printer(tree_.get());
     printer.print(tree_->root(),
@@ -334,9 +569,16 @@ void InternalsTestSuite::reparse(std::string source,
             PSY_EXPECT_EQ_STR(textP, X.ambiguityText_);
         }
     }
-    else
+    else {
         PSY_EXPECT_EQ_STR(textP, text);
 
+        if (X.numE_ == 0) {
+            std::string textExact;
+            unparser.unparse(tree_->root(), textExact, Unparser::Spacing::Original);
+            PSY_EXPECT_EQ_STR(textExact, source);
+        }
+    }
+
     if (X.syntaxKinds_.empty())
         return;
 
@@ -364,6 +606,11 @@ void InternalsTestSuite::reparse_withGuidelineImposition(std::string text, Expec
     reparse(text, X, Reparser::DisambiguationStrategy::GuidelineImposition);
 }
 
+void InternalsTestSuite::parse_withTypedefNameTracking(std::string text, Expectation X)
+{
+    reparse(text, X, Reparser::DisambiguationStrategy::TypeSynonymsVerification, true);
+}
+
 namespace {
 
 bool REJECT_CANDIDATE(const Symbol* sym, std::string msg)
@@ -635,9 +882,20 @@ bool typeMatchesBinding(const TypeSymbol* tySym, const DeclSummary& decl)
     return true;
 }
 
-bool symbolMatchesBinding(const std::unique_ptr<Symbol>& sym, const DeclSummary& summary)
+template <class PredT>
+const Symbol* findSymbol(const Assembly* assembly, PredT pred)
+{
+    for (std::size_t i = 0; i < assembly->symbolCount(); ++i) {
+        auto sym = assembly->symbolAt(i);
+        if (pred(sym))
+            return sym;
+    }
+    return nullptr;
+}
+
+bool symbolMatchesBinding(const Symbol* sym, const DeclSummary& summary)
 {
-    const Symbol* candSym = sym.get();
+    const Symbol* candSym = sym;
 
     if (candSym->kind() != summary.symK_)
         return REJECT_CANDIDATE(candSym, "symbol kind mismatch");
@@ -684,10 +942,10 @@ void InternalsTestSuite::bind(std::string text, Expectation X)
     if (!checkErrorAndWarn(X))
         return;
 
-    auto sym = compilation->assembly()->findSymDEF(
-                [] (const auto& sym) {
-                    return sym->kind() == SymbolKind::Library;
-                });
+    auto sym = findSymbol(compilation->assembly(),
+                          [] (const Symbol* sym) {
+                              return sym->kind() == SymbolKind::Library;
+                          });
     if (sym == nullptr)
         PSY__internals__FAIL("link unit not found");
 
@@ -698,7 +956,7 @@ void InternalsTestSuite::bind(std::string text, Expectation X)
         using namespace std::placeholders;
 
         auto pred = std::bind(symbolMatchesBinding, _1, binding);
-        auto sym = compilation->assembly()->findSymDEF(pred);
+        auto sym = findSymbol(compilation->assembly(), pred);
 
         if (sym == nullptr) {
             auto s = "no symbol matches the expectation: "
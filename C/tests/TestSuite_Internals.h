@@ -65,9 +65,11 @@ private:
     void reparse_withSyntaxCorrelation(std::string text, Expectation X = Expectation());
     void reparse_withTypeSynonymVerification(std::string text, Expectation X = Expectation());
     void reparse_withGuidelineImposition(std::string text, Expectation X = Expectation());
+    void parse_withTypedefNameTracking(std::string text, Expectation X = Expectation());
     void reparse(std::string text,
                  Expectation X = Expectation(),
-                 Reparser::DisambiguationStrategy strategy = Reparser::DisambiguationStrategy::UNSPECIFIED);
+                 Reparser::DisambiguationStrategy strategy = Reparser::DisambiguationStrategy::UNSPECIFIED,
+                 bool trackTypedefNames = false);
 
     void bind(std::string text, Expectation X = Expectation());
 
@@ -0,0 +1,253 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "CompilationDatabase.h"
+
+#include <cctype>
+#include <unordered_map>
+
+using namespace cnip;
+
+namespace {
+
+/*
+ * A reader for the subset of JSON that appears in a compilation database:
+ * an array of objects whose values are strings or arrays of strings
+ * (values of other kinds are skipped).
+ */
+class JsonReader
+{
+public:
+    JsonReader(const std::string& text)
+        : text_(text)
+        , pos_(0)
+    {}
+
+    bool readEntries(std::vector<std::unordered_map<std::string,
+                                                    std::vector<std::string>>>& objs)
+    {
+        if (!consume('['))
+            return false;
+        if (consume(']'))
+            return true;
+        do {
+            objs.emplace_back();
+            if (!readObject(objs.back()))
+                return false;
+        } while (consume(','));
+        return consume(']');
+    }
+
+    std::string::size_type offset() const { return pos_; }
+
+private:
+    bool readObject(std::unordered_map<std::string, std::vector<std::string>>& obj)
+    {
+        if (!consume('{'))
+            return false;
+        if (consume('}'))
+            return true;
+        do {
+            std::string key;
+            if (!readString(key) || !consume(':'))
+                return false;
+            auto& val = obj[key];
+            if (peek() == '"') {
+                val.emplace_back();
+                if (!readString(val.back()))
+                    return false;
+            }
+            else if (consume('[')) {
+                if (!consume(']')) {
+                    do {
+                        val.emplace_back();
+                        if (!readString(val.back()))
+                            return false;
+                    } while (consume(','));
+                    if (!consume(']'))
+                        return false;
+                }
+            }
+            else if (!skipScalar())
+                return false;
+        } while (consume(','));
+        return consume('}');
+    }
+
+    bool readString(std::string& s)
+    {
+        if (!consume('"'))
+            return false;
+        while (pos_ < text_.size()) {
+            auto c = text_[pos_++];
+            if (c == '"')
+                return true;
+            if (c != '\\') {
+                s += c;
+                continue;
+            }
+            if (pos_ >= text_.size())
+                return false;
+            c = text_[pos_++];
+            switch (c) {
+                case 'n': s += '\n'; break;
+                case 't': s += '\t'; break;
+                case 'r': s += '\r'; break;
+                case 'b': s += '\b'; break;
+                case 'f': s += '\f'; break;
+                case 'u': {
+                    unsigned code = 0;
+                    for (auto i = 0; i < 4; ++i, ++pos_) {
+                        if (pos_ >= text_.size() || !std::isxdigit(text_[pos_]))
+                            return false;
+                        auto d = std::tolower(text_[pos_]);
+                        code = code * 16 + (std::isdigit(d) ? d - '0' : d - 'a' + 10);
+                    }
+                    if (code < 0x80)
+                        s += static_cast<char>(code);
+                    else
+                        s += '?';
+                    break;
+                }
+                default:
+                    s += c;
+            }
+        }
+        return false;
+    }
+
+    bool skipScalar()
+    {
+        auto start = pos_;
+        while (pos_ < text_.size()
+                    && (std::isalnum(text_[pos_])
+                            || text_[pos_] == '-'
+                            || text_[pos_] == '+'
+                            || text_[pos_] == '.')) {
+            ++pos_;
+        }
+        return pos_ != start;
+    }
+
+    char peek()
+    {
+        skipSpace();
+        return pos_ < text_.size() ? text_[pos_] : '\0';
+    }
+
+    bool consume(char c)
+    {
+        if (peek() != c)
+            return false;
+        ++pos_;
+        return true;
+    }
+
+    void skipSpace()
+    {
+        while (pos_ < text_.size() && std::isspace(text_[pos_]))
+            ++pos_;
+    }
+
+    const std::string& text_;
+    std::string::size_type pos_;
+};
+
+} // anonymous
+
+std::pair<int, CompilationDatabase> CompilationDatabase::parse(const std::string& jsonText)
+{
+    CompilationDatabase db;
+
+    std::vector<std::unordered_map<std::string, std::vector<std::string>>> objs;
+    JsonReader reader(jsonText);
+    if (!reader.readEntries(objs)) {
+        db.error_ = "malformed JSON at offset " + std::to_string(reader.offset());
+        return std::make_pair(1, db);
+    }
+
+    for (auto& obj : objs) {
+        if (obj["file"].size() != 1) {
+            db.error_ = "entry " + std::to_string(db.entries_.size()) + " without a file";
+            return std::make_pair(1, db);
+        }
+
+        Entry entry;
+        const auto& dir = obj["directory"];
+        if (!dir.empty())
+            entry.directory_ = dir.front();
+        entry.filePath_ = obj["file"].front();
+        if (!entry.filePath_.empty()
+                && entry.filePath_.front() != '/'
+                && !entry.directory_.empty()) {
+            entry.filePath_ = entry.directory_ + '/' + entry.filePath_;
+        }
+
+        if (!obj["arguments"].empty())
+            entry.compilerArgs_ = std::move(obj["arguments"]);
+        else if (!obj["command"].empty())
+            entry.compilerArgs_ = splitCommand(obj["command"].front());
+
+        db.entries_.push_back(std::move(entry));
+    }
+
+    return std::make_pair(0, db);
+}
+
+std::vector<std::string> CompilationDatabase::splitCommand(const std::string& command)
+{
+    std::vector<std::string> args;
+    std::string arg;
+    bool inArg = false;
+    char quote = '\0';
+    for (std::string::size_type i = 0; i < command.size(); ++i) {
+        auto c = command[i];
+        if (quote) {
+            if (c == quote)
+                quote = '\0';
+            else if (c == '\\' && quote == '"' && i + 1 < command.size())
+                arg += command[++i];
+            else
+                arg += c;
+            continue;
+        }
+
+        if (std::isspace(c)) {
+            if (inArg) {
+                args.push_back(std::move(arg));
+                arg.clear();
+                inArg = false;
+            }
+            continue;
+        }
+
+        inArg = true;
+        if (c == '"' || c == '\'')
+            quote = c;
+        else if (c == '\\' && i + 1 < command.size())
+            arg += command[++i];
+        else
+            arg += c;
+    }
+    if (inArg)
+        args.push_back(std::move(arg));
+
+    return args;
+}
@@ -0,0 +1,78 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CNIPPET_COMPILATION_DATABASE_H__
+#define CNIPPET_COMPILATION_DATABASE_H__
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cnip {
+
+/*!
+ * \brief The CompilationDatabase class.
+ *
+ * A JSON compilation database (the `compile_commands.json' file).
+ *
+ * \see https://clang.llvm.org/docs/JSONCompilationDatabase.html
+ */
+class CompilationDatabase final
+{
+public:
+    /*!
+     * \brief The Entry struct.
+     *
+     * An entry of the database: the (absolute, if the entry's directory
+     * is absolute) path of the file, the arguments of its compilation
+     * command, either given by `arguments' or split from `command', and
+     * the working directory of that command.
+     */
+    struct Entry
+    {
+        std::string filePath_;
+        std::vector<std::string> compilerArgs_;
+        std::string directory_;
+    };
+
+    /**
+     * Parse the given \p jsonText into a database.
+     *
+     * \return An exit code (non-zero on malformed text) and the database
+     * (whose error, if any, tells what is wrong with the text).
+     */
+    static std::pair<int, CompilationDatabase> parse(const std::string& jsonText);
+
+    /**
+     * Split a shell \p command into arguments, honoring quotes and escapes.
+     */
+    static std::vector<std::string> splitCommand(const std::string& command);
+
+    const std::vector<Entry>& entries() const { return entries_; }
+    const std::string& error() const { return error_; }
+
+private:
+    std::vector<Entry> entries_;
+    std::string error_;
+};
+
+} // cnip
+
+#endif
@@ -22,10 +22,20 @@
 
 #include "Configuration.h"
 
+#include <iostream>
+
 using namespace cnip;
 
 CompilerFrontend::~CompilerFrontend()
 {}
 
 CompilerFrontend::CompilerFrontend()
+    : out_(&std::cout)
+    , err_(&std::cerr)
 {}
+
+void CompilerFrontend::redirectOutput(std::ostream& out, std::ostream& err)
+{
+    out_ = &out;
+    err_ = &err;
+}
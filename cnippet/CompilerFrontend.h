@@ -27,7 +27,9 @@
 
 #include "cxxopts.hpp"
 
+#include <ostream>
 #include <string>
+#include <vector>
 
 namespace cnip {
 
@@ -41,8 +43,34 @@ public:
 
     virtual int run(const std::string& srcText, const psy::FileInfo& fi) = 0;
 
+    /**
+     * Configure the frontend, for the subsequent runs, according to the
+     * arguments of a compiler command (on top of the command-line ones)
+     * that runs in the given \p directory (if not empty).
+     */
+    virtual void configureFor(const std::vector<std::string>& compilerArgs,
+                              const std::string& directory) = 0;
+
+    /**
+     * The (current) configuration of the frontend.
+     */
+    virtual Configuration& configuration() = 0;
+
+    /**
+     * Redirect the output of the frontend (by default, the standard
+     * output and error) to the given streams.
+     */
+    void redirectOutput(std::ostream& out, std::ostream& err);
+
 protected:
     CompilerFrontend();
+
+    std::ostream& out() const { return *out_; }
+    std::ostream& err() const { return *err_; }
+
+private:
+    std::ostream* out_;
+    std::ostream* err_;
 };
 
 } // cnip
@@ -22,6 +22,7 @@
 
 #include "FileInfo.h"
 #include "GnuCompilerFacade.h"
+#include "IncludeCache_C.h"
 #include "IO.h"
 #include "Plugin.h"
 
@@ -29,6 +30,8 @@
 #include "plugin-api/SourceInspector.h"
 #include "syntax/SyntaxNamePrinter.h"
 
+#include <iterator>
+
 using namespace cnip;
 using namespace psy;
 using namespace C;
@@ -50,12 +53,25 @@ constexpr int CCompilerFrontend::ERROR_InvalidSyntaxTree;
 
 CCompilerFrontend::CCompilerFrontend(const cxxopts::ParseResult& parsedCmdLine)
     : CompilerFrontend()
-    , config_(new ConfigurationForC(parsedCmdLine))
+    , baseConfig_(new ConfigurationForC(parsedCmdLine))
+    , config_(new ConfigurationForC(*baseConfig_))
 {}
 
 CCompilerFrontend::~CCompilerFrontend()
 {}
 
+void CCompilerFrontend::configureFor(const std::vector<std::string>& compilerArgs,
+                                     const std::string& directory)
+{
+    config_.reset(new ConfigurationForC(*baseConfig_));
+    config_->applyCompilerArguments(compilerArgs, directory);
+}
+
+Configuration& CCompilerFrontend::configuration()
+{
+    return *config_;
+}
+
 int CCompilerFrontend::run(const std::string& srcText, const FileInfo& fi)
 {
     if (srcText.empty())
@@ -104,21 +120,28 @@ int CCompilerFrontend::preprocess(const std::string& srcText,
     GnuCompilerFacade cc(config_->hostCompiler,
                       to_string(config_->langStd),
                       config_->macrosToDefine,
-                      config_->macrosToUndef);
+                      config_->macrosToUndef,
+                      config_->headerSearchPaths,
+                      { fi.fullDir() },
+                      config_->workingDirectory);
 
     std::string srcText_P;
     int exit;
     if (config_->expandIncludes) {
-        std::tie(exit, srcText_P) = cc.preprocess(srcText);
+        std::tie(exit, srcText_P) = config_->cacheIncludes
+                ? IncludeCache::shared().preprocess(cc, srcText)
+                : cc.preprocess(srcText);
         if (exit != 0) {
-            std::cerr << kCnip << "preprocessor invocation failed" << std::endl;
+            err() << kCnip << "preprocessor invocation failed" << std::endl;
             return ERROR_PreprocessorInvocationFailure;
         }
 
-        exit = writeFile(fi.fullFileBaseName() + ".i", srcText_P);
-        if (exit != 0) {
-            std::cerr << kCnip << "preprocessed file write failure" << std::endl;
-            return ERROR_PreprocessedFileWritingFailure;
+        if (config_->writePreprocessedFile) {
+            exit = writeFile(fi.fullFileBaseName() + ".i", srcText_P, err());
+            if (exit != 0) {
+                err() << kCnip << "preprocessed file write failure" << std::endl;
+                return ERROR_PreprocessedFileWritingFailure;
+            }
         }
     }
     else {
@@ -146,7 +169,7 @@ int CCompilerFrontend::constructSyntaxTree(const std::string& srcText,
         else if (config_->ParseOptions_TreatmentOfAmbiguities == "DisambiguateHeuristically")
             parseOpts.setTreatmentOfAmbiguities(ParseOptions::TreatmentOfAmbiguities::DisambiguateHeuristically);
         else {
-            std::cerr << "unrecognized --C-ParseOptions-TreatmentOfAmbiguities" << std::endl;
+            err() << "unrecognized --C-ParseOptions-TreatmentOfAmbiguities" << std::endl;
             return 1;
         }
     }
@@ -158,21 +181,21 @@ int CCompilerFrontend::constructSyntaxTree(const std::string& srcText,
                                       fi.fileName());
 
     if (!tree) {
-        std::cerr << "unsuccessful parsing" << std::endl;
+        err() << "unsuccessful parsing" << std::endl;
         return ERROR_UnsuccessfulParsing;
     }
 
     TranslationUnitSyntax* TU = tree->translationUnitRoot();
     if (!TU) {
-        std::cerr << "invalid syntax tree" << std::endl;
+        err() << "invalid syntax tree" << std::endl;
         return ERROR_InvalidSyntaxTree;
     }
 
     if (!tree->diagnostics().empty()) {
         auto c = tree->diagnostics();
         std::copy(c.begin(), c.end(),
-                  std::ostream_iterator<Diagnostic>(std::cerr));
-        std::cerr << std::endl;
+                  std::ostream_iterator<Diagnostic>(err()));
+        err() << std::endl;
     }
 
     if (config_->dumpAst) {
@@ -181,7 +204,7 @@ int CCompilerFrontend::constructSyntaxTree(const std::string& srcText,
         printer.print(TU,
                       SyntaxNamePrinter::Style::Decorated,
                       ossTree);
-        std::cout << ossTree.str() << std::endl;
+        out() << ossTree.str() << std::endl;
     }
 
     return config_->WIP_ ? computeSemanticModel(std::move(tree))
@@ -198,8 +221,8 @@ int CCompilerFrontend::computeSemanticModel(std::unique_ptr<SyntaxTree> tree)
     if (!tree->diagnostics().empty()) {
         auto c = tree->diagnostics();
         std::copy(c.begin(), c.end(),
-                  std::ostream_iterator<Diagnostic>(std::cerr));
-        std::cerr << std::endl;
+                  std::ostream_iterator<Diagnostic>(err()));
+        err() << std::endl;
     }
 
     return 0;
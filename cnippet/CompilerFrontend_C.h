@@ -43,6 +43,9 @@ public:
     virtual ~CCompilerFrontend();
 
     int run(const std::string& srcText, const psy::FileInfo& fi) override;
+    void configureFor(const std::vector<std::string>& compilerArgs,
+                      const std::string& directory) override;
+    Configuration& configuration() override;
 
 private:
 
@@ -56,6 +59,7 @@ private:
     static constexpr int ERROR_UnsuccessfulParsing = 102;
     static constexpr int ERROR_InvalidSyntaxTree = 103;
 
+    std::unique_ptr<ConfigurationForC> baseConfig_;
     std::unique_ptr<ConfigurationForC> config_;
 };
 
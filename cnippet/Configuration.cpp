@@ -27,5 +27,6 @@ Configuration::~Configuration()
 
 Configuration::Configuration(const cxxopts::ParseResult& parsedCmdLine)
     : dumpAst(parsedCmdLine.count("dump-AST"))
+    , writePreprocessedFile(true)
     , WIP_(parsedCmdLine.count("WIP"))
 {}
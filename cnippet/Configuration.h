@@ -35,6 +35,7 @@ public:
 
     // TODO: API
     bool dumpAst;
+    bool writePreprocessedFile;
     bool WIP_;
 
 protected:
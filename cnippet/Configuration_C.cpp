@@ -24,6 +24,7 @@ namespace {
 const char* const kCStd = "c-std";
 const char* const kHostCCompiler = "host-cc";
 const char* const kExpandCPPIncludeDirectives = "cpp-includes";
+const char* const kCacheCPPIncludeDirectives = "cpp-includes-cache";
 const char* const kDefineCPPMacro = "cpp-D";
 const char* const KUndefineCPPMacro = "cpp-U";
 const char* const kAddDirToCPPSearchPath = "cpp-I";
@@ -31,6 +32,28 @@ const char* const kAddDirToCPPSearchPath = "cpp-I";
 
 using namespace cnip;
 
+namespace {
+
+LanguageDialect::Std langStdFrom(std::string cc_std)
+{
+    std::for_each(cc_std.begin(),
+                  cc_std.end(),
+                  [] (char& c) { c = ::tolower(c); });
+    // The GNU dialects map to the ISO standard they extend.
+    if (cc_std.find("gnu") == 0)
+        cc_std.replace(0, 3, "c");
+    if (cc_std == "c89" || cc_std == "c90" || cc_std == "iso9899:1990")
+        return LanguageDialect::Std::C89_90;
+    if (cc_std == "c99" || cc_std == "c9x" || cc_std == "iso9899:1999")
+        return LanguageDialect::Std::C99;
+    if (cc_std == "c17" || cc_std == "c18"
+            || cc_std == "iso9899:2017" || cc_std == "iso9899:2018")
+        return LanguageDialect::Std::C17_18;
+    return LanguageDialect::Std::C11;
+}
+
+} // anonymous
+
 void ConfigurationForC::extend(cxxopts::Options& cmdLineOpts)
 {
     cmdLineOpts.add_options()
@@ -49,6 +72,9 @@ void ConfigurationForC::extend(cxxopts::Options& cmdLineOpts)
             (kExpandCPPIncludeDirectives,
                 "Expand `#include' directives of the C preprocessor.",
                 cxxopts::value<bool>()->default_value("false"))
+            (kCacheCPPIncludeDirectives,
+                "Cache the expansion of `#include' directives across files.",
+                cxxopts::value<bool>()->default_value("false"))
 
             // https://gcc.gnu.org/onlinedocs/gcc/Directory-Options.html
             (kAddDirToCPPSearchPath,
@@ -83,22 +109,12 @@ void ConfigurationForC::extend(cxxopts::Options& cmdLineOpts)
 ConfigurationForC::ConfigurationForC(const cxxopts::ParseResult& parsedCmdLine)
     : Configuration(parsedCmdLine)
 {
-    auto cc_std = parsedCmdLine[kCStd].as<std::string>();
-    std::for_each(cc_std.begin(),
-                  cc_std.end(),
-                  [] (char& c) { c = ::tolower(c); });
-    if (cc_std == "c89" || cc_std == "c90")
-        langStd = LanguageDialect::Std::C89_90;
-    else if (cc_std == "c99")
-        langStd = LanguageDialect::Std::C99;
-    else if (cc_std == "c17" || cc_std == "c18")
-        langStd = LanguageDialect::Std::C17_18;
-    else
-        langStd = LanguageDialect::Std::C11;
+    langStd = langStdFrom(parsedCmdLine[kCStd].as<std::string>());
 
     hostCompiler = parsedCmdLine[kHostCCompiler].as<std::string>();
 
     expandIncludes = parsedCmdLine[kExpandCPPIncludeDirectives].as<bool>();
+    cacheIncludes = parsedCmdLine[kCacheCPPIncludeDirectives].as<bool>();
     if (parsedCmdLine.count(kDefineCPPMacro))
         macrosToDefine = parsedCmdLine[kDefineCPPMacro].as<std::vector<std::string>>();
     if (parsedCmdLine.count(KUndefineCPPMacro))
@@ -111,3 +127,41 @@ ConfigurationForC::ConfigurationForC(const cxxopts::ParseResult& parsedCmdLine)
 
     inferMissingTypes = parsedCmdLine.count("infer");
 }
+
+void ConfigurationForC::applyCompilerArguments(const std::vector<std::string>& compilerArgs,
+                                               const std::string& directory)
+{
+    workingDirectory = directory;
+
+    for (std::size_t i = 0; i < compilerArgs.size(); ++i) {
+        const auto& arg = compilerArgs[i];
+        if (arg.find("-std=") == 0) {
+            langStd = langStdFrom(arg.substr(5));
+            continue;
+        }
+
+        std::vector<std::string>* opts;
+        if (arg.find("-D") == 0)
+            opts = &macrosToDefine;
+        else if (arg.find("-U") == 0)
+            opts = &macrosToUndef;
+        else if (arg.find("-I") == 0)
+            opts = &headerSearchPaths;
+        else
+            continue;
+
+        if (arg.size() > 2)
+            opts->push_back(arg.substr(2));
+        else if (i + 1 < compilerArgs.size())
+            opts->push_back(compilerArgs[++i]);
+        else
+            continue;
+
+        if (opts == &headerSearchPaths
+                && !directory.empty()
+                && !opts->back().empty()
+                && opts->back().front() != '/') {
+            opts->back() = directory + '/' + opts->back();
+        }
+    }
+}
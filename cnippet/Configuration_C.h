@@ -43,6 +43,16 @@ public:
 
     static void extend(cxxopts::Options& cmdLineOpts);
 
+    /**
+     * Adjust the configuration according to the arguments of a compiler
+     * command (e.g., from a compilation database): `-std=', `-D', `-U',
+     * and `-I'; other arguments are ignored. Relative `-I' paths are
+     * resolved against the \p directory of the command (if not empty),
+     * in which the preprocessor is then run.
+     */
+    void applyCompilerArguments(const std::vector<std::string>& compilerArgs,
+                                const std::string& directory);
+
     // TODO: API
     LanguageDialect::Std langStd;
 
@@ -50,11 +60,13 @@ public:
     std::vector<std::string> macrosToDefine;
     std::vector<std::string> macrosToUndef;
     std::vector<std::string> headerSearchPaths;
+    std::string workingDirectory;
 
     std::string ParseOptions_TreatmentOfAmbiguities;
 
     // TODO: Bit fields.
     bool expandIncludes;
+    bool cacheIncludes;
     bool inferMissingTypes;
 };
 
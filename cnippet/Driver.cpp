@@ -20,19 +20,25 @@
 
 #include "Driver.h"
 
+#include "CompilationDatabase.h"
 #include "CompilerFrontend.h"
 #include "CompilerFrontend_C.h"
 #include "Configuration.h"
 #include "Configuration_C.h"
 #include "FileInfo.h"
 #include "IO.h"
+#include "IncludeCache_C.h"
 #include "Plugin.h"
+#include "Server.h"
 
 #include <algorithm>
+#include <atomic>
+#include <iomanip>
 #include <iostream>
 #include <iterator>
 #include <sstream>
 #include <cstring>
+#include <thread>
 
 using namespace psy;
 using namespace cnip;
@@ -44,6 +50,7 @@ constexpr int Driver::ERROR_NoInputFile;
 constexpr int Driver::ERROR_UnrecognizedCmdLineOption;
 constexpr int Driver::ERROR_CannotLoadPluging;
 constexpr int Driver::ERROR_LanguageNotRecognized;
+constexpr int Driver::ERROR_InvalidCompilationDatabase;
 
 Driver::Driver()
 {}
@@ -74,14 +81,30 @@ int Driver::execute(int argc, char* argv[])
                 cxxopts::value<std::string>())
             ("w,WIP",
                 "Enable Work-In-Progress features.")
+            ("j,jobs",
+                "Process the input files with the given number of jobs.",
+                cxxopts::value<unsigned>()->default_value("1"),
+                "N")
+            ("compile-commands",
+                "Process the entries of a compilation database.",
+                cxxopts::value<std::string>(),
+                "compile_commands.json")
+            ("serve",
+                "Serve requests over the standard input/output.")
+            ("serve-socket",
+                "Serve requests over a Unix domain socket.",
+                cxxopts::value<std::string>(),
+                "path")
             ("h,help",
                 "Print instructions.")
     ;
 
     ConfigurationForC::extend(cmdLineOpts);
 
-    std::unique_ptr<CompilerFrontend> FE;
-    std::vector<std::string> filesPaths;
+    FrontendList FEs;
+    bool printTimingsAtEnd = false;
+    bool serve = false;
+    std::string socketPath;
     try {
         cmdLineOpts.parse_positional(std::vector<std::string>{"file"});
         auto parsedCmdLine = cmdLineOpts.parse(argc, argv);
@@ -100,9 +123,22 @@ int Driver::execute(int argc, char* argv[])
             }
         }
 
-        if (parsedCmdLine.count("file"))
-            filesPaths = parsedCmdLine["file"].as<std::vector<std::string>>();
-        else {
+        if (parsedCmdLine.count("compile-commands")) {
+            auto exit = readCompilationDatabase(
+                        parsedCmdLine["compile-commands"].as<std::string>());
+            if (exit != 0)
+                return exit;
+            printTimingsAtEnd = true;
+        }
+        if (parsedCmdLine.count("file")) {
+            for (const auto& filePath : parsedCmdLine["file"].as<std::vector<std::string>>())
+                inputs_.push_back({ filePath, {} });
+        }
+        if (parsedCmdLine.count("serve-socket"))
+            socketPath = parsedCmdLine["serve-socket"].as<std::string>();
+        serve = parsedCmdLine.count("serve") || !socketPath.empty();
+
+        if (inputs_.empty() && !serve) {
             std::cerr << kCnip << "no input file(s)" << std::endl;
             return ERROR_NoInputFile;
         }
@@ -113,31 +149,169 @@ int Driver::execute(int argc, char* argv[])
             return ERROR_LanguageNotRecognized;
         }
 
-        FE.reset(new CCompilerFrontend(parsedCmdLine));
+        // A plugin isn't required to be thread-safe.
+        auto jobs = parsedCmdLine["jobs"].as<unsigned>();
+        if (jobs == 0 || Plugin::isLoaded())
+            jobs = 1;
+        if (!serve)
+            jobs = std::min<std::size_t>(jobs, inputs_.size());
+
+        for (auto i = 0U; i < jobs; ++i)
+            FEs.emplace_back(new CCompilerFrontend(parsedCmdLine));
     }
     catch (...) {
         std::cerr << kCnip << "unrecognized command-line option" << std::endl;
         return ERROR_UnrecognizedCmdLineOption;
     }
 
-    for (auto filePath : filesPaths) {
-        auto [exit, srcText] = readFile(filePath);
-        if (exit != 0)
-            return ERROR_FileNotFound;
+    if (serve) {
+        Server server(std::move(FEs));
+        return socketPath.empty() ? server.serveStdio()
+                                  : server.serveSocket(socketPath);
+    }
 
-        FileInfo fi(filePath);
+    auto exit = processFiles(FEs);
+    if (printTimingsAtEnd)
+        printTimings();
 
-        try {
-            exit = FE->run(srcText, fi);
-        }
-        catch (...) {
-            Plugin::unload();
-            return Driver::ERROR;
-        }
+    return exit;
+}
+
+int Driver::readCompilationDatabase(const std::string& dbPath)
+{
+    auto [exit, jsonText] = readFile(dbPath);
+    if (exit != 0)
+        return ERROR_FileNotFound;
+
+    auto [exitDB, db] = CompilationDatabase::parse(jsonText);
+    if (exitDB != 0) {
+        std::cerr << kCnip << "invalid compilation database " << dbPath
+                  << ": " << db.error() << std::endl;
+        return ERROR_InvalidCompilationDatabase;
+    }
 
+    for (const auto& entry : db.entries())
+        inputs_.push_back({ entry.filePath_, entry.compilerArgs_, entry.directory_ });
+
+    return SUCCESS;
+}
+
+int Driver::processFiles(const FrontendList& FEs)
+{
+    timings_.assign(inputs_.size(), {});
+
+    if (FEs.size() > 1)
+        return processFiles_Parallel(FEs);
+
+    for (auto idx = 0U; idx < inputs_.size(); ++idx) {
+        auto exit = processFile(FEs.front().get(), idx, std::cerr);
         if (exit != 0)
             return exit;
     }
 
     return SUCCESS;
 }
+
+/*
+ * Each job owns a frontend, whose output is buffered per file and,
+ * once all jobs are finished, flushed in the order of the input files.
+ * Like in the sequential processing, the exit code is that of the first
+ * (input-ordered) file that fails; files after it are not processed,
+ * or have their output discarded if they already were.
+ */
+int Driver::processFiles_Parallel(const FrontendList& FEs)
+{
+    struct FileResult
+    {
+        int exit_ { SUCCESS };
+        std::ostringstream out_;
+        std::ostringstream err_;
+    };
+    std::vector<FileResult> results(inputs_.size());
+
+    std::atomic<std::size_t> nextIdx { 0 };
+    std::atomic<std::size_t> failedIdx { inputs_.size() };
+
+    auto job = [&] (CompilerFrontend* FE) {
+        while (true) {
+            auto idx = nextIdx++;
+            if (idx >= inputs_.size() || idx > failedIdx)
+                return;
+
+            auto& result = results[idx];
+            FE->redirectOutput(result.out_, result.err_);
+            result.exit_ = processFile(FE, idx, result.err_);
+            if (result.exit_ == 0)
+                continue;
+
+            auto curIdx = failedIdx.load();
+            while (idx < curIdx && !failedIdx.compare_exchange_weak(curIdx, idx))
+                ;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (const auto& FE : FEs)
+        threads.emplace_back(job, FE.get());
+    for (auto& thread : threads)
+        thread.join();
+
+    for (const auto& result : results) {
+        std::cout << result.out_.str();
+        std::cerr << result.err_.str();
+        if (result.exit_ != 0)
+            return result.exit_;
+    }
+
+    return SUCCESS;
+}
+
+/*
+ * The errors of a file (as those of its frontend) go to \p err.
+ */
+int Driver::processFile(CompilerFrontend* FE, std::size_t idx, std::ostream& err)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    const auto& input = inputs_[idx];
+    auto [exit, srcText] = readFile(input.filePath_, err);
+    if (exit != 0)
+        return ERROR_FileNotFound;
+
+    FileInfo fi(input.filePath_);
+
+    try {
+        FE->configureFor(input.compilerArgs_, input.directory_);
+        exit = FE->run(srcText, fi);
+    }
+    catch (...) {
+        Plugin::unload();
+        return Driver::ERROR;
+    }
+
+    timings_[idx] = std::chrono::steady_clock::now() - start;
+
+    return exit;
+}
+
+void Driver::printTimings() const
+{
+    std::chrono::duration<double, std::milli> total {};
+    for (auto idx = 0U; idx < inputs_.size(); ++idx) {
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(10) << timings_[idx].count() << " ms  "
+                  << inputs_[idx].filePath_ << std::endl;
+        total += timings_[idx];
+    }
+    std::cout << kCnip << inputs_.size() << " file(s), "
+              << std::fixed << std::setprecision(1)
+              << total.count() << " ms (cumulative)" << std::endl;
+
+    auto stats = IncludeCache::shared().stats();
+    if (stats.hits_ || stats.misses_ || stats.bypasses_) {
+        std::cout << kCnip << "include cache: "
+                  << stats.hits_ << " hit(s), "
+                  << stats.misses_ << " miss(es), "
+                  << stats.bypasses_ << " bypass(es)" << std::endl;
+    }
+}
@@ -21,10 +21,18 @@
 #ifndef CNIPPET_DRIVER_H__
 #define CNIPPET_DRIVER_H__
 
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
 const char* const kCnip = "cnip: ";
 
 namespace cnip {
 
+class CompilerFrontend;
+
 /*!
  * \brief The Driver class.
  */
@@ -37,8 +45,27 @@ public:
     int execute(int argc, char* argv[]);
 
 private:
+    using FrontendList = std::vector<std::unique_ptr<CompilerFrontend>>;
+
+    struct InputFile
+    {
+        std::string filePath_;
+        std::vector<std::string> compilerArgs_;
+        std::string directory_;
+    };
+
+    int readCompilationDatabase(const std::string& dbPath);
+    int processFiles(const FrontendList& FEs);
+    int processFiles_Parallel(const FrontendList& FEs);
+    int processFile(CompilerFrontend* FE, std::size_t idx, std::ostream& err);
+    void printTimings() const;
+
+    std::vector<InputFile> inputs_;
+    std::vector<std::chrono::duration<double, std::milli>> timings_;
+
     friend class FrontEnd;
     friend class CCompilerFrontEnd;
+    friend class Server;
 
     static constexpr int SUCCESS = 0;
 
@@ -48,6 +75,7 @@ private:
     static constexpr int ERROR_FileNotFound = 4;
     static constexpr int ERROR_CannotLoadPluging = 5;
     static constexpr int ERROR_LanguageNotRecognized = 6;
+    static constexpr int ERROR_InvalidCompilationDatabase = 7;
 };
 
 } // cnip
@@ -0,0 +1,251 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "IncludeCache_C.h"
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <unordered_set>
+
+using namespace cnip;
+using namespace psy;
+
+namespace
+{
+/*
+ * The name of the directive of a (trimmed) line, if any.
+ */
+std::string directiveOf(const std::string& trimmed)
+{
+    if (trimmed.empty() || trimmed[0] != '#')
+        return "";
+    auto pos = trimmed.find_first_not_of(" \t", 1);
+    if (pos == std::string::npos)
+        return "";
+    auto endPos = pos;
+    while (endPos < trimmed.length() && std::isalpha(trimmed[endPos]))
+        ++endPos;
+    return trimmed.substr(pos, endPos - pos);
+}
+
+/*
+ * Split the text into its leading `#include' section and the remaining
+ * text. Besides `#include' directives, the section may contain blank
+ * lines, comments, `#pragma once', and `#define'/`#undef' directives
+ * (e.g., of feature-test macros such as `_GNU_SOURCE'), which are kept
+ * in the section as they affect the expansion of the headers. Any other
+ * line (e.g., the `#ifndef' of an include guard) ends the section.
+ */
+bool splitIncludeSection(const std::string& srcText,
+                         std::string& includesText,
+                         unsigned& includesLineCnt,
+                         std::string& remainingText)
+{
+    std::istringstream iss(srcText);
+    std::string line;
+    bool inIncludeSection = true;
+    bool hasInclude = false;
+    bool inDirective = false;
+    std::string commentText;
+    unsigned commentLineCnt = 0;
+    includesLineCnt = 0;
+    while (std::getline(iss, line)) {
+        auto trimmed = line.substr(std::min(line.length(),
+                                            line.find_first_not_of(" \t")));
+        if (inIncludeSection) {
+            // A line of a directive continued with a backslash.
+            if (inDirective) {
+                includesText += line + '\n';
+                ++includesLineCnt;
+                inDirective = !line.empty() && line.back() == '\\';
+                continue;
+            }
+
+            // A line of a block comment, which ends the section if there's
+            // text after it.
+            if (commentLineCnt || trimmed.find("/*") == 0) {
+                commentText += line + '\n';
+                ++commentLineCnt;
+                auto endPos = line.find("*/", commentLineCnt == 1 ? line.find("/*") + 2 : 0);
+                if (endPos == std::string::npos)
+                    continue;
+                if (line.find_first_not_of(" \t", endPos + 2) == std::string::npos) {
+                    includesLineCnt += commentLineCnt;
+                    commentText.clear();
+                    commentLineCnt = 0;
+                    continue;
+                }
+                inIncludeSection = false;
+                remainingText += commentText;
+                commentText.clear();
+                continue;
+            }
+
+            if (trimmed.empty() || trimmed.find("//") == 0) {
+                ++includesLineCnt;
+                continue;
+            }
+
+            auto directive = directiveOf(trimmed);
+            if (directive == "include"
+                    || directive == "define"
+                    || directive == "undef") {
+                includesText += trimmed + '\n';
+                ++includesLineCnt;
+                hasInclude |= directive == "include";
+                inDirective = trimmed.back() == '\\';
+                continue;
+            }
+            if (directive == "pragma" && trimmed.find("once") != std::string::npos) {
+                ++includesLineCnt;
+                continue;
+            }
+            inIncludeSection = false;
+        }
+        else if (directiveOf(trimmed) == "include") {
+            return false;
+        }
+        remainingText += line + '\n';
+    }
+    remainingText += commentText;
+
+    return hasInclude;
+}
+
+} // anonymous
+
+IncludeCache& IncludeCache::shared()
+{
+    static IncludeCache cache;
+    return cache;
+}
+
+IncludeCache::Stats IncludeCache::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+std::pair<int, std::string> IncludeCache::preprocess(GnuCompilerFacade& cc,
+                                                     const std::string& srcText)
+{
+    std::string includesText;
+    unsigned includesLineCnt;
+    std::string remainingText;
+    if (!splitIncludeSection(srcText, includesText, includesLineCnt, remainingText)) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++stats_.bypasses_;
+        }
+        return cc.preprocess(srcText);
+    }
+
+    auto key = cc.invocationKey() + '\n' + includesText;
+    Entry entry;
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            entry = it->second;
+            found = true;
+            ++stats_.hits_;
+        }
+    }
+
+    if (!found) {
+        int exit;
+        std::tie(exit, entry) = expand(cc, includesText);
+        if (exit != 0)
+            return std::make_pair(exit, "");
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.emplace(key, entry);
+        ++stats_.misses_;
+    }
+
+    /*
+     * The remaining text is preprocessed after the (cached) macros of the
+     * headers; a line directive preserves its original line numbering.
+     */
+    std::string text = entry.macrosText_;
+    text += "#line " + std::to_string(includesLineCnt + 1) + '\n';
+    text += remainingText;
+
+    auto [exit, remainingText_P] = cc.preprocess(text);
+    if (exit != 0)
+        return std::make_pair(exit, "");
+
+    return std::make_pair(0, entry.headersText_ + remainingText_P);
+}
+
+std::pair<int, IncludeCache::Entry> IncludeCache::expand(GnuCompilerFacade& cc,
+                                                         const std::string& includesText)
+{
+    Entry entry;
+
+    auto [exit, headersText] = cc.preprocess(includesText);
+    if (exit != 0)
+        return std::make_pair(exit, entry);
+    entry.headersText_ = std::move(headersText);
+
+    auto [exitM, macrosText] = cc.preprocess_MacroDefinitions(includesText);
+    if (exitM != 0)
+        return std::make_pair(exitM, entry);
+
+    auto [exitP, predefText] = predefinedMacros(cc);
+    if (exitP != 0)
+        return std::make_pair(exitP, entry);
+
+    std::unordered_set<std::string> predef;
+    std::istringstream issP(predefText);
+    std::string line;
+    while (std::getline(issP, line))
+        predef.insert(line);
+
+    // Predefined macros mustn't be redefined.
+    std::istringstream issM(macrosText);
+    while (std::getline(issM, line)) {
+        if (!predef.count(line))
+            entry.macrosText_ += line + '\n';
+    }
+
+    return std::make_pair(0, entry);
+}
+
+std::pair<int, std::string> IncludeCache::predefinedMacros(GnuCompilerFacade& cc)
+{
+    auto ccKey = cc.invocationKey();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = predefined_.find(ccKey);
+        if (it != predefined_.end())
+            return std::make_pair(0, it->second);
+    }
+
+    auto [exit, predefText] = cc.preprocess_MacroDefinitions("");
+    if (exit != 0)
+        return std::make_pair(exit, "");
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    predefined_[ccKey] = predefText;
+    return std::make_pair(0, predefText);
+}
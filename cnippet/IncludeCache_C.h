@@ -0,0 +1,103 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CNIPPET_INCLUDE_CACHE_C_H__
+#define CNIPPET_INCLUDE_CACHE_C_H__
+
+#include "GnuCompilerFacade.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace cnip {
+
+/*!
+ * \brief The IncludeCache class.
+ *
+ * A cache of the preprocessed expansion of the leading `#include' section
+ * of a translation unit. The key of an entry is the sequence of `#include'
+ * (and `#define'/`#undef') directives of the section together with the
+ * preprocessor invocation (host compiler, C standard, macros to
+ * define/undefine, search paths, and directory). An entry holds the expansion
+ * of the headers and the macros they define, so that a subsequent
+ * translation unit with the same `#include' section is preprocessed
+ * without re-expanding its headers.
+ *
+ * \remark The cache is shared by all frontends of the process.
+ */
+class IncludeCache final
+{
+public:
+    static IncludeCache& shared();
+
+    /**
+     * Preprocess the given \p srcText with \p cc, reusing (or populating)
+     * the cached expansion of its `#include' section.
+     *
+     * \remark A text with `#include' directives after its leading section
+     * is preprocessed as a whole, bypassing the cache. The section may
+     * contain comments, `#pragma once', and `#define'/`#undef' directives
+     * (e.g., of feature-test macros) but is ended by any other directive,
+     * such as the `#ifndef' of an include guard or an `#if'.
+     */
+    std::pair<int, std::string> preprocess(psy::GnuCompilerFacade& cc,
+                                           const std::string& srcText);
+
+    /*!
+     * \brief The Stats struct.
+     *
+     * The number of texts whose `#include' section was found in the
+     * cache (hits), was expanded and cached (misses), or that bypassed
+     * the cache.
+     */
+    struct Stats
+    {
+        unsigned hits_ { 0 };
+        unsigned misses_ { 0 };
+        unsigned bypasses_ { 0 };
+    };
+    Stats stats() const;
+
+private:
+    IncludeCache() = default;
+    IncludeCache(const IncludeCache&) = delete;
+    IncludeCache& operator=(const IncludeCache&) = delete;
+
+    struct Entry
+    {
+        std::string headersText_;
+        std::string macrosText_;
+    };
+
+    std::pair<int, Entry> expand(psy::GnuCompilerFacade& cc,
+                                 const std::string& includesText);
+    std::pair<int, std::string> predefinedMacros(psy::GnuCompilerFacade& cc);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::unordered_map<std::string, std::string> predefined_;
+    Stats stats_;
+};
+
+} // cnip
+
+#endif
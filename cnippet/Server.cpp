@@ -0,0 +1,421 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "Server.h"
+
+#include "Configuration.h"
+#include "Driver.h"
+#include "FileInfo.h"
+
+#include <algorithm>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <sstream>
+#include <thread>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace cnip;
+
+constexpr int Server::ERROR_BadRequest;
+constexpr int Server::ERROR_SocketFailure;
+constexpr std::size_t Server::MAX_HeaderLength;
+constexpr std::size_t Server::MAX_PayloadLength;
+constexpr std::size_t Server::MAX_LatencySamples;
+
+struct Server::Channel
+{
+    Channel(int inFd, int outFd, bool ownsFds)
+        : inFd_(inFd)
+        , outFd_(outFd)
+        , ownsFds_(ownsFds)
+        , pos_(0)
+    {}
+
+    ~Channel()
+    {
+        if (!ownsFds_)
+            return;
+        close(inFd_);
+        if (outFd_ != inFd_)
+            close(outFd_);
+    }
+
+    bool fill()
+    {
+        if (pos_ < buf_.size())
+            return true;
+        char data[4096];
+        auto cnt = read(inFd_, data, sizeof(data));
+        if (cnt <= 0)
+            return false;
+        buf_.assign(data, cnt);
+        pos_ = 0;
+        return true;
+    }
+
+    bool readLine(std::string& line, std::size_t maxLen)
+    {
+        line.clear();
+        while (fill()) {
+            auto nl = buf_.find('\n', pos_);
+            if (nl != std::string::npos) {
+                line.append(buf_, pos_, nl - pos_);
+                pos_ = nl + 1;
+                return line.size() <= maxLen;
+            }
+            line.append(buf_, pos_, std::string::npos);
+            pos_ = buf_.size();
+            if (line.size() > maxLen)
+                return false;
+        }
+        return false;
+    }
+
+    bool readExact(std::string& s, std::size_t len)
+    {
+        s.clear();
+        s.reserve(len);
+        while (s.size() < len && fill()) {
+            auto cnt = std::min(len - s.size(), buf_.size() - pos_);
+            s.append(buf_, pos_, cnt);
+            pos_ += cnt;
+        }
+        return s.size() == len;
+    }
+
+    bool writeAll(const std::string& s)
+    {
+        std::size_t done = 0;
+        while (done < s.size()) {
+            auto cnt = write(outFd_, s.data() + done, s.size() - done);
+            if (cnt <= 0)
+                return false;
+            done += cnt;
+        }
+        return true;
+    }
+
+    int inFd_;
+    int outFd_;
+    bool ownsFds_;
+    std::string buf_;
+    std::string::size_type pos_;
+    std::mutex writeMutex_;
+};
+
+struct Server::Request
+{
+    std::shared_ptr<Channel> chan_;
+    std::string id_;
+    std::string command_;
+    std::vector<std::string> compilerArgs_;
+    std::string payload_;
+    std::chrono::steady_clock::time_point arrival_;
+};
+
+Server::Server(std::vector<std::unique_ptr<CompilerFrontend>> FEs)
+    : FEs_(std::move(FEs))
+    , quitting_(false)
+    , stopping_(false)
+    , requestCnt_(0)
+{}
+
+Server::~Server()
+{}
+
+int Server::serveStdio()
+{
+    // Stray output to the standard output would corrupt the responses.
+    auto outFd = dup(STDOUT_FILENO);
+    if (outFd < 0 || dup2(STDERR_FILENO, STDOUT_FILENO) < 0)
+        return Driver::ERROR;
+    std::signal(SIGPIPE, SIG_IGN);
+
+    auto exit = serveDescriptors(STDIN_FILENO, outFd);
+    close(outFd);
+
+    return exit;
+}
+
+int Server::serveDescriptors(int inFd, int outFd)
+{
+    startWorkers();
+    serveChannel(std::make_shared<Channel>(inFd, outFd, false));
+    stopWorkers();
+
+    return Driver::SUCCESS;
+}
+
+void Server::startWorkers()
+{
+    for (const auto& FE : FEs_)
+        workers_.emplace_back(&Server::work, this, FE.get());
+}
+
+/*
+ * Once no request may be queued anymore, the workers process those that
+ * are and quit.
+ */
+void Server::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        stopping_ = true;
+    }
+    queueCond_.notify_all();
+    for (auto& worker : workers_)
+        worker.join();
+    workers_.clear();
+}
+
+int Server::serveSocket(const std::string& socketPath)
+{
+    sockaddr_un addr;
+    if (socketPath.size() >= sizeof(addr.sun_path)) {
+        std::cerr << kCnip << "socket path too long" << std::endl;
+        return ERROR_SocketFailure;
+    }
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strcpy(addr.sun_path, socketPath.c_str());
+
+    auto listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        std::cerr << kCnip << "cannot create socket" << std::endl;
+        return ERROR_SocketFailure;
+    }
+    unlink(socketPath.c_str());
+    if (bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0
+            || listen(listenFd, SOMAXCONN) < 0) {
+        std::cerr << kCnip << "cannot listen on socket " << socketPath << std::endl;
+        close(listenFd);
+        return ERROR_SocketFailure;
+    }
+    std::signal(SIGPIPE, SIG_IGN);
+
+    startWorkers();
+
+    struct Reader
+    {
+        std::thread thread_;
+        int connFd_;
+        bool done_;
+    };
+    std::list<Reader> readers;
+    std::mutex connMutex;
+    while (true) {
+        auto connFd = accept(listenFd, nullptr, nullptr);
+        if (connFd < 0)
+            break;
+
+        std::lock_guard<std::mutex> lock(connMutex);
+
+        // Join the readers whose connection is over.
+        for (auto it = readers.begin(); it != readers.end();) {
+            if (it->done_) {
+                it->thread_.join();
+                it = readers.erase(it);
+            }
+            else
+                ++it;
+        }
+
+        readers.push_back({ std::thread(), connFd, false });
+        auto reader = &readers.back();
+        reader->thread_ = std::thread([this, reader, listenFd, &connMutex] () {
+            auto chan = std::make_shared<Channel>(reader->connFd_, reader->connFd_, true);
+            serveChannel(chan);
+            {
+                std::lock_guard<std::mutex> lock(queueMutex_);
+                if (quitting_)
+                    shutdown(listenFd, SHUT_RDWR);
+            }
+            // Done while the channel (and the descriptor) is still held.
+            std::lock_guard<std::mutex> lock(connMutex);
+            reader->done_ = true;
+        });
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(connMutex);
+        for (const auto& reader : readers) {
+            if (!reader.done_)
+                shutdown(reader.connFd_, SHUT_RD);
+        }
+    }
+    for (auto& reader : readers)
+        reader.thread_.join();
+
+    stopWorkers();
+
+    close(listenFd);
+    unlink(socketPath.c_str());
+
+    return Driver::SUCCESS;
+}
+
+void Server::serveChannel(std::shared_ptr<Channel> chan)
+{
+    std::string line;
+    while (chan->readLine(line, MAX_HeaderLength)) {
+        std::unique_ptr<Request> req(new Request);
+        req->chan_ = chan;
+        req->arrival_ = std::chrono::steady_clock::now();
+
+        std::istringstream iss(line);
+        std::size_t len = 0;
+        iss >> req->id_ >> req->command_ >> len;
+        // The length of the payload is unknown: the channel can't be resynced.
+        if (!iss) {
+            reply(*chan, req->id_.empty() ? "?" : req->id_, ERROR_BadRequest, "malformed header\n");
+            break;
+        }
+
+        std::string arg;
+        while (iss >> arg)
+            req->compilerArgs_.push_back(arg);
+
+        if (len > MAX_PayloadLength) {
+            reply(*chan, req->id_, ERROR_BadRequest, "payload too long\n");
+            break;
+        }
+
+        if (!chan->readExact(req->payload_, len))
+            break;
+
+        if (req->command_ == "quit") {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            quitting_ = true;
+            break;
+        }
+
+        if (req->command_ == "stats") {
+            reply(*chan, req->id_, Driver::SUCCESS, stats());
+            continue;
+        }
+
+        if (req->command_ != "parse" && req->command_ != "dump-AST") {
+            reply(*chan, req->id_, ERROR_BadRequest, "unknown command " + req->command_ + "\n");
+            continue;
+        }
+
+        auto queued = false;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            if (!quitting_) {
+                queue_.push_back(std::move(req));
+                queued = true;
+            }
+        }
+        if (!queued) {
+            reply(*chan, req->id_, ERROR_BadRequest, "server quitting\n");
+            break;
+        }
+        queueCond_.notify_one();
+    }
+}
+
+void Server::work(CompilerFrontend* FE)
+{
+    while (true) {
+        std::unique_ptr<Request> req;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueCond_.wait(lock, [this] () { return stopping_ || !queue_.empty(); });
+            if (queue_.empty())
+                return;
+            req = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        process(FE, *req);
+    }
+}
+
+void Server::process(CompilerFrontend* FE, Request& req)
+{
+    std::ostringstream out;
+    std::ostringstream err;
+    FE->redirectOutput(out, err);
+
+    int exit;
+    try {
+        FE->configureFor(req.compilerArgs_, "");
+        FE->configuration().dumpAst = req.command_ == "dump-AST";
+        // The payload has no file of its own (the id is the client's).
+        FE->configuration().writePreprocessedFile = false;
+        exit = FE->run(req.payload_, psy::FileInfo(req.id_ + ".c"));
+    }
+    catch (...) {
+        exit = Driver::ERROR;
+    }
+
+    reply(*req.chan_, req.id_, exit, err.str() + out.str());
+
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    auto latency = std::chrono::steady_clock::now() - req.arrival_;
+    if (latencies_.size() < MAX_LatencySamples)
+        latencies_.push_back(latency);
+    else
+        latencies_[requestCnt_ % MAX_LatencySamples] = latency;
+    ++requestCnt_;
+}
+
+void Server::reply(Channel& chan,
+                   const std::string& id,
+                   int exit,
+                   const std::string& payload)
+{
+    auto header = id + ' ' + std::to_string(exit) + ' ' + std::to_string(payload.size()) + '\n';
+
+    std::lock_guard<std::mutex> lock(chan.writeMutex_);
+    chan.writeAll(header) && chan.writeAll(payload);
+}
+
+std::string Server::stats() const
+{
+    std::vector<std::chrono::duration<double, std::milli>> latencies;
+    std::size_t requestCnt;
+    {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        latencies = latencies_;
+        requestCnt = requestCnt_;
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    auto percentile = [&latencies] (unsigned p) {
+        if (latencies.empty())
+            return 0.0;
+        auto idx = (latencies.size() - 1) * p / 100;
+        return latencies[idx].count();
+    };
+
+    std::ostringstream oss;
+    oss << "requests " << requestCnt << '\n'
+        << "p50 " << percentile(50) << " ms\n"
+        << "p90 " << percentile(90) << " ms\n"
+        << "p99 " << percentile(99) << " ms\n"
+        << "max " << percentile(100) << " ms\n";
+    return oss.str();
+}
@@ -0,0 +1,124 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CNIPPET_SERVER_H__
+#define CNIPPET_SERVER_H__
+
+#include "CompilerFrontend.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cnip {
+
+/*!
+ * \brief The Server class.
+ *
+ * A long-running server that processes requests read from the standard
+ * input or from the connections of a Unix domain socket. A request is a
+ * header line followed by a payload of the given length:
+ *
+ * \code
+ * <id> <command> <length> [compiler args...]\n<payload>
+ * \endcode
+ *
+ * where the command is one of:
+ *
+ *   - \c parse: process the payload (a C source) and reply with the
+ *     diagnostics;
+ *   - \c dump-AST: like \c parse, but reply with the AST as well;
+ *   - \c stats: reply with the number of processed requests and the
+ *     percentiles of the latency of (up to) the latest
+ *     \c MAX_LatencySamples of them;
+ *   - \c quit: stop serving (the input channel); requests already queued
+ *     are still processed, but those that arrive afterwards (from other
+ *     channels) are replied with an error.
+ *
+ * A response is a header line followed by a payload of the given length:
+ *
+ * \code
+ * <id> <exit-code> <length>\n<payload>
+ * \endcode
+ *
+ * Requests are processed concurrently by a pool of workers, each with its
+ * own frontend, so responses of a channel may come out of order. A header
+ * longer than \c MAX_HeaderLength, a malformed header, or a payload longer
+ * than \c MAX_PayloadLength ends the channel (after an error response, in
+ * the latter cases). No file is written for a request.
+ */
+class Server final
+{
+public:
+    Server(std::vector<std::unique_ptr<CompilerFrontend>> FEs);
+    ~Server();
+
+    int serveStdio();
+    int serveSocket(const std::string& socketPath);
+
+    /**
+     * Serve the requests read from \p inFd, writing the responses to
+     * \p outFd (neither of which is closed).
+     */
+    int serveDescriptors(int inFd, int outFd);
+
+private:
+    struct Channel;
+    struct Request;
+
+    void startWorkers();
+    void stopWorkers();
+    void serveChannel(std::shared_ptr<Channel> chan);
+    void work(CompilerFrontend* FE);
+    void process(CompilerFrontend* FE, Request& req);
+    void reply(Channel& chan, const std::string& id, int exit, const std::string& payload);
+    std::string stats() const;
+
+    std::vector<std::unique_ptr<CompilerFrontend>> FEs_;
+
+    std::mutex queueMutex_;
+    std::condition_variable queueCond_;
+    std::deque<std::unique_ptr<Request>> queue_;
+    std::vector<std::thread> workers_;
+    bool quitting_;
+    bool stopping_;
+
+    // The latencies of the latest requests, in a ring.
+    mutable std::mutex statsMutex_;
+    std::vector<std::chrono::duration<double, std::milli>> latencies_;
+    std::size_t requestCnt_;
+
+    static constexpr int ERROR_BadRequest = 200;
+    static constexpr int ERROR_SocketFailure = 201;
+
+    static constexpr std::size_t MAX_HeaderLength = 64 * 1024;
+    static constexpr std::size_t MAX_PayloadLength = 256 * 1024 * 1024;
+    static constexpr std::size_t MAX_LatencySamples = 4096;
+};
+
+} // cnip
+
+#endif
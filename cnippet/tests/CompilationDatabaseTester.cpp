@@ -0,0 +1,249 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "CompilationDatabaseTester.h"
+
+#include "CompilationDatabase.h"
+#include "CompilerFrontend_C.h"
+#include "Configuration_C.h"
+#include "FileInfo.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace cnip;
+using namespace psy;
+
+const std::string CompilationDatabaseTester::Name = "COMPILATION-DATABASE";
+
+void CompilationDatabaseTester::testCompilationDatabase()
+{
+    return run<CompilationDatabaseTester>(tests_);
+}
+
+void CompilationDatabaseTester::case0001()
+{
+    auto [exit, db] = CompilationDatabase::parse(R"(
+[
+  { "directory": "/home/user/proj",
+    "arguments": ["cc", "-c", "-DFOO", "main.c"],
+    "file": "main.c" },
+  { "directory": "/home/user/proj",
+    "arguments": ["cc", "-c", "/tmp/other.c"],
+    "file": "/tmp/other.c" }
+]
+)");
+
+    PSY_EXPECT_EQ_INT(exit, 0);
+    PSY_EXPECT_EQ_INT(db.entries().size(), 2);
+    PSY_EXPECT_EQ_STR(db.entries()[0].filePath_, "/home/user/proj/main.c");
+    PSY_EXPECT_EQ_STR(db.entries()[0].directory_, "/home/user/proj");
+    PSY_EXPECT_EQ_INT(db.entries()[0].compilerArgs_.size(), 4);
+    PSY_EXPECT_EQ_STR(db.entries()[0].compilerArgs_[2], "-DFOO");
+    PSY_EXPECT_EQ_STR(db.entries()[1].filePath_, "/tmp/other.c");
+}
+
+void CompilationDatabaseTester::case0002()
+{
+    auto [exit, db] = CompilationDatabase::parse(R"(
+[
+  { "directory": "/proj",
+    "command": "cc -c -I inc \"-DMSG=\\\"hi there\\\"\" x.c",
+    "file": "x.c" }
+]
+)");
+
+    PSY_EXPECT_EQ_INT(exit, 0);
+    PSY_EXPECT_EQ_INT(db.entries().size(), 1);
+    const auto& args = db.entries()[0].compilerArgs_;
+    PSY_EXPECT_EQ_INT(args.size(), 6);
+    PSY_EXPECT_EQ_STR(args[3], "inc");
+    PSY_EXPECT_EQ_STR(args[4], "-DMSG=\"hi there\"");
+}
+
+void CompilationDatabaseTester::case0003()
+{
+    // The `arguments' take precedence over the `command'.
+    auto [exit, db] = CompilationDatabase::parse(R"(
+[
+  { "directory": "/proj",
+    "arguments": ["cc", "-DA", "x.c"],
+    "command": "cc -DB x.c",
+    "file": "x.c" }
+]
+)");
+
+    PSY_EXPECT_EQ_INT(exit, 0);
+    PSY_EXPECT_EQ_INT(db.entries().size(), 1);
+    PSY_EXPECT_EQ_STR(db.entries()[0].compilerArgs_[1], "-DA");
+}
+
+void CompilationDatabaseTester::case0004()
+{
+    auto [exit, db] = CompilationDatabase::parse(R"(
+[
+  { "directory": "/proj/sub",
+    "file": "x.c",
+    "output": 1 }
+]
+)");
+
+    PSY_EXPECT_EQ_INT(exit, 0);
+    PSY_EXPECT_EQ_INT(db.entries().size(), 1);
+    PSY_EXPECT_EQ_STR(db.entries()[0].filePath_, "/proj/sub/x.c");
+}
+
+void CompilationDatabaseTester::case0005()
+{
+    auto [exit, db] = CompilationDatabase::parse(R"([ { "file": "x\u00zz.c" } ])");
+
+    PSY_EXPECT_EQ_INT(exit, 1);
+    PSY_EXPECT_EQ_STR(db.error(), "malformed JSON at offset 18");
+}
+
+void CompilationDatabaseTester::case0006()
+{
+    auto [exit, db] = CompilationDatabase::parse(R"([ { "file": "x\u00)");
+
+    PSY_EXPECT_EQ_INT(exit, 1);
+    PSY_EXPECT_TRUE(db.error().find("malformed JSON") == 0);
+}
+
+void CompilationDatabaseTester::case0007()
+{
+    auto [exit, db] = CompilationDatabase::parse(R"([ { "file": "x.c" }, { "directory": "/proj" } ])");
+
+    PSY_EXPECT_EQ_INT(exit, 1);
+    PSY_EXPECT_EQ_STR(db.error(), "entry 1 without a file");
+}
+
+void CompilationDatabaseTester::case0101()
+{
+    auto args = CompilationDatabase::splitCommand("  cc   -c\tx.c ");
+
+    PSY_EXPECT_EQ_INT(args.size(), 3);
+    PSY_EXPECT_EQ_STR(args[0], "cc");
+    PSY_EXPECT_EQ_STR(args[1], "-c");
+    PSY_EXPECT_EQ_STR(args[2], "x.c");
+}
+
+void CompilationDatabaseTester::case0102()
+{
+    auto args = CompilationDatabase::splitCommand(R"(cc '-DA=a b' "-DB=\"b\"" -DC=c\ d)");
+
+    PSY_EXPECT_EQ_INT(args.size(), 4);
+    PSY_EXPECT_EQ_STR(args[1], "-DA=a b");
+    PSY_EXPECT_EQ_STR(args[2], "-DB=\"b\"");
+    PSY_EXPECT_EQ_STR(args[3], "-DC=c d");
+}
+
+void CompilationDatabaseTester::case0103()
+{
+    auto args = CompilationDatabase::splitCommand(R"(cc -I"dir with space"/inc '')");
+
+    PSY_EXPECT_EQ_INT(args.size(), 3);
+    PSY_EXPECT_EQ_STR(args[1], "-Idir with space/inc");
+    PSY_EXPECT_EQ_STR(args[2], "");
+}
+
+void CompilationDatabaseTester::case0201()
+{
+    ConfigurationForC config(CnippetTestSuite::parseCmdLine());
+    config.applyCompilerArguments({ "cc", "-std=gnu99", "-c", "x.c" }, "");
+
+    PSY_EXPECT_EQ_ENU(config.langStd, LanguageDialect::Std::C99, LanguageDialect::Std);
+}
+
+void CompilationDatabaseTester::case0202()
+{
+    ConfigurationForC config(CnippetTestSuite::parseCmdLine({ "--cpp-D", "BASE" }));
+    config.applyCompilerArguments({ "cc", "-DA", "-D", "B=1", "-UC", "-U", "D", "x.c" }, "");
+
+    PSY_EXPECT_EQ_INT(config.macrosToDefine.size(), 3);
+    PSY_EXPECT_EQ_STR(config.macrosToDefine[0], "BASE");
+    PSY_EXPECT_EQ_STR(config.macrosToDefine[1], "A");
+    PSY_EXPECT_EQ_STR(config.macrosToDefine[2], "B=1");
+    PSY_EXPECT_EQ_INT(config.macrosToUndef.size(), 2);
+    PSY_EXPECT_EQ_STR(config.macrosToUndef[0], "C");
+    PSY_EXPECT_EQ_STR(config.macrosToUndef[1], "D");
+}
+
+void CompilationDatabaseTester::case0203()
+{
+    ConfigurationForC config(CnippetTestSuite::parseCmdLine());
+    config.applyCompilerArguments({ "cc", "-Iinc", "-I", "/usr/inc", "-I", "../up", "x.c" }, "/proj");
+
+    PSY_EXPECT_EQ_INT(config.headerSearchPaths.size(), 3);
+    PSY_EXPECT_EQ_STR(config.headerSearchPaths[0], "/proj/inc");
+    PSY_EXPECT_EQ_STR(config.headerSearchPaths[1], "/usr/inc");
+    PSY_EXPECT_EQ_STR(config.headerSearchPaths[2], "/proj/../up");
+    PSY_EXPECT_EQ_STR(config.workingDirectory, "/proj");
+}
+
+void CompilationDatabaseTester::case0204()
+{
+    ConfigurationForC config(CnippetTestSuite::parseCmdLine());
+    config.applyCompilerArguments({ "cc", "-Iinc", "-I" }, "");
+
+    PSY_EXPECT_EQ_INT(config.headerSearchPaths.size(), 1);
+    PSY_EXPECT_EQ_STR(config.headerSearchPaths[0], "inc");
+    PSY_EXPECT_EQ_STR(config.workingDirectory, "");
+}
+
+void CompilationDatabaseTester::case0205()
+{
+    // A `#include "..."' resolves next to the file, and a relative `-I'
+    // against the directory of the command, wherever cnip runs.
+    char tmpl[] = "/tmp/cnip-cdb-tester-XXXXXX";
+    std::string dir = mkdtemp(tmpl);
+    std::string subDir = dir + "/src";
+    std::string incDir = dir + "/inc";
+    PSY_EXPECT_EQ_INT(mkdir(subDir.c_str(), 0700), 0);
+    PSY_EXPECT_EQ_INT(mkdir(incDir.c_str(), 0700), 0);
+    std::ofstream(subDir + "/local.h") << "typedef int local_t;\n";
+    std::ofstream(incDir + "/other.h") << "typedef int other_t;\n";
+
+    std::string srcText = "#include \"local.h\"\n"
+                          "#include \"other.h\"\n"
+                          "local_t x; other_t y;\n";
+
+    CCompilerFrontend FE(CnippetTestSuite::parseCmdLine({ "--cpp-includes" }));
+    std::ostringstream out;
+    std::ostringstream err;
+    FE.redirectOutput(out, err);
+    FE.configureFor({ "cc", "-Iinc", "-c", "src/x.c" }, dir);
+    FE.configuration().writePreprocessedFile = false;
+    auto exit = FE.run(srcText, FileInfo(subDir + "/x.c"));
+
+    std::remove((subDir + "/local.h").c_str());
+    std::remove((incDir + "/other.h").c_str());
+    rmdir(subDir.c_str());
+    rmdir(incDir.c_str());
+    rmdir(dir.c_str());
+
+    PSY_EXPECT_EQ_INT(exit, 0);
+    PSY_EXPECT_EQ_STR(err.str(), "");
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef CNIPPET_COMPILATION_DATABASE_TESTER_H__
+#define CNIPPET_COMPILATION_DATABASE_TESTER_H__
+
+#include "TestSuite_Cnippet.h"
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define TEST_COMPILATION_DATABASE(Function) TestFunction { &CompilationDatabaseTester::Function, #Function }
+
+namespace cnip {
+
+class CompilationDatabaseTester final : public psy::Tester
+{
+public:
+    CompilationDatabaseTester(psy::TestSuite* suite)
+        : psy::Tester(suite)
+    {}
+
+    static const std::string Name;
+    virtual std::string name() const override { return Name; }
+
+    void testCompilationDatabase();
+
+    using TestFunction = std::pair<std::function<void(CompilationDatabaseTester*)>, const char*>;
+
+    /*
+        + 0000-0099 -> parsing of the database
+        + 0100-0199 -> splitting of commands
+        + 0200-0299 -> application of compiler arguments
+     */
+
+    void case0001();
+    void case0002();
+    void case0003();
+    void case0004();
+    void case0005();
+    void case0006();
+    void case0007();
+
+    void case0101();
+    void case0102();
+    void case0103();
+
+    void case0201();
+    void case0202();
+    void case0203();
+    void case0204();
+    void case0205();
+
+    std::vector<TestFunction> tests_
+    {
+        TEST_COMPILATION_DATABASE(case0001),
+        TEST_COMPILATION_DATABASE(case0002),
+        TEST_COMPILATION_DATABASE(case0003),
+        TEST_COMPILATION_DATABASE(case0004),
+        TEST_COMPILATION_DATABASE(case0005),
+        TEST_COMPILATION_DATABASE(case0006),
+        TEST_COMPILATION_DATABASE(case0007),
+
+        TEST_COMPILATION_DATABASE(case0101),
+        TEST_COMPILATION_DATABASE(case0102),
+        TEST_COMPILATION_DATABASE(case0103),
+
+        TEST_COMPILATION_DATABASE(case0201),
+        TEST_COMPILATION_DATABASE(case0202),
+        TEST_COMPILATION_DATABASE(case0203),
+        TEST_COMPILATION_DATABASE(case0204),
+        TEST_COMPILATION_DATABASE(case0205),
+    };
+};
+
+} // cnip
+
+#endif
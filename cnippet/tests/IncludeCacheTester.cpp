@@ -0,0 +1,177 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "IncludeCacheTester.h"
+
+#include "GnuCompilerFacade.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include <unistd.h>
+
+using namespace cnip;
+using namespace psy;
+
+const std::string IncludeCacheTester::Name = "INCLUDE-CACHE";
+
+void IncludeCacheTester::testIncludeCache()
+{
+    return run<IncludeCacheTester>(tests_);
+}
+
+void IncludeCacheTester::setUp()
+{
+    char tmpl[] = "/tmp/cnip-include-cache-tester-XXXXXX";
+    dir_ = mkdtemp(tmpl);
+}
+
+void IncludeCacheTester::tearDown()
+{
+    std::remove((dir_ + "/h.h").c_str());
+    rmdir(dir_.c_str());
+}
+
+std::string IncludeCacheTester::preprocess(const std::string& srcText,
+                                           const std::string& headerText,
+                                           bool cached)
+{
+    std::ofstream(dir_ + "/h.h") << headerText;
+
+    GnuCompilerFacade cc("gcc", "c11", {}, {}, { dir_ });
+    auto& cache = IncludeCache::shared();
+
+    auto before = cache.stats();
+    auto [exit1, text1] = cache.preprocess(cc, srcText);
+    auto [exit2, text2] = cache.preprocess(cc, srcText);
+    auto after = cache.stats();
+
+    PSY_EXPECT_EQ_INT(exit1, 0);
+    PSY_EXPECT_EQ_INT(exit2, 0);
+    PSY_EXPECT_EQ_STR(text1, text2);
+    if (cached) {
+        PSY_EXPECT_EQ_INT(after.misses_ - before.misses_, 1);
+        PSY_EXPECT_EQ_INT(after.hits_ - before.hits_, 1);
+        PSY_EXPECT_EQ_INT(after.bypasses_ - before.bypasses_, 0);
+    }
+    else {
+        PSY_EXPECT_EQ_INT(after.bypasses_ - before.bypasses_, 2);
+    }
+
+    return text1;
+}
+
+void IncludeCacheTester::case0001()
+{
+    auto text = preprocess("#include \"h.h\"\n"
+                           "int y = X;\n",
+                           "#define X 1\n"
+                           "int x;\n",
+                           true);
+
+    PSY_EXPECT_TRUE(text.find("int x;") != std::string::npos);
+    PSY_EXPECT_TRUE(text.find("int y = 1;") != std::string::npos);
+}
+
+void IncludeCacheTester::case0002()
+{
+    // A license block comment is part of the section.
+    auto text = preprocess("/*\n"
+                           " * License\n"
+                           " */\n"
+                           "\n"
+                           "#include \"h.h\" /* why */\n"
+                           "// comment\n"
+                           "int y = X;\n",
+                           "#define X 1\n",
+                           true);
+
+    PSY_EXPECT_TRUE(text.find("int y = 1;") != std::string::npos);
+}
+
+void IncludeCacheTester::case0003()
+{
+    // A feature-test macro affects the expansion of the headers.
+    auto text = preprocess("#define FEATURE\n"
+                           "#pragma once\n"
+                           "#include \"h.h\"\n"
+                           "int y;\n",
+                           "#ifdef FEATURE\n"
+                           "int feature;\n"
+                           "#endif\n",
+                           true);
+
+    PSY_EXPECT_TRUE(text.find("int feature;") != std::string::npos);
+}
+
+void IncludeCacheTester::case0004()
+{
+    auto text = preprocess("#define TWICE(x) \\\n"
+                           "    ((x) + (x))\n"
+                           "#include \"h.h\"\n"
+                           "int y = TWICE(X);\n",
+                           "#define X 1\n",
+                           true);
+
+    PSY_EXPECT_TRUE(text.find("int y = ((1) + (1));") != std::string::npos);
+}
+
+void IncludeCacheTester::case0005()
+{
+    // An include guard ends the section.
+    auto text = preprocess("#ifndef GUARD\n"
+                           "#define GUARD\n"
+                           "#include \"h.h\"\n"
+                           "int y = X;\n"
+                           "#endif\n",
+                           "#define X 1\n",
+                           false);
+
+    PSY_EXPECT_TRUE(text.find("int y = 1;") != std::string::npos);
+}
+
+void IncludeCacheTester::case0006()
+{
+    // So does a comment followed by code.
+    auto text = preprocess("/* a\n"
+                           "   b */ int z;\n"
+                           "#include \"h.h\"\n"
+                           "int y = X;\n",
+                           "#define X 1\n",
+                           false);
+
+    PSY_EXPECT_TRUE(text.find("int z;") != std::string::npos);
+    PSY_EXPECT_TRUE(text.find("int y = 1;") != std::string::npos);
+}
+
+void IncludeCacheTester::case0007()
+{
+    // The lines after the section keep their numbering.
+    auto text = preprocess("/*\n"
+                           " */\n"
+                           "#include \"h.h\"\n"
+                           "int y = __LINE__;\n",
+                           "\n",
+                           true);
+
+    PSY_EXPECT_TRUE(text.find("int y = 4;") != std::string::npos);
+}
@@ -0,0 +1,89 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef CNIPPET_INCLUDE_CACHE_TESTER_H__
+#define CNIPPET_INCLUDE_CACHE_TESTER_H__
+
+#include "TestSuite_Cnippet.h"
+
+#include "IncludeCache_C.h"
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define TEST_INCLUDE_CACHE(Function) TestFunction { &IncludeCacheTester::Function, #Function }
+
+namespace cnip {
+
+class IncludeCacheTester final : public psy::Tester
+{
+public:
+    IncludeCacheTester(psy::TestSuite* suite)
+        : psy::Tester(suite)
+    {}
+
+    static const std::string Name;
+    virtual std::string name() const override { return Name; }
+
+    void testIncludeCache();
+
+    virtual void setUp() override;
+    virtual void tearDown() override;
+
+    /**
+     * Preprocess \p srcText (twice) through the cache, with the header
+     * `h.h' of text \p headerText in the search path, and expect that
+     * the section of the text is cached (or that it bypasses the cache).
+     */
+    std::string preprocess(const std::string& srcText,
+                           const std::string& headerText,
+                           bool cached);
+
+    using TestFunction = std::pair<std::function<void(IncludeCacheTester*)>, const char*>;
+
+    void case0001();
+    void case0002();
+    void case0003();
+    void case0004();
+    void case0005();
+    void case0006();
+    void case0007();
+
+    std::vector<TestFunction> tests_
+    {
+        TEST_INCLUDE_CACHE(case0001),
+        TEST_INCLUDE_CACHE(case0002),
+        TEST_INCLUDE_CACHE(case0003),
+        TEST_INCLUDE_CACHE(case0004),
+        TEST_INCLUDE_CACHE(case0005),
+        TEST_INCLUDE_CACHE(case0006),
+        TEST_INCLUDE_CACHE(case0007),
+    };
+
+private:
+    std::string dir_;
+};
+
+} // cnip
+
+#endif
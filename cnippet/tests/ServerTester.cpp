@@ -0,0 +1,154 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "ServerTester.h"
+
+#include "CompilerFrontend_C.h"
+#include "Server.h"
+
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace cnip;
+using namespace psy;
+
+const std::string ServerTester::Name = "SERVER";
+
+void ServerTester::testServer()
+{
+    return run<ServerTester>(tests_);
+}
+
+std::map<std::string, std::string> ServerTester::serve(const std::string& requests)
+{
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0)
+        PSY__internals__FAIL("cannot create socket pair");
+
+    std::vector<std::unique_ptr<CompilerFrontend>> FEs;
+    for (auto i = 0; i < 2; ++i)
+        FEs.emplace_back(new CCompilerFrontend(CnippetTestSuite::parseCmdLine()));
+    Server server(std::move(FEs));
+    std::thread thread([&server, &fds] () { server.serveDescriptors(fds[1], fds[1]); });
+
+    std::size_t done = 0;
+    while (done < requests.size()) {
+        auto cnt = write(fds[0], requests.data() + done, requests.size() - done);
+        if (cnt <= 0)
+            break;
+        done += cnt;
+    }
+    shutdown(fds[0], SHUT_WR);
+    thread.join();
+    close(fds[1]);
+
+    std::string text;
+    char data[4096];
+    ssize_t cnt;
+    while ((cnt = read(fds[0], data, sizeof(data))) > 0)
+        text.append(data, cnt);
+    close(fds[0]);
+
+    std::map<std::string, std::string> responses;
+    std::string::size_type pos = 0;
+    while (pos < text.size()) {
+        auto nl = text.find('\n', pos);
+        if (nl == std::string::npos)
+            PSY__internals__FAIL("truncated response header");
+        std::string id;
+        int exit = 0;
+        std::size_t len = 0;
+        std::istringstream iss(text.substr(pos, nl - pos));
+        iss >> id >> exit >> len;
+        if (!iss || nl + 1 + len > text.size())
+            PSY__internals__FAIL("malformed response");
+        responses[id] = text.substr(pos, nl + 1 + len - pos);
+        pos = nl + 1 + len;
+    }
+
+    return responses;
+}
+
+void ServerTester::case0001()
+{
+    auto responses = serve("a parse 6\nint x;");
+
+    PSY_EXPECT_EQ_INT(responses.size(), 1);
+    PSY_EXPECT_EQ_STR(responses["a"], "a 0 0\n");
+}
+
+void ServerTester::case0002()
+{
+    auto responses = serve("a parse 6\nint x;"
+                           "b parse 6\nint y;"
+                           "c quit 0\n");
+
+    PSY_EXPECT_EQ_INT(responses.size(), 2);
+    PSY_EXPECT_EQ_STR(responses["a"], "a 0 0\n");
+    PSY_EXPECT_EQ_STR(responses["b"], "b 0 0\n");
+}
+
+void ServerTester::case0003()
+{
+    auto responses = serve("a stats 0\n");
+
+    PSY_EXPECT_EQ_INT(responses.size(), 1);
+    PSY_EXPECT_EQ_STR(responses["a"].substr(0, 4), "a 0 ");
+    PSY_EXPECT_TRUE(responses["a"].find("requests 0") != std::string::npos);
+}
+
+void ServerTester::case0004()
+{
+    // Requests after a quit aren't served.
+    auto responses = serve("a quit 0\n"
+                           "b parse 6\nint x;"
+                           "c stats 0\n");
+
+    PSY_EXPECT_EQ_INT(responses.size(), 0);
+}
+
+void ServerTester::case0005()
+{
+    // The channel ends after a malformed header.
+    auto responses = serve("a parse\n"
+                           "b parse 6\nint x;");
+
+    PSY_EXPECT_EQ_INT(responses.size(), 1);
+    PSY_EXPECT_EQ_STR(responses["a"], "a 200 17\nmalformed header\n");
+}
+
+void ServerTester::case0006()
+{
+    // The payload is never interpreted as commands.
+    auto marker = "/tmp/cnip-server-tester-" + std::to_string(getpid());
+    unlink(marker.c_str());
+
+    std::string payload = "int x;\nEOF\ntouch " + marker + "\n";
+    auto responses = serve("a parse " + std::to_string(payload.size()) + "\n" + payload);
+
+    PSY_EXPECT_EQ_INT(responses.size(), 1);
+    PSY_EXPECT_FALSE(access(marker.c_str(), F_OK) == 0);
+    unlink(marker.c_str());
+}
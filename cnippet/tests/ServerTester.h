@@ -0,0 +1,77 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef CNIPPET_SERVER_TESTER_H__
+#define CNIPPET_SERVER_TESTER_H__
+
+#include "TestSuite_Cnippet.h"
+
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define TEST_SERVER(Function) TestFunction { &ServerTester::Function, #Function }
+
+namespace cnip {
+
+class ServerTester final : public psy::Tester
+{
+public:
+    ServerTester(psy::TestSuite* suite)
+        : psy::Tester(suite)
+    {}
+
+    static const std::string Name;
+    virtual std::string name() const override { return Name; }
+
+    void testServer();
+
+    /**
+     * Serve the given \p requests, over a socket pair, and return the
+     * responses (header and payload), by id.
+     */
+    std::map<std::string, std::string> serve(const std::string& requests);
+
+    using TestFunction = std::pair<std::function<void(ServerTester*)>, const char*>;
+
+    void case0001();
+    void case0002();
+    void case0003();
+    void case0004();
+    void case0005();
+    void case0006();
+
+    std::vector<TestFunction> tests_
+    {
+        TEST_SERVER(case0001),
+        TEST_SERVER(case0002),
+        TEST_SERVER(case0003),
+        TEST_SERVER(case0004),
+        TEST_SERVER(case0005),
+        TEST_SERVER(case0006),
+    };
+};
+
+} // cnip
+
+#endif
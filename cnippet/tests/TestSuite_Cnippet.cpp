@@ -0,0 +1,86 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "TestSuite_Cnippet.h"
+
+#include "CompilationDatabaseTester.h"
+#include "IncludeCacheTester.h"
+#include "ServerTester.h"
+
+#include "Configuration_C.h"
+
+using namespace cnip;
+
+CnippetTestSuite::~CnippetTestSuite()
+{}
+
+std::tuple<int, int> CnippetTestSuite::testAll()
+{
+    auto CDB = std::make_unique<CompilationDatabaseTester>(this);
+    CDB->testCompilationDatabase();
+
+    auto IC = std::make_unique<IncludeCacheTester>(this);
+    IC->testIncludeCache();
+
+    auto S = std::make_unique<ServerTester>(this);
+    S->testServer();
+
+    auto res = std::make_tuple(CDB->totalPassed()
+                                    + IC->totalPassed()
+                                    + S->totalPassed(),
+                               CDB->totalFailed()
+                                    + IC->totalFailed()
+                                    + S->totalFailed());
+
+    testers_.emplace_back(CDB.release());
+    testers_.emplace_back(IC.release());
+    testers_.emplace_back(S.release());
+
+    return res;
+}
+
+std::string CnippetTestSuite::description() const
+{
+    return "cnippet test suite";
+}
+
+void CnippetTestSuite::printSummary() const
+{
+    for (auto const& tester : testers_) {
+        std::cout << "    " << tester->name() << " passed: " << tester->totalPassed() << std::endl
+                  << "    " << std::string(tester->name().length(), ' ') << " failed: " << tester->totalFailed() << std::endl;
+    }
+}
+
+cxxopts::ParseResult CnippetTestSuite::parseCmdLine(std::vector<std::string> args)
+{
+    cxxopts::Options cmdLineOpts("cnip", "cnippet");
+    ConfigurationForC::extend(cmdLineOpts);
+
+    args.insert(args.begin(), "cnip");
+    std::vector<char*> argv;
+    for (auto& arg : args)
+        argv.push_back(&arg[0]);
+    int argc = argv.size();
+    auto argvData = argv.data();
+
+    return cmdLineOpts.parse(argc, argvData);
+}
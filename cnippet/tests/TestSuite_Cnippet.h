@@ -0,0 +1,57 @@
+// Copyright (c) 2022 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef CNIPPET_TEST_SUITE_H__
+#define CNIPPET_TEST_SUITE_H__
+
+#include "tests/TestSuite.h"
+#include "tests/Tester.h"
+
+#include "cxxopts.hpp"
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace cnip {
+
+class CnippetTestSuite : public psy::TestSuite
+{
+public:
+    virtual ~CnippetTestSuite();
+
+    virtual std::tuple<int, int> testAll() override;
+    virtual std::string description() const override;
+    virtual void printSummary() const override;
+
+    /**
+     * Parse the command line \p args (after the program name) with the
+     * options of cnip for C.
+     */
+    static cxxopts::ParseResult parseCmdLine(std::vector<std::string> args = {});
+
+private:
+    std::vector<std::unique_ptr<psy::Tester>> testers_;
+};
+
+} // cnip
+
+#endif
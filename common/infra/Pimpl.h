@@ -33,6 +33,11 @@
     struct CLASS##Impl; \
     std::unique_ptr<CLASS##Impl> impl_;
 
+#define DECL_PIMPL_IN_ARENA(CLASS) \
+    struct CLASS##Impl; \
+    struct CLASS##ImplFinalizer { void operator()(CLASS##Impl* p) const; }; \
+    std::unique_ptr<CLASS##Impl, CLASS##ImplFinalizer> impl_;
+
 #define DECL_PIMPL_SUB(CLASS) \
     struct CLASS##Impl; \
     CLASS##Impl* CAST() const { return ((CLASS##Impl*)impl_.get()); }
@@ -22,6 +22,7 @@
 
 #include "C/tests/TestSuite_Internals.h"
 #include "C/tests/TestSuite_API.h"
+#include "cnippet/tests/TestSuite_Cnippet.h"
 
 #include <iostream>
 
@@ -37,18 +38,24 @@ void TestSuite::runTests()
     C::APITestSuite suite1;
     auto [passed1, failed1] = suite1.testAll();
 
+    cnip::CnippetTestSuite suite2;
+    auto [passed2, failed2] = suite2.testAll();
+
     std::cout << suite0.description() << std::endl;
     suite0.printSummary();
 
     std::cout << suite1.description() << std::endl;
     suite1.printSummary();
 
-    auto accErrorCnt = failed0 + failed1;
+    std::cout << suite2.description() << std::endl;
+    suite2.printSummary();
+
+    auto accErrorCnt = failed0 + failed1 + failed2;
     if (!accErrorCnt)
         std::cout << "All passed" << std::endl;
     else
         std::cout << std::string(17, '.') << " \n"
                   << "> Total failures: "
-                  << failed0 + failed1
+                  << accErrorCnt
                   << std::endl;
 }
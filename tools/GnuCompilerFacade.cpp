@@ -28,6 +28,23 @@
 namespace
 {
 const char * const kInclude = "#include";
+
+/*
+ * Quote an argument for the shell (in single quotes, within which only
+ * the single quote itself needs care).
+ */
+std::string shellQuoted(const std::string& arg)
+{
+    std::string s = "'";
+    for (auto c : arg) {
+        if (c == '\'')
+            s += "'\\''";
+        else
+            s += c;
+    }
+    s += "'";
+    return s;
+}
 }
 
 using namespace psy;
@@ -35,24 +52,22 @@ using namespace psy;
 GnuCompilerFacade::GnuCompilerFacade(const std::string& compilerName,
                                const std::string& std,
                                const std::vector<std::string>& D,
-                               const std::vector<std::string>& U)
+                               const std::vector<std::string>& U,
+                               const std::vector<std::string>& I,
+                               const std::vector<std::string>& iquote,
+                               const std::string& workingDir)
     : compilerName_(compilerName)
     , std_(std)
     , D_(D)
     , U_(U)
+    , I_(I)
+    , iquote_(iquote)
+    , workingDir_(workingDir)
 {}
 
 std::pair<int, std::string> GnuCompilerFacade::preprocess(const std::string& srcText)
 {
-    std::string in = "cat << 'EOF' | ";
-    in += compilerName_;
-    in += assembleMacroCmd();
-    in += " ";
-    in += "-std=" + std_ + " ";
-    in += "-E -x c -CC -";
-    in += "\n" + srcText + "\nEOF";
-
-    return Process().execute(in);
+    return preprocessCore(srcText, "-CC");
 }
 
 std::pair<int, std::string> GnuCompilerFacade::preprocess_IgnoreIncludes(const std::string& srcText)
@@ -74,12 +89,77 @@ std::pair<int, std::string> GnuCompilerFacade::preprocess_IgnoreIncludes(const s
     return preprocess(srcText_P);
 }
 
+std::pair<int, std::string> GnuCompilerFacade::preprocess_MacroDefinitions(const std::string& srcText)
+{
+    return preprocessCore(srcText, "-dM");
+}
+
+/*
+ * The source text is written to the standard input of the compiler, which
+ * is executed directly (not through a shell): the text, which may come from
+ * a client of the server, is never interpreted as commands. Since the text
+ * has no file of its own, the directories of `#include "..."' are given
+ * through `-iquote', and the compiler runs in the working directory of the
+ * original command (if any).
+ */
+std::pair<int, std::string> GnuCompilerFacade::preprocessCore(const std::string& srcText,
+                                                              const std::string& extraOpts)
+{
+    std::vector<std::string> args;
+    std::istringstream iss(compilerName_);
+    std::string word;
+    while (iss >> word)
+        args.push_back(word);
+    for (const auto& d : D_) {
+        args.push_back("-D");
+        args.push_back(d);
+    }
+    for (const auto& u : U_) {
+        args.push_back("-U");
+        args.push_back(u);
+    }
+    for (const auto& i : I_) {
+        args.push_back("-I");
+        args.push_back(i);
+    }
+    for (const auto& q : iquote_) {
+        args.push_back("-iquote");
+        args.push_back(q);
+    }
+    args.push_back("-std=" + std_);
+    args.push_back("-E");
+    args.push_back("-x");
+    args.push_back("c");
+    args.push_back(extraOpts);
+    args.push_back("-");
+
+    return Process().execute(args, srcText + "\n", workingDir_);
+}
+
+std::string GnuCompilerFacade::invocationKey() const
+{
+    auto key = compilerName_ + " -std=" + std_ + assembleMacroCmd() + assembleSearchPathCmd();
+    if (!workingDir_.empty())
+        key = "cd " + shellQuoted(workingDir_) + " && " + key;
+    return key;
+}
+
 std::string GnuCompilerFacade::assembleMacroCmd() const
 {
     std::string s;
     for (const auto& d : D_)
-        s += " -D " + d;
+        s += " -D " + shellQuoted(d);
     for (const auto& u : U_)
-        s += " -U " + u;
+        s += " -U " + shellQuoted(u);
+    return s;
+}
+
+std::string GnuCompilerFacade::assembleSearchPathCmd() const
+{
+    std::string s;
+    for (const auto& i : I_)
+        s += " -I " + shellQuoted(i);
+    for (const auto& q : iquote_)
+        s += " -iquote " + shellQuoted(q);
     return s;
 }
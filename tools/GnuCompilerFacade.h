@@ -33,18 +33,30 @@ public:
     GnuCompilerFacade(const std::string& compilerName,
                    const std::string& std,
                    const std::vector<std::string>& D,
-                   const std::vector<std::string>& U);
+                   const std::vector<std::string>& U,
+                   const std::vector<std::string>& I = {},
+                   const std::vector<std::string>& iquote = {},
+                   const std::string& workingDir = "");
 
     std::pair<int, std::string> preprocess(const std::string& srcText);
     std::pair<int, std::string> preprocess_IgnoreIncludes(const std::string& srcText);
+    std::pair<int, std::string> preprocess_MacroDefinitions(const std::string& srcText);
+
+    std::string invocationKey() const;
 
 private:
+    std::pair<int, std::string> preprocessCore(const std::string& srcText,
+                                               const std::string& extraOpts);
     std::string assembleMacroCmd() const;
+    std::string assembleSearchPathCmd() const;
 
     std::string compilerName_;
     std::string std_;
     std::vector<std::string> D_;
     std::vector<std::string> U_;
+    std::vector<std::string> I_;
+    std::vector<std::string> iquote_;
+    std::string workingDir_;
 };
 
 } // psy
@@ -21,6 +21,7 @@
 #ifndef PSYCHE_FILE_INFO_H__
 #define PSYCHE_FILE_INFO_H__
 
+#include <memory>
 #include <string>
 
 namespace psy {
@@ -110,7 +111,7 @@ public:
 
 private:
     struct FileInfoImpl;
-    FileInfoImpl* impl_;
+    std::unique_ptr<FileInfoImpl> impl_;
 };
 
 bool operator==(const FileInfo& a, const FileInfo& b);
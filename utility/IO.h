@@ -21,14 +21,18 @@
 #ifndef PSYCHE_IO_H__
 #define PSYCHE_IO_H__
 
+#include <iostream>
 #include <string>
 #include <utility>
 
 namespace psy {
 
-std::pair<int, std::string> readFile(const std::string& filePath);
+std::pair<int, std::string> readFile(const std::string& filePath,
+                                     std::ostream& err = std::cerr);
 
-int writeFile(const std::string& filePath, const std::string& content);
+int writeFile(const std::string& filePath,
+              const std::string& content,
+              std::ostream& err = std::cerr);
 
 } // psy
 
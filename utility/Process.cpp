@@ -21,9 +21,17 @@
 #include "Process.h"
 
 #include <array>
+#include <cerrno>
+#include <csignal>
 #include <cstdio> // Using POSIX's `popen'.
 #include <iostream>
 
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 using namespace psy;
 
 namespace {
@@ -55,3 +63,109 @@ std::pair<int, std::string> Process::execute(const std::string &s)
 {
     return executeCore(s.c_str());
 }
+
+std::pair<int, std::string> Process::execute(const std::vector<std::string>& args,
+                                             const std::string& input,
+                                             const std::string& dir)
+{
+    if (args.empty())
+        return std::make_pair(1, "");
+
+    int inFds[2];
+    int outFds[2];
+    if (pipe(inFds) != 0)
+        return std::make_pair(1, "");
+    if (pipe(outFds) != 0) {
+        close(inFds[0]);
+        close(inFds[1]);
+        return std::make_pair(1, "");
+    }
+
+    std::vector<char*> argv;
+    for (const auto& arg : args)
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    argv.push_back(nullptr);
+
+    auto pid = fork();
+    if (pid == 0) {
+        dup2(inFds[0], STDIN_FILENO);
+        dup2(outFds[1], STDOUT_FILENO);
+        close(inFds[0]);
+        close(inFds[1]);
+        close(outFds[0]);
+        close(outFds[1]);
+        if (!dir.empty() && chdir(dir.c_str()) != 0)
+            _exit(127);
+        execvp(argv[0], argv.data());
+        _exit(127);
+    }
+
+    close(inFds[0]);
+    close(outFds[1]);
+    if (pid < 0) {
+        close(inFds[1]);
+        close(outFds[0]);
+        return std::make_pair(1, "");
+    }
+
+    // The input is written as the output is read, so that neither end of
+    // the pipes blocks on a full buffer of the other.
+    // If the program quits before its input is consumed, the SIGPIPE that
+    // writing raises (to this thread) is blocked and discarded.
+    fcntl(inFds[1], F_SETFL, fcntl(inFds[1], F_GETFL) | O_NONBLOCK);
+    sigset_t pipeSet;
+    sigset_t oldSet;
+    sigemptyset(&pipeSet);
+    sigaddset(&pipeSet, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipeSet, &oldSet);
+
+    std::string all;
+    std::size_t written = 0;
+    int inFd = inFds[1];
+    if (input.empty()) {
+        close(inFd);
+        inFd = -1;
+    }
+    while (true) {
+        struct pollfd fds[2] = { { outFds[0], POLLIN, 0 }, { inFd, POLLOUT, 0 } };
+        if (poll(fds, inFd < 0 ? 1 : 2, -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (inFd >= 0 && fds[1].revents) {
+            auto cnt = write(inFd, input.data() + written, input.size() - written);
+            if (cnt > 0)
+                written += cnt;
+            if ((cnt < 0 && errno != EAGAIN && errno != EINTR) || written == input.size()) {
+                close(inFd);
+                inFd = -1;
+            }
+        }
+        if (fds[0].revents) {
+            std::array<char, 4096> buf;
+            auto cnt = read(outFds[0], buf.data(), buf.size());
+            if (cnt < 0 && errno == EINTR)
+                continue;
+            if (cnt <= 0)
+                break;
+            all.append(buf.data(), cnt);
+        }
+    }
+    if (inFd >= 0)
+        close(inFd);
+    close(outFds[0]);
+
+    sigset_t pendingSet;
+    sigpending(&pendingSet);
+    if (sigismember(&pendingSet, SIGPIPE)) {
+        struct timespec noWait = { 0, 0 };
+        sigtimedwait(&pipeSet, nullptr, &noWait);
+    }
+    pthread_sigmask(SIG_SETMASK, &oldSet, nullptr);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+        ;
+    return std::make_pair(status, all);
+}
@@ -23,6 +23,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace psy {
 
@@ -31,6 +32,14 @@ class Process final
 public:
     std::pair<int, std::string> execute(const std::string& cmd);
     std::pair<int, std::string> execute(std::string&& cmd);
+
+    /*
+     * Execute the program of \p args (without a shell), writing \p input
+     * to its standard input, from within directory \p dir (if non-empty).
+     */
+    std::pair<int, std::string> execute(const std::vector<std::string>& args,
+                                         const std::string& input,
+                                         const std::string& dir = "");
 };
 
 } // psy